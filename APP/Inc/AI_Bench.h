@@ -0,0 +1,9 @@
+#ifndef AI_BENCH_H
+#define AI_BENCH_H
+
+#include <stdint.h>
+#include "ai_platform.h"
+
+void AI_Bench_Run(ai_handle net, const uint8_t *input);
+
+#endif
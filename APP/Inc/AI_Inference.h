@@ -0,0 +1,45 @@
+#ifndef AI_INFERENCE_H
+#define AI_INFERENCE_H
+
+#include <stdint.h>
+#include "shared_types.h"
+
+/* 推理耗时与吞吐指标 */
+typedef struct {
+    uint32_t runs;            /* 累计推理次数 */
+    uint32_t errors;          /* 网络运行失败次数 */
+    uint32_t last_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t avg_us;          /* 滑动平均 (1/8 权重) */
+    uint32_t ips_x100;        /* 最近统计窗口内的推理次数/秒 x100 */
+    uint32_t frames;          /* AI_Inference_RunFrame 处理的帧数 */
+    uint32_t crops;           /* 其中实际推理的裁切总数 */
+    uint32_t crops_last;      /* 最近一帧推理的裁切数 */
+    uint32_t deadline_miss;   /* 超出 AI_FRAME_BUDGET_US 或因预算放弃裁切的帧数 */
+    uint32_t dropped;         /* Net 任务来不及取走而被丢弃的结果数 */
+    uint32_t hits;            /* 第二级推理中最高分 >= AI_TRACK_CONF 的帧数 */
+    uint32_t cpu_avg_us;      /* 每帧 (含被第一级拒绝的帧) AI 任务耗时的滑动平均 */
+    uint32_t wake_frames;     /* 唤醒级联第一级判定的帧数 */
+    uint32_t wake_pass;       /* 其中判定有目标的帧数 */
+    uint32_t wake_audits;     /* 第一级拒绝但被抽查运行第二级的帧数 */
+    uint32_t wake_misses;     /* 抽查中第二级高置信 (第一级漏检) 的帧数 */
+    uint32_t wake_avg_us;     /* 第一级耗时滑动平均 */
+    uint16_t wake_points_last; /* 最近一帧第一级的变化点数 */
+    uint32_t model_version;   /* 当前权重版本 (0: 出厂权重) */
+    uint32_t model_swaps;     /* 权重换绑次数 (提交后换到新权重、Bank2 擦除时退回出厂权重及恢复) */
+    uint32_t model_swap_us;   /* 最近一次换绑占用 AI 任务的时间 (即推理停顿) */
+    uint32_t model_erase_skips; /* Bank2 擦除且出厂权重无效、无权重可读而跳过推理的帧数 */
+} AiStats_t;
+
+int8_t AI_Inference_Init(void);
+int8_t AI_Inference_Run(const uint8_t *input, AiResult_t *result);
+uint8_t AI_Inference_RunFrame(const uint8_t *input, uint32_t frame_id, uint32_t tick);
+void   AI_Inference_Publish(const AiResult_t *result);
+int8_t AI_Inference_BindWeights(const uint8_t *weights, uint32_t version);
+int8_t AI_Inference_GetNext(AiResult_t *result);
+void   AI_Inference_SetWakeThreshold(uint16_t min_points);
+void   AI_Inference_GetStats(AiStats_t *stats);
+void   AI_Inference_Report(void);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef AI_MEM_H
+#define AI_MEM_H
+
+#include <stdint.h>
+#include "ai_platform.h"
+
+#define AI_MEM_MAX_LAYERS    96   /* >= AI_VEHICLE_DETECTOR_N_NODES */
+
+/* 每个 c-layer 的权重占用与当前位置 */
+typedef struct {
+    uint16_t type;            /* 节点类型 (ai_observer_node.type) */
+    uint8_t  region;          /* 权重当前所在区域 (AI_MEM_xxx) */
+    uint8_t  n_arrays;        /* 权重/偏置数组个数 */
+    uint32_t weight_bytes;    /* 权重 + 偏置字节数 (0 表示无参数层) */
+} AiLayerMem_t;
+
+/* 激活区中推理之间仍在使用的一段 (输入张量、唤醒工作区等) */
+typedef struct {
+    const uint8_t *base;
+    uint32_t size;
+} AiMemSpan_t;
+
+ai_handle AI_Mem_Activations(void);
+void     *AI_Mem_Scratch(const uint8_t *in, uint32_t in_size, uint32_t size);
+void     *AI_Mem_Carve(const AiMemSpan_t *keep, uint8_t n_keep, uint32_t size);
+int8_t    AI_Mem_Scan(ai_handle net);
+uint16_t  AI_Mem_LayerCount(void);
+const AiLayerMem_t *AI_Mem_Layer(uint16_t c_idx);
+uint32_t  AI_Mem_PoolSize(uint8_t region);
+uint32_t  AI_Mem_PlaceWeights(ai_handle net, const uint16_t *layers, uint16_t n, uint8_t region);
+void      AI_Mem_ResetWeights(void);
+void      AI_Mem_ApplyConfig(ai_handle net);
+void      AI_Mem_PrintPlan(void);
+const char *AI_Mem_RegionName(uint8_t region);
+
+#endif
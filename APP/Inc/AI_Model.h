@@ -0,0 +1,57 @@
+#ifndef AI_MODEL_H
+#define AI_MODEL_H
+
+#include <stdint.h>
+#include "ai_platform.h"
+#include "shared_types.h"
+#include "vehicle_detector_data.h"
+
+/*
+ * 多模型注册表：多个 X-CUBE-AI 网络分时共用 AI_Mem 的同一块激活区。各网络串行运行、
+ * 不保留跨次状态，因此激活区只需取所有注册网络中的最大值。
+ * 主模型 (AI_MODEL_VEHICLE) 的输入张量是 Vision 缩略图的直写目标；其他网络输入几何
+ * 相同，运行前从主模型输入张量搬入自己的输入张量，并按各自量化参数重映射。
+ */
+#define AI_MODEL_VEHICLE     0    /* 车型细分 (vehicle_detector)，主模型 */
+#define AI_MODEL_MAX         4
+
+#define AI_MODEL_MAXOF(a, b) (((a) > (b)) ? (a) : (b))
+/* 共享激活区大小：注册新网络时把其 AI_xxx_DATA_ACTIVATIONS_SIZE 以 AI_MODEL_MAXOF 并入 */
+#define AI_MODEL_ARENA_SIZE  AI_VEHICLE_DETECTOR_DATA_ACTIVATIONS_SIZE
+
+/* 一个生成网络的接口与调度参数 (注册表中的常量条目) */
+typedef struct {
+    const char *name;
+    ai_error   (*create_and_init)(ai_handle *net, const ai_handle act[], const ai_handle w[]);
+    ai_buffer *(*inputs_get)(ai_handle net, ai_u16 *n);
+    ai_buffer *(*outputs_get)(ai_handle net, ai_u16 *n);
+    ai_i32     (*run)(ai_handle net, const ai_buffer *in, ai_buffer *out);
+    ai_error   (*get_error)(ai_handle net);
+    ai_bool    (*params_get)(ai_network_params *params);
+    ai_bool    (*init)(ai_handle net, const ai_network_params *params);
+    uint32_t   act_size;      /* 激活区需求 */
+    uint8_t    share;         /* 调度份额：各网络分到的裁切数之比 (0: 停用) */
+} AiModelDesc_t;
+
+/* 各网络运行统计 */
+typedef struct {
+    uint32_t runs;
+    uint32_t errors;
+    uint32_t last_us;
+    uint32_t avg_us;          /* 滑动平均 (1/8 权重)，调度器据此预估耗时 */
+} AiModelStats_t;
+
+int8_t   AI_Model_Init(ai_handle act, const uint8_t *primary_weights);
+uint8_t  AI_Model_Count(void);
+const char *AI_Model_Name(uint8_t id);
+ai_handle AI_Model_Net(uint8_t id);
+uint8_t *AI_Model_Input(uint8_t id);
+const uint8_t *AI_Model_InputLut(uint8_t id);
+const float *AI_Model_Output(uint8_t id);
+int8_t   AI_Model_SetWeights(uint8_t id, const uint8_t *weights);
+int8_t   AI_Model_Pick(void);
+void     AI_Model_SetShare(uint8_t id, uint8_t share);
+int8_t   AI_Model_Run(uint8_t id, AiResult_t *result);
+void     AI_Model_GetStats(uint8_t id, AiModelStats_t *out);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef AI_PROFILER_H
+#define AI_PROFILER_H
+
+#include <stdint.h>
+#include "ai_platform.h"
+
+/* 单个 c-layer 的累计耗时 (DWT 周期) */
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} AiLayerProf_t;
+
+int8_t   AI_Prof_Start(ai_handle net);
+void     AI_Prof_Stop(ai_handle net);
+void     AI_Prof_Reset(void);
+uint32_t AI_Prof_Runs(void);
+uint32_t AI_Prof_LayerAvg(uint16_t c_idx);
+const AiLayerProf_t *AI_Prof_Layer(uint16_t c_idx);
+const char *AI_Prof_LayerName(uint16_t c_idx);
+void     AI_Prof_Dump(void);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef AI_VALIDATE_H
+#define AI_VALIDATE_H
+
+#include <stdint.h>
+#include "shared_types.h"
+#include "app_config.h"
+
+/*
+ * 板上金标验证/基准 (AI_VALIDATE_ENABLE，上位机 Tools/ai_validate.py)，UDP AI_VALIDATE_PORT，小端：
+ *   上位机 -> AiValData_t + 数据 (输入张量按 AI_VAL_CHUNK 分片，任意顺序，可重发)
+ *   上位机 -> AiValRun_t       输入收齐后循环推理 loops 次
+ *   板卡   -> AiValResult_t    输出、周期统计；输入不全时 status = AI_VAL_MISSING 并给出缺失位图
+ * 一次只处理一个向量：上位机收到结果后再发下一个。
+ */
+#define AI_VAL_MAGIC_DATA  0x444C4156U   /* "VALD" */
+#define AI_VAL_MAGIC_RUN   0x524C4156U   /* "VALR" */
+#define AI_VAL_MAGIC_RES   0x534C4156U   /* "VALS" */
+#define AI_VAL_CHUNK       1024
+#define AI_VAL_CHUNKS      ((AI_THUMB_SIZE + AI_VAL_CHUNK - 1) / AI_VAL_CHUNK)
+
+#define AI_VAL_OK          0
+#define AI_VAL_MISSING     1   /* 输入不完整 (missing 为缺失分片位图)，补发后重新 RUN */
+#define AI_VAL_BUSY        2   /* 上一个向量仍在推理 */
+#define AI_VAL_FAILED      3   /* ai_vehicle_detector_run 失败 */
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t vec;             /* 向量号：与上次不同即清空已收分片 */
+    uint16_t chunk;           /* 分片号，数据偏移 = chunk * AI_VAL_CHUNK */
+} AiValData_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t vec;
+    uint16_t loops;           /* 1 ~ AI_VALIDATE_MAX_LOOPS */
+} AiValRun_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t vec;
+    uint8_t  status;          /* AI_VAL_xxx */
+    uint8_t  class_id;
+    uint32_t missing;         /* 缺失分片位图 (status = AI_VAL_MISSING) */
+    uint16_t loops;
+    uint8_t  stable;          /* 各次输出逐位相同 */
+    uint8_t  n_out;
+    uint32_t model_version;   /* 当前权重版本 (0: 出厂权重) */
+    uint32_t cpu_hz;
+    uint32_t cyc_first;       /* 第一次 (冷缓存) */
+    uint32_t cyc_min;
+    uint32_t cyc_max;
+    uint32_t cyc_avg;
+    float    out[AI_NUM_CLASSES];
+} AiValResult_t;
+
+int8_t AI_Validate_Init(void);
+void   AI_Validate_Poll(void);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+#include <stdint.h>
+
+/* 启动里程碑 (时间基准为 HAL_Init 之后的 HAL_GetTick) */
+typedef enum {
+    BOOT_MAIN = 0,      /* 外设初始化完成 */
+    BOOT_SCHED,         /* 调度器启动，第一个任务运行 */
+    BOOT_CAM_READY,     /* 摄像头/DCMI/JPEG 就绪 */
+    BOOT_LINK_UP,       /* PHY 链路建立 */
+    BOOT_IP_READY,      /* 拿到 IP (DHCP 绑定或静态回退) */
+    BOOT_FIRST_JPEG,    /* 第一帧 JPEG 编码完成 */
+    BOOT_FIRST_TX,      /* 第一帧发送成功 */
+    BOOT_MS_COUNT
+} BootMilestone_t;
+
+void     Boot_Mark(BootMilestone_t m);
+uint32_t Boot_GetMark(BootMilestone_t m);
+void     Boot_Timing_Report(const char *addr_src);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef CROP_SCHED_H
+#define CROP_SCHED_H
+
+#include <stdint.h>
+#include "Vision_Roi.h"
+
+/*
+ * 多裁切调度 (不依赖 HAL)：把一帧的运动框扩成采样正方形，按 面积 x 新颖度 排序，
+ * 合并重叠过多的候选，最多给出 limit 个裁切。新颖度 = 1 - 与近期选中裁切的最大 IoU，
+ * 新出现的目标优先于一直停在画面里的目标。
+ */
+#define CROP_HIST_LEN   8     /* 记录最近选中的裁切数 (约 4 帧) */
+#define CROP_MAX_CANDS  8     /* 每帧参与排序的运动框上限，多出的丢弃 (Motion_EndFrame 已按大小排序) */
+
+typedef struct {
+    uint16_t frame_w, frame_h;
+    uint16_t margin_pct;      /* 见 Vision_Roi_Fit */
+    uint16_t min_side;
+    uint16_t merge_iou;       /* Q8，与已选裁切 IoU 超过该值的候选被合并 */
+    uint16_t novelty_gain;    /* 新颖度满分时得分乘以 (1 + gain) */
+} CropSchedCfg_t;
+
+typedef struct {
+    VisionRect_t sq[CROP_HIST_LEN];
+    uint8_t n;
+    uint8_t head;
+} CropSchedHist_t;
+
+uint8_t Crop_Sched_Plan(const CropSchedCfg_t *cfg, CropSchedHist_t *hist,
+                        const VisionRect_t *boxes, uint8_t n_boxes, VisionRect_t *crops, uint8_t *src, uint8_t limit);
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef DEFER_WORK_H
+#define DEFER_WORK_H
+
+#include <stdint.h>
+
+/*
+ * 中断延后处理：中断回调只记录事件 (Defer_Post，无锁多生产者队列)，
+ * 实际工作 (条带处理、启动编码、日志打印) 由高优先级工作任务 (Task_Camera) 按投递顺序执行。
+ * 工作任务优先级高于 AI/Net/tcpip，原先靠关中断与中断互斥的任务代码不需要改动。
+ * 各中断回调的耗时用 DWT 计量 (DEFER_ISR_ENTER / Defer_IsrExit)，周期打印最坏值。
+ */
+#define DEFER_QUEUE_LEN     16    /* 2 的幂 */
+
+typedef void (*DeferFn_t)(uint32_t a, uint32_t b);
+
+/* 计时的中断回调 */
+typedef enum {
+    DEFER_ISR_DMA_HALF = 0,   /* DCMI DMA 半传输 */
+    DEFER_ISR_DMA_FULL,       /* DCMI DMA 传输完成 */
+    DEFER_ISR_JPEG_IN,        /* JPEG 请求下一条带 */
+    DEFER_ISR_JPEG_OUT,       /* JPEG 输出数据 */
+    DEFER_ISR_JPEG_DONE,      /* JPEG 编码完成 */
+    DEFER_ISR_COUNT
+} DeferIsr_t;
+
+typedef struct {
+    uint32_t posted;
+    uint32_t done;
+    uint32_t dropped;                         /* 队列满丢弃的工作 */
+    uint32_t depth_max;                       /* 队列最大深度 */
+    uint32_t wait_max_us;                     /* 投递到开始执行的最大延迟 */
+    uint32_t isr_calls[DEFER_ISR_COUNT];
+    uint32_t isr_max_cyc[DEFER_ISR_COUNT];    /* 各回调最坏耗时 (周期) */
+} DeferStats_t;
+
+#define DEFER_ISR_ENTER()   (DWT->CYCCNT)
+
+int8_t Defer_Init(void);
+int8_t Defer_Post(DeferFn_t fn, uint32_t a, uint32_t b);
+void   Defer_Run(uint32_t timeout_ms);
+void   Defer_IsrExit(DeferIsr_t isr, uint32_t start);
+void   Defer_GetStats(DeferStats_t *out);
+void   Defer_Report(void);
+
+#endif
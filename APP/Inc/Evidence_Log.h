@@ -0,0 +1,63 @@
+#ifndef EVIDENCE_LOG_H
+#define EVIDENCE_LOG_H
+
+#include <stdint.h>
+
+/*
+ * 片上 Flash 证据日志 (不依赖 HAL，主机工具 Tools/evid_sim 直接编译同一份代码)。
+ * 板端 Flash 操作见 Evidence_Flash.c。
+ */
+#define EVID_MAX_SECTORS    8
+#define EVID_ACK_EVERY      8     /* 每上传多少条落一次上传游标 */
+
+/* 记录类型 (与 NetRecType_t 数值保持一致，便于直接转存) */
+typedef enum {
+    EVID_REC_JPEG   = 1,  /* 抓拍 JPEG */
+    EVID_REC_RESULT = 2,  /* 识别/决策记录 */
+    EVID_REC_ACK    = 3   /* 上传游标 (内部使用，负载为已上传的最大序号) */
+} EvidRecType_t;
+
+/* 读出的记录视图：pData 直接指向 Flash 映射地址 */
+typedef struct {
+    EvidRecType_t type;
+    uint32_t seq;
+    uint32_t frame_id;
+    const uint8_t *pData;
+    uint32_t len;
+} EvidRecord_t;
+
+/* Flash 底层操作表：上板为 HAL 实现 (Evidence_Flash.c)，主机仿真为 RAM 后端 */
+typedef struct {
+    const uint8_t *base;                                   /* 日志区起始映射地址 */
+    uint32_t sector_size;
+    uint32_t sector_count;                                 /* 2 ~ EVID_MAX_SECTORS */
+    int8_t   (*erase)(uint32_t sector);                    /* 擦除日志区内第 sector 个扇区 */
+    int8_t   (*program)(uint32_t offset, const uint8_t *src32); /* 写入一个 32 字节 Flash 字 */
+    uint32_t (*crc)(const uint8_t *p, uint32_t len);       /* CRC-32/MPEG-2 */
+} EvidFlashOps_t;
+
+typedef struct {
+    uint32_t mounted;
+    uint32_t next_seq;        /* 下一条记录序号 */
+    uint32_t acked_seq;       /* 已确认上传到的序号 (含) */
+    uint32_t active_sector;
+    uint32_t write_off;       /* 活动扇区内写偏移 */
+    uint32_t appended;        /* 本次上电写入条数 */
+    uint32_t uploaded;        /* 本次上电上传条数 */
+    uint32_t torn_records;    /* 挂载时发现的断电残缺记录 */
+    uint32_t lost_unsent;     /* 扇区回收时被覆盖的未上传记录 */
+    uint32_t write_errors;
+    uint32_t erase_min;       /* 各扇区擦除次数最小/最大值 (磨损监控) */
+    uint32_t erase_max;
+} EvidStats_t;
+
+int8_t Evidence_Log_Mount(const EvidFlashOps_t *ops);
+int8_t Evidence_Log_Append(EvidRecType_t type, const uint8_t *pData, uint32_t len, uint32_t frame_id);
+int8_t Evidence_Log_PeekUnsent(EvidRecord_t *rec);
+void   Evidence_Log_MarkSent(uint32_t seq);
+void   Evidence_Log_GetStats(EvidStats_t *stats);
+
+/* 板端片上 Flash 操作表 (Evidence_Flash.c) */
+const EvidFlashOps_t *Evidence_Flash_Ops(void);
+
+#endif
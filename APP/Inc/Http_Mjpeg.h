@@ -0,0 +1,19 @@
+#ifndef HTTP_MJPEG_H
+#define HTTP_MJPEG_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t viewers;         /* 当前观看者数 */
+    uint32_t accepted;
+    uint32_t rejected;        /* 超过 HTTP_MAX_VIEWERS 被拒绝的连接 */
+    uint32_t frames_sent;     /* 所有观看者累计送达的帧数 */
+    uint32_t bytes_sent;
+    uint32_t stalls;          /* 因持有帧超时被断开的观看者 */
+} HttpMjpegStats_t;
+
+int8_t Http_Mjpeg_Init(void);
+void   Http_Mjpeg_Publish(void);
+void   Http_Mjpeg_GetStats(HttpMjpegStats_t *stats);
+
+#endif
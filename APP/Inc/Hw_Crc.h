@@ -0,0 +1,14 @@
+#ifndef HW_CRC_H
+#define HW_CRC_H
+
+#include <stdint.h>
+
+/*
+ * 硬件 CRC 单元 (CRC-32/MPEG-2，字节输入) 的共享入口。证据日志 (Net 任务)、权重区校验
+ * (AI 任务挂载 / Net 任务提交) 与租约缓存共用同一个 hcrc，一次计算要先写 INIT 再连续喂数据，
+ * 被另一任务的计算插入就会算错，因此统一经互斥量串行化。调度器启动前直接计算。
+ */
+void     Hw_Crc_Init(void);
+uint32_t Hw_Crc_Calc(const void *p, uint32_t len);
+
+#endif
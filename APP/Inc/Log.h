@@ -0,0 +1,72 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "app_config.h"
+
+/*
+ * 非阻塞串口日志：所有输出 (printf 经 _write，以及 LOG_x) 写入多生产者无锁环形缓冲，
+ * Task_Log 把已提交的记录拷进 DMA 发送缓冲经 USART3 发出。缓冲满时丢弃并计数，调用方从不等串口。
+ * LOG_x 高于 LOG_LEVEL 时编译时去掉。LOG_BINARY=1 时 LOG_x 不做格式化，只写二进制记录：
+ *   0xA5 | 级别<<4 | 参数个数 | 格式串编号 (2B) | HAL_GetTick (4B) | 参数 (各 4B) | 异或校验
+ * 格式串放在不占 Flash 的 .log_fmt 段 (链接脚本 INFO 段)，其段内偏移即编号，
+ * 上位机 Tools/log_decode.py 从 ELF 读出格式串还原文本，与 printf 文本混合输出互不干扰。
+ * 二进制模式下参数一律按 32 位整数传递：不支持 %s、%f，也不要传 64 位值。
+ */
+#define LOG_LVL_ERROR   1
+#define LOG_LVL_WARN    2
+#define LOG_LVL_INFO    3
+#define LOG_LVL_DEBUG   4
+
+#define LOG_SYNC        0xA5U
+#define LOG_MAX_ARGS    8
+
+typedef struct {
+    uint32_t records;         /* 写入的记录数 */
+    uint32_t bytes;           /* 发出的字节数 */
+    uint32_t dropped;         /* 缓冲满丢弃的记录数 */
+    uint32_t high_water;      /* 缓冲最高占用 (字节) */
+} LogStats_t;
+
+void Log_Write(const char *ptr, uint32_t len);
+void Log_Binary(uint8_t level, const char *fmt, const uint32_t *args, uint8_t nargs);
+void Log_Task(void *argument);
+void Log_TxDone(void);
+void Log_GetStats(LogStats_t *out);
+
+#if LOG_BINARY
+#define LOG_EMIT(lvl, fmt, ...) do {                                                   \
+        static const char log_fmt_[] __attribute__((section(".log_fmt"), used)) = fmt; \
+        const uint32_t log_args_[] = { 0, ##__VA_ARGS__ };                             \
+        _Static_assert(sizeof(log_args_) / 4U - 1U <= LOG_MAX_ARGS, "too many log args"); \
+        Log_Binary(lvl, log_fmt_, &log_args_[1], sizeof(log_args_) / 4U - 1U);         \
+    } while (0)
+#else
+#define LOG_EMIT(lvl, fmt, ...) printf(fmt, ##__VA_ARGS__)
+#endif
+
+#define LOG_NONE(...)   do { } while (0)
+
+#if LOG_LEVEL >= LOG_LVL_ERROR
+#define LOG_E(fmt, ...) LOG_EMIT(LOG_LVL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_E(...)      LOG_NONE()
+#endif
+#if LOG_LEVEL >= LOG_LVL_WARN
+#define LOG_W(fmt, ...) LOG_EMIT(LOG_LVL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_W(...)      LOG_NONE()
+#endif
+#if LOG_LEVEL >= LOG_LVL_INFO
+#define LOG_I(fmt, ...) LOG_EMIT(LOG_LVL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_I(...)      LOG_NONE()
+#endif
+#if LOG_LEVEL >= LOG_LVL_DEBUG
+#define LOG_D(fmt, ...) LOG_EMIT(LOG_LVL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_D(...)      LOG_NONE()
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef MEM_OVERLAY_H
+#define MEM_OVERLAY_H
+
+#include <stdint.h>
+
+/*
+ * 分阶段内存覆盖：所有者 (AI 任务) 空闲时把自己的内存块借给其他模块 (JPEG 编码输出)，
+ * 下次使用前收回。阶段：
+ *   OWNER   所有者使用中，不外借
+ *   LEND    所有者空闲，借用方可 Acquire
+ *   RECLAIM 所有者请求收回：不再借出，已借出的块由借用方用完后归还
+ * 借用凭证带代数，归还/收回后旧凭证失效，Mem_Overlay_Ptr 返回 NULL 并计入 stale。
+ */
+#define OVERLAY_MAX_BLOCKS     2
+#define OVERLAY_GUARD          32   /* 每块首尾保护带字节数 (32 字节对齐，便于 D-Cache 维护) */
+
+#define OVERLAY_PHASE_OWNER    0
+#define OVERLAY_PHASE_LEND     1
+#define OVERLAY_PHASE_RECLAIM  2
+
+typedef uint32_t OverlayLease_t;      /* (代数 << 8) | 块号；0 为无效凭证 */
+typedef void (*OverlayYield_t)(void); /* 收回请求：借用方空闲时应立即 Release */
+
+typedef struct {
+    uint32_t lends;           /* 进入 LEND 阶段的次数 */
+    uint32_t acquires;
+    uint32_t reclaims;        /* 成功收回次数 */
+    uint32_t reclaim_waits;   /* 其中需要等待借用方归还的次数 */
+    uint32_t timeouts;        /* 收回超时次数 (所有者放弃本次使用) */
+    uint32_t max_wait_ms;
+    uint32_t stale;           /* 使用已失效凭证的次数 (归还/收回后仍访问) */
+    uint32_t guard_errors;    /* 归还时保护带被改写 (越界写) */
+    uint32_t poison_errors;   /* 归还后到收回前内容被改写 (归还后仍写入) */
+    uint8_t  phase;
+    uint8_t  lent;            /* 当前借出的块数 */
+} OverlayStats_t;
+
+int8_t   Mem_Overlay_AddBlock(uint8_t *base, uint32_t size);
+void     Mem_Overlay_Lend(void);
+int8_t   Mem_Overlay_Reclaim(uint32_t timeout_ms);
+uint8_t  Mem_Overlay_Reclaiming(void);
+OverlayLease_t Mem_Overlay_Acquire(uint32_t size, OverlayYield_t yield);
+uint8_t *Mem_Overlay_Ptr(OverlayLease_t lease);
+void     Mem_Overlay_Release(OverlayLease_t lease);
+void     Mem_Overlay_GetStats(OverlayStats_t *out);
+
+#endif
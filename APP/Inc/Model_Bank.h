@@ -0,0 +1,88 @@
+#ifndef MODEL_BANK_H
+#define MODEL_BANK_H
+
+#include <stdint.h>
+
+/*
+ * 模型权重区 (不依赖 HAL，主机工具 Tools/model_ota_sim 直接编译同一份代码)。
+ * 每个区: [blob 头 32B][提交字 32B][权重 ...]，按 Flash 字 (32B) 编程。
+ * A 区是随固件链接的出厂权重，与程序同在 Bank1，运行中从不擦写；远程更新只写 B 区 (Bank2)，
+ * 整段 CRC 校验通过后先写头、最后写提交字。挂载时 B 区提交有效即为活动区，否则用 A 区；
+ * 提交字写完前断线/断电，B 区被忽略，回到出厂权重。
+ * blob 只含权重：必须与当前固件中生成的网络代码 (图结构与量化参数) 配套，signature 用于拒收不匹配的网络。
+ * 有效签名 = CRC(网络结构签名 LE32 + 出厂权重 CRC LE32)：换了出厂模型的固件烧录后，旧固件下发的 blob
+ * 签名不符而失效。
+ *
+ * 扇区擦除是异步的：写到未擦除的扇区时 Model_Bank_Write 启动擦除并停止消费数据，由调用方周期性
+ * 调用 Model_Bank_Poll 推进，擦完后继续写。B 区与证据日志同在 Bank2，擦除期间读 B 区会挂起总线：
+ * 读权重的一方每次推理前用 Model_Bank_ReadBegin 取本次要用的权重，Bank2 有擦除 (含再次更新 B 区)
+ * 时拿到 A 区出厂权重，推理不停；擦除只在没有读者持有 B 区时启动 (证据日志经 EraseBegin/EraseEnd)。
+ */
+#define MODEL_SLOTS         2
+#define MODEL_SLOT_BUILTIN  0U                  /* A 区：出厂权重，只读 */
+#define MODEL_SLOT_OTA      1U                  /* B 区：远程更新目标 */
+#define MODEL_FW_SIZE       32U                 /* Flash 字 */
+#define MODEL_DATA_OFFSET   (2U * MODEL_FW_SIZE)
+#define MODEL_MAGIC         0x314C444DUL        /* "MDL1" */
+#define MODEL_COMMIT_MAGIC  0x4B4F444DUL        /* "MDOK" */
+#define MODEL_F_BUILTIN     0x01U               /* 随固件链接的出厂权重：不带 CRC，按地址认定 */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;         /* 模型版本 (下发方编号，用于上报与续传匹配) */
+    uint32_t size;            /* 权重字节数 */
+    uint32_t crc;             /* 权重 CRC-32/MPEG-2 (与硬件 CRC 单元默认配置一致) */
+    uint32_t signature;       /* 网络结构签名，见 Model_Ota.c */
+    uint32_t flags;
+    uint32_t reserved;
+    uint32_t hdr_crc;         /* 前 28 字节的 CRC */
+} ModelBlobHdr_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t generation;      /* 每次提交 +1 */
+    uint32_t pad[6];
+} ModelCommit_t;
+
+/* Flash 底层操作表：上板为 HAL 实现 (Model_Ota.c)，主机仿真为 RAM 后端 */
+typedef struct {
+    const uint8_t *base[MODEL_SLOTS];                              /* 各区映射地址 */
+    uint32_t slot_size;
+    uint32_t sector_size;
+    int8_t   (*erase_start)(uint8_t slot, uint32_t sector);         /* 启动擦除区内第 sector 个扇区，不等待 */
+    int8_t   (*erase_poll)(void);                                   /* 1: 擦除中; 0: 完成; -1: 失败 */
+    int8_t   (*program)(uint8_t slot, uint32_t offset, const uint8_t *src32); /* 写入一个 Flash 字 */
+    uint32_t (*crc)(const uint8_t *p, uint32_t len);
+} ModelFlashOps_t;
+
+typedef struct {
+    uint32_t mounted;
+    uint32_t active;          /* 活动区 (B 区被重写期间为 A 区) */
+    uint32_t version;         /* 活动区模型版本 */
+    uint32_t generation;      /* B 区累计提交次数 (A 区为 0) */
+    uint32_t receiving;       /* 1: B 区有未完成的接收会话 */
+    uint32_t rx_version;
+    uint32_t rx_done;         /* 已写入 Flash 的字节数 (断线续传点，Flash 字对齐) */
+    uint32_t rx_size;
+    uint32_t updates;         /* 成功提交次数 */
+    uint32_t resumes;         /* 断线续传次数 */
+    uint32_t rejected;        /* 头/签名/CRC 校验失败 */
+    uint32_t write_errors;
+    uint32_t erases;          /* 已完成的扇区擦除次数 */
+    uint32_t fallback_reads;  /* ReadBegin 因 Bank2 擦除改用出厂权重的次数 */
+} ModelBankStats_t;
+
+int8_t   Model_Bank_Mount(const ModelFlashOps_t *ops, uint32_t net_sig, const uint8_t *builtin, uint32_t builtin_size);
+uint32_t Model_Bank_Signature(void);
+const uint8_t *Model_Bank_Weights(uint32_t *version);
+int8_t   Model_Bank_Begin(const ModelBlobHdr_t *hdr, uint32_t *resume);
+int8_t   Model_Bank_Write(const uint8_t *data, uint32_t len, uint32_t *used);
+int8_t   Model_Bank_Poll(void);
+int8_t   Model_Bank_Finish(void);
+const uint8_t *Model_Bank_ReadBegin(uint32_t *version);
+void     Model_Bank_ReadEnd(void);
+int8_t   Model_Bank_EraseBegin(void);
+void     Model_Bank_EraseEnd(void);
+void     Model_Bank_GetStats(ModelBankStats_t *stats);
+
+#endif
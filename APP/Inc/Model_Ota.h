@@ -0,0 +1,20 @@
+#ifndef MODEL_OTA_H
+#define MODEL_OTA_H
+
+#include <stdint.h>
+
+/*
+ * 模型权重远程更新 (PRD 5.3)：Model_Bank 的片上 Flash/硬件 CRC 后端，以及
+ * MODEL_OTA_PORT 上的 TCP 接收端。协议 (见 Tools/model_push.py)：
+ *   客户端 -> 32B ModelBlobHdr_t
+ *   板卡   -> "RESUME <偏移>\n" 或 "ERR <原因>\n"
+ *   客户端 -> 从该偏移起的权重数据
+ *   板卡   -> "OK <版本>\n" 或 "ERR <原因>\n"，随后关闭连接
+ * 断线后以相同的头重连即续传；提交后 AI 任务在两帧之间切换权重，无需复位。
+ */
+
+const uint8_t *Model_Ota_Mount(uint32_t *version);
+int8_t Model_Ota_Init(void);
+void   Model_Ota_Poll(void);
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef MOTION_DETECT_H
+#define MOTION_DETECT_H
+
+#include <stdint.h>
+#include "Vision_Roi.h"
+
+/*
+ * 条带级运动检测：每个条带即一行 MOTION_CELL 像素高的网格，
+ * 每格抽 4 个像素的亮度与慢速更新的背景比较，运动格按连通关系聚成运动块，
+ * 帧末输出各块的外接框 (多车/人车同框时各自成块)。
+ */
+void    Motion_AddStrip(const uint8_t *strip, uint16_t strip_idx);
+uint8_t Motion_EndFrame(VisionRect_t *boxes, uint8_t max);
+uint16_t Motion_LastCells(void);
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef NET_AUTH_H
+#define NET_AUTH_H
+
+#include <stdint.h>
+
+/*
+ * 控制报文认证：HMAC-SHA256，预共享密钥为 app_config.h 的 NET_AUTH_KEY。
+ * 订阅包 (改变上报目标) 与策略规则表热加载都在报文末尾带 32 字节标签，
+ * 校验通过才处理；CRC 只防损坏，不防伪造。不依赖 HAL，上位机用 Python hmac 计算同一标签。
+ */
+#define NET_AUTH_TAG_LEN    32U
+
+void   Net_Auth_Tag(const uint8_t *msg, uint32_t len, uint8_t tag[NET_AUTH_TAG_LEN]);
+int8_t Net_Auth_Verify(const uint8_t *msg, uint32_t len, const uint8_t *tag);
+
+#endif
@@ -3,26 +3,85 @@
 
 #include <stdint.h>
 #include "lwip/udp.h"
+#include "app_config.h"
 
 typedef enum {
     NET_IDLE = 0,
-    NET_WAIT_LINK,
+    NET_WAIT_LINK,             /* 链路、地址或订阅者未就绪：记录只进断网缓存 */
     NET_READY,
     NET_SENDING,
     NET_ERROR
 } NetState_t;
 
+/* 本机地址来源 */
+typedef enum {
+    NET_ADDR_NONE = 0,
+    NET_ADDR_DHCP_CACHED,  /* 复用缓存租约 (INIT-REBOOT) */
+    NET_ADDR_DHCP,         /* 完整 DHCP 交互 */
+    NET_ADDR_STATIC        /* DHCP 超时后回退的静态地址 */
+} NetAddrSrc_t;
+
 typedef struct {
     struct udp_pcb *upcb;
     ip_addr_t dest_addr;
     NetState_t state;
     uint32_t tx_frame_count;
     uint32_t last_error_code;
+    volatile uint8_t link_up;  /* 由 lwIP 链路回调 (EthLink 线程) 更新 */
+    uint32_t last_drain_tick;
+    NetAddrSrc_t addr_src;     /* NET_ADDR_NONE 表示尚未拿到地址 */
+    uint8_t lease_cached;      /* 开机时备份 SRAM 中有有效租约 */
+    uint8_t arp_static;        /* 当前目标使用缓存 MAC 的静态 ARP 表项 */
+    uint8_t dest_mac_saved;    /* 当前目标的 MAC 已写入租约缓存 */
+    uint32_t addr_wait_tick;   /* 开始等待 DHCP 的时刻 */
+    uint32_t arp_static_tick;
 } NetCtrl_t;
 
+/*
+ * Net 任务的事件队列 (Q_Net_Handle，freertos.c 创建)：Net 任务阻塞在队列上，
+ * 只在事件到达或周期维护节拍 (NET_POLL_INTERVAL_MS) 时醒来。
+ *   NET_EVT_JPEG    JPEG 编码完成中断投递，frame 为已持有一个引用的 VisionFrame_t，处理后须释放
+ *   NET_EVT_RESULT  AI 任务发布结果且没有未处理的结果事件时投递，收到后取空结果队列
+ *                   (取到空时才允许投递下一条，见 AI_Inference_Publish/GetNext)
+ * 每个输出槽 (含借来的槽) 同时最多一条 JPEG 事件，结果事件最多一条，队列不会满；
+ * 投递失败仍计数 (Net_Client_NoteEvtDrop)，非零说明上述约束被破坏。
+ */
+/*
+ * 订阅包 (发往 UDP_LOCAL_PORT，小端)：
+ *   [magic "SUB1" 4B][计数 4B][目标 IPv4 4B，网络字节序，0 表示本包源地址][HMAC-SHA256 32B]
+ * 计数必须大于上次接受的值 (上位机用 Unix 时间)，防止抓包重放把目标改回旧主机或改到别处。
+ */
+#define NET_SUB_MAGIC       0x31425553UL  /* "SUB1" */
+#define NET_SUB_LEN         (12U + 32U)
+
+#define NET_EVT_JPEG        1
+#define NET_EVT_RESULT      2
+#define NET_EVT_QUEUE_LEN   (JPEG_OUT_SLOTS + JPEG_LEND_SLOTS + 1)
+
+typedef struct {
+    uint8_t  type;            /* NET_EVT_xxx */
+    void    *frame;
+    uint32_t stamp;           /* 投递时的 DWT->CYCCNT，用于统计中断到开始发送的延迟 */
+} NetEvent_t;
+
+/* JPEG 完成中断到 Net 任务开始发送的延迟 (每个统计窗口打印后清零) */
+typedef struct {
+    uint32_t frames;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+} NetHandoffStats_t;
+
 int8_t Net_Client_Init(void);
 void Net_Client_SendImage(uint8_t *pData, uint32_t len, uint32_t frame_id);
+void Net_Client_StoreImage(const uint8_t *pData, uint32_t len, uint32_t frame_id);
+void Net_Client_SendResult(const uint8_t *pData, uint32_t len, uint32_t frame_id);
+void Net_Client_Poll(void);
+void Net_Client_LinkChanged(uint8_t up);
 void Net_Client_Diagnostic(void);
+void Net_Client_NoteHandoff(uint32_t stamp);
+void Net_Client_NoteEvtDrop(void);
+int8_t Net_Client_SendTelemetry(const uint8_t *pData, uint32_t len);
 
 extern NetCtrl_t g_net_ctrl;
 
@@ -0,0 +1,29 @@
+#ifndef NET_LEASE_H
+#define NET_LEASE_H
+
+#include <stdint.h>
+
+/*
+ * 跨复位保存的网络参数 (放在 D3 备份 SRAM，软复位/看门狗复位后仍然有效)。
+ * 地址字段与 ip4_addr_t.addr 相同，均为网络字节序。
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t ip;              /* 上次 DHCP 租约 */
+    uint32_t netmask;
+    uint32_t gw;
+    uint32_t dest_ip;         /* 订阅的上报目标 (0 表示尚无订阅者，只存不发) */
+    uint32_t sub_counter;     /* 最近一次接受的订阅包计数，更小或相等的订阅包视为重放 */
+    uint32_t arp_ip;          /* 下一跳地址：目标在本子网时为目标本身，否则为网关 */
+    uint8_t  arp_mac[6];      /* 下一跳 MAC，用于开机免 ARP */
+    uint8_t  arp_valid;
+    uint8_t  reserved;
+    uint32_t crc;
+} NetLease_t;
+
+void   Net_Lease_Init(void);
+int8_t Net_Lease_Load(NetLease_t *lease);
+void   Net_Lease_Save(NetLease_t *lease);
+void   Net_Lease_Clear(void);
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef NET_STORE_H
+#define NET_STORE_H
+
+#include <stdint.h>
+
+/* 缓存记录类型 */
+typedef enum {
+    NET_REC_JPEG = 1,   /* 编码后的整帧 JPEG */
+    NET_REC_RESULT      /* 识别结果/决策记录 */
+} NetRecType_t;
+
+/* 出队时返回的记录视图 (直接指向缓存池，零拷贝) */
+typedef struct {
+    NetRecType_t type;
+    uint32_t frame_id;
+    uint32_t tick;      /* 入队时刻 (HAL_GetTick) */
+    uint32_t offset;    /* pData 在原记录中的偏移 (实时发送中途失败时只缓存未发出的部分) */
+    uint8_t *pData;     /* 尚未发出的部分 */
+    uint32_t len;
+} NetRecord_t;
+
+/* 对外暴露的缓存指标 */
+typedef struct {
+    uint32_t capacity;        /* 缓存池字节数 */
+    uint32_t used_bytes;      /* 当前占用 (含记录头) */
+    uint32_t records;         /* 当前记录条数 */
+    uint32_t high_water;      /* 历史最高占用字节 */
+    uint32_t pushed;          /* 累计入队条数 */
+    uint32_t dropped_oldest;  /* 因池满被挤出的最旧记录数 */
+    uint32_t rejected;        /* 单条超过池容量而被拒绝的记录数 */
+    uint32_t drained;         /* 链路恢复后累计补发条数 */
+    uint32_t partial;         /* 只缓存了未发出尾部的记录数 */
+    uint32_t drain_ms_last;   /* 上一次完整补发耗时 (ms) */
+} NetStoreStats_t;
+
+/* 池满挤出最旧记录前的回调 (可用于转存到 Flash)，rec 仅在回调内有效 */
+typedef void (*NetStoreEvictHook_t)(const NetRecord_t *rec);
+
+void    Net_Store_Init(void);
+int8_t  Net_Store_Push(NetRecType_t type, const uint8_t *pData, uint32_t len, uint32_t offset, uint32_t frame_id);
+int8_t  Net_Store_Peek(NetRecord_t *rec);
+void    Net_Store_Advance(uint32_t n);
+void    Net_Store_Pop(void);
+uint32_t Net_Store_Count(void);
+void    Net_Store_MarkDrainStart(void);
+void    Net_Store_MarkDrainDone(void);
+void    Net_Store_GetStats(NetStoreStats_t *stats);
+void    Net_Store_SetEvictHook(NetStoreEvictHook_t hook);
+
+#endif
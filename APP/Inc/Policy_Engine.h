@@ -0,0 +1,92 @@
+#ifndef POLICY_ENGINE_H
+#define POLICY_ENGINE_H
+
+#include <stdint.h>
+#include "shared_types.h"
+
+/*
+ * 本地策略引擎 (PRD 第 4 节业务规则)：规则表把 15 个输出类别映射为拦截/放行动作与
+ * JT/T 489 计费车型。高置信结果在本地直接判定 (微秒级)，低于阈值的"存疑"结果
+ * 在线时上交云端、断网时按断网策略处理。规则表可经 UDP 热加载 (见 Tools/policy_push.py)，
+ * 并保存在备份 SRAM 中跨复位保留。
+ */
+#define POLICY_MAGIC            0x314C4F50UL  /* "POL1" */
+
+/* 动作 */
+#define POLICY_ACT_NONE         0   /* 无目标 (背景类)，不动作 */
+#define POLICY_ACT_PASS         1   /* 放行 (抬杆) */
+#define POLICY_ACT_BLOCK        2   /* 拦截：锁定道闸 + 声光报警 */
+#define POLICY_ACT_ESCALATE     3   /* 存疑，上交云端/人工 (仅作为判定输出) */
+#define POLICY_ACT_PENDING      4   /* 轨迹仍在积累投票，尚未判定 (仅作为判定输出) */
+
+/* 判定依据 */
+#define POLICY_WHY_RULE         0   /* 置信度达到阈值，按规则表 */
+#define POLICY_WHY_LOW_CONF     1   /* 低于阈值，在线上交 */
+#define POLICY_WHY_OFFLINE      2   /* 低于阈值且断网，按断网策略 */
+#define POLICY_WHY_TRACKING     3
+
+/* 表标志 (对应 PRD 可配置项) */
+#define POLICY_F_MOTO_ALLOW     0x01  /* 摩托车策略：放行 (默认拦截) */
+#define POLICY_F_PICKUP_CAR     0x02  /* 皮卡策略：按客车计费 (默认货车) */
+#define POLICY_F_OFFLINE_LOCK   0x04  /* 断网策略：封锁 (默认降级通行) */
+
+/* 拦截时 LED 显示的违规类型 */
+#define POLICY_ALARM_NONE       0
+#define POLICY_ALARM_PERSON     1
+#define POLICY_ALARM_NONMOTOR   2
+#define POLICY_ALARM_MOTORCYCLE 3
+#define POLICY_ALARM_AGRI       4
+
+typedef struct __attribute__((packed)) {
+    uint8_t action;           /* POLICY_ACT_NONE / PASS / BLOCK */
+    uint8_t bill;             /* 计费车型：0x11~0x14 客1~4，0x21~0x26 货1~6，0 不计费 */
+    uint8_t alarm;            /* POLICY_ALARM_xxx */
+    uint8_t reserved;
+} PolicyRule_t;
+
+/* 规则表 (小端，按字节打包，即 UDP 热加载的负载格式) */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;         /* 表版本号，随判定结果上报 */
+    uint8_t  n_classes;       /* 必须等于 AI_NUM_CLASSES */
+    uint8_t  flags;           /* POLICY_F_xxx */
+    uint8_t  conf_pct;        /* 置信度阈值 50~99 (%) */
+    uint8_t  moto_class;      /* 摩托车策略作用的类别 */
+    uint8_t  pickup_class;    /* 皮卡策略作用的类别 */
+    uint8_t  pickup_car_bill; /* 皮卡按客车时的计费车型 */
+    PolicyRule_t rules[AI_NUM_CLASSES];
+    uint32_t crc;             /* 之前所有字节的 CRC-32 (IEEE 802.3) */
+} PolicyTable_t;
+
+/*
+ * 热加载报文：规则表后跟 32 字节 HMAC-SHA256 标签 (Net_Auth.h)。
+ * 版本号必须大于当前生效的表，旧表重放会被拒绝。
+ */
+#define POLICY_MSG_LEN  (sizeof(PolicyTable_t) + 32U)
+
+typedef struct {
+    uint8_t  action;          /* POLICY_ACT_xxx */
+    uint8_t  bill;
+    uint8_t  alarm;
+    uint8_t  why;             /* POLICY_WHY_xxx */
+    uint16_t version;         /* 判定所用表版本 */
+} PolicyDecision_t;
+
+typedef struct {
+    uint32_t local;           /* 本地按规则判定 */
+    uint32_t escalated;       /* 存疑上交 */
+    uint32_t offline;         /* 存疑且断网，按断网策略 */
+    uint32_t max_cycles;      /* 单次判定最长耗时 (DWT 周期) */
+    uint32_t reloads;         /* 热加载成功次数 */
+    uint32_t rejected;        /* 认证/校验失败或版本未递增被拒绝的规则表 */
+} PolicyStats_t;
+
+void   Policy_Init(void);
+void   Policy_Decide(uint8_t class_id, float conf, PolicyDecision_t *out);
+void   Policy_SetOnline(uint8_t online);
+int8_t Policy_Submit(const uint8_t *data, uint32_t len);
+void   Policy_Poll(void);
+const PolicyTable_t *Policy_Active(void);
+void   Policy_GetStats(PolicyStats_t *stats);
+
+#endif
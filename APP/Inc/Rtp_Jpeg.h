@@ -0,0 +1,32 @@
+#ifndef RTP_JPEG_H
+#define RTP_JPEG_H
+
+#include <stdint.h>
+
+/* 从硬件编码器输出的 JFIF 中解析出的 RFC 2435 字段 */
+typedef struct {
+    uint8_t  type;            /* 0: 4:2:2, 1: 4:2:0 */
+    uint8_t  width8;          /* 宽度 / 8 */
+    uint8_t  height8;         /* 高度 / 8 */
+    uint8_t  qt_count;        /* 量化表个数 (1 或 2) */
+    const uint8_t *qt[2];     /* 指向 DQT 段内 64 字节表 (zig-zag 顺序) */
+    const uint8_t *scan;      /* 熵编码数据起点 (SOS 段之后) */
+    uint32_t scan_len;        /* 不含 EOI */
+} RtpJpegInfo_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t packets;
+    uint32_t octets;          /* RTP 负载字节数 (RTCP SR 使用) */
+    uint32_t parse_errors;
+    uint32_t send_errors;
+    uint32_t sr_sent;
+} RtpJpegStats_t;
+
+int8_t Rtp_Jpeg_Init(void);
+int8_t Rtp_Jpeg_Parse(const uint8_t *jpg, uint32_t len, RtpJpegInfo_t *info);
+int8_t Rtp_Jpeg_SendFrame(const uint8_t *jpg, uint32_t len, uint32_t capture_tick);
+void   Rtp_Jpeg_Poll(void);
+void   Rtp_Jpeg_GetStats(RtpJpegStats_t *stats);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef SYS_STATS_H
+#define SYS_STATS_H
+
+#include <stdint.h>
+#include "shared_types.h"
+
+/*
+ * 任务级运行统计：configGENERATE_RUN_TIME_STATS 以 DWT->CYCCNT (CPU 周期) 为时基，
+ * Net 任务每 SYS_STATS_INTERVAL_MS 取一次 uxTaskGetSystemState 快照，与上次快照求差得到
+ * 各任务本窗口的 CPU 占用，连同栈历史最小剩余、堆剩余打包成 TelemRecord_t 发给上位机。
+ * CYCCNT 在 480 MHz 下约 8.9 s 回绕，窗口须小于该值 (差值用无符号减法)。
+ */
+
+void   Sys_Stats_Init(void);
+void   Sys_Stats_Poll(void);
+const TelemRecord_t *Sys_Stats_GetLast(void);
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include "app_config.h"
+
+/*
+ * 流水线追踪：中断进出、任务切换 (FreeRTOS traceTASK_SWITCHED_IN)、流水线阶段起止、队列深度
+ * 以 8 字节事件记入环形缓冲 (时间戳为 DWT->CYCCNT)，Net 任务成批经 UDP 发往当前上报目标的
+ * TRACE_PORT。上位机 Tools/trace_view 把事件流转成 Chrome trace / Perfetto JSON。
+ * 记录一条事件只关中断十几个周期；缓冲满时丢弃并计数 (包头带累计丢弃数，时间线上标出缺口)。
+ * TRACE_ENABLE=0 时所有 TRACE_x 宏为空，不占任何开销。
+ * 下面的各编号表须与 Tools/trace_view/trace_view.cpp 保持一致。
+ */
+
+/* 事件类型 */
+#define TRACE_EV_TASK_IN      1   /* id = 任务号 (uxTCBNumber) */
+#define TRACE_EV_ISR_ENTER    2   /* id = TRACE_ISR_xxx */
+#define TRACE_EV_ISR_EXIT     3
+#define TRACE_EV_BEGIN        4   /* id = TRACE_STAGE_xxx, arg = 帧号低 16 位等 */
+#define TRACE_EV_END          5
+#define TRACE_EV_COUNTER      6   /* id = TRACE_CNT_xxx, arg = 当前值 */
+
+/* 中断 */
+#define TRACE_ISR_DCMI_DMA    0   /* DMA2_Stream0：DCMI 条带 */
+#define TRACE_ISR_DCMI        1
+#define TRACE_ISR_JPEG        2
+#define TRACE_ISR_JPEG_MDMA   3
+#define TRACE_ISR_ETH         4   /* ETH DMA 收发 */
+#define TRACE_ISR_DMA2D       5
+#define TRACE_ISR_UART        6   /* USART3 */
+#define TRACE_ISR_UART_DMA    7   /* DMA1_Stream0：日志发送 */
+
+/* 流水线阶段 */
+#define TRACE_STAGE_STRIP     0   /* 条带处理 (缩略图/运动检测) */
+#define TRACE_STAGE_ENCODE    1   /* JPEG 编码：启动到完成中断 */
+#define TRACE_STAGE_AI_FRAME  2   /* 一帧推理 (含唤醒判断与全部裁切) */
+#define TRACE_STAGE_AI_MODEL  3   /* 单次网络推理 */
+#define TRACE_STAGE_NET_JPEG  4   /* Net 任务发送一帧 JPEG (UDP + RTP) */
+#define TRACE_STAGE_NET_RESULT 5  /* Net 任务发送推理结果 */
+
+/* 计数器 */
+#define TRACE_CNT_DEFER       0   /* 延后工作队列深度 */
+#define TRACE_CNT_NET_QUEUE   1   /* Net 事件队列剩余 */
+#define TRACE_CNT_NET_STORE   2   /* 断网缓存记录数 */
+
+typedef struct {
+    uint32_t ts;              /* DWT->CYCCNT */
+    uint8_t  type;            /* TRACE_EV_xxx */
+    uint8_t  id;
+    uint16_t arg;
+} TraceEvent_t;
+
+/* UDP 包头 (小端)，其后为 count 条 TraceEvent_t 或 TraceTaskName_t */
+#define TRACE_MAGIC           0x45435254UL  /* "TRCE" */
+#define TRACE_PKT_EVENTS      0
+#define TRACE_PKT_TASKS       1
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t cpu_hz;          /* 时间戳频率 */
+    uint32_t dropped;         /* 累计因缓冲满丢弃的事件数 */
+    uint16_t kind;            /* TRACE_PKT_xxx */
+    uint16_t count;
+} TracePktHdr_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t num;             /* 任务号，对应 TRACE_EV_TASK_IN 的 id */
+    char     name[16];
+} TraceTaskName_t;
+
+void   Trace_Event(uint8_t type, uint8_t id, uint16_t arg);
+int8_t Trace_Init(void);
+void   Trace_Poll(void);
+
+#if TRACE_ENABLE
+#define TRACE_ISR_ENTER(isr)        Trace_Event(TRACE_EV_ISR_ENTER, (isr), 0)
+#define TRACE_ISR_EXIT(isr)         Trace_Event(TRACE_EV_ISR_EXIT, (isr), 0)
+#define TRACE_BEGIN(stage, arg)     Trace_Event(TRACE_EV_BEGIN, (stage), (uint16_t)(arg))
+#define TRACE_END(stage, arg)       Trace_Event(TRACE_EV_END, (stage), (uint16_t)(arg))
+#define TRACE_COUNTER(cnt, val)     Trace_Event(TRACE_EV_COUNTER, (cnt), (uint16_t)(val))
+/* FreeRTOSConfig.h 包含本文件，在 tasks.c 的 vTaskSwitchContext 中展开 */
+#define traceTASK_SWITCHED_IN()     Trace_Event(TRACE_EV_TASK_IN, (uint8_t)pxCurrentTCB->uxTCBNumber, 0)
+#else
+#define TRACE_ISR_ENTER(isr)        do { } while (0)
+#define TRACE_ISR_EXIT(isr)         do { } while (0)
+#define TRACE_BEGIN(stage, arg)     do { } while (0)
+#define TRACE_END(stage, arg)       do { } while (0)
+#define TRACE_COUNTER(cnt, val)     do { } while (0)
+#endif
+
+#endif
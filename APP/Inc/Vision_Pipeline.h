@@ -3,14 +3,44 @@
 
 #include <stdint.h>
 #include "app_config.h"
+#include "Vision_Roi.h"
+#include "Vision_Track.h"
+
+/* 已编码的一帧 JPEG：多个消费者 (UDP/RTP/HTTP) 通过引用计数共享，零拷贝 */
+typedef struct {
+    uint8_t *data;
+    uint32_t len;
+    uint32_t frame_id;
+    uint32_t tick;            /* 开始采集的时刻 */
+    volatile uint8_t refs;
+} VisionFrame_t;
 
 int8_t Vision_Init(void);
+VisionFrame_t *Vision_Frame_AcquirePreview(void);
+void Vision_Frame_ReleasePreview(VisionFrame_t *frame);
+uint8_t Vision_Frame_Yielding(const VisionFrame_t *frame);
+void Vision_Frame_Release(VisionFrame_t *frame);
+void Vision_Thumb_SetTarget(uint8_t *input, const uint8_t *lut);
+const uint8_t *Vision_Thumb_Acquire(uint32_t *frame_id, uint32_t *tick);
+const uint8_t *Vision_Thumb_LoadCrop(uint8_t idx);
+uint8_t Vision_Thumb_Crops(void);
+const uint8_t *Vision_Thumb_Gray(void);
+void Vision_Thumb_Release(void);
+void Vision_Thumb_SetCropLimit(uint8_t limit);
+void Vision_Thumb_SetRoi(const VisionRect_t *roi);
+void Vision_Thumb_GetRoi(uint8_t idx, VisionRect_t *roi);
+uint8_t Vision_Thumb_Vote(uint8_t idx, const float *probs, Track_t *out);
+void Vision_Track_GetStats(uint32_t *created, uint32_t *decided, uint32_t *votes);
 
 extern uint32_t half_transfer_count;
 extern uint32_t full_transfer_count;
-extern uint32_t last_jpeg_actual_size;
+extern uint32_t jpeg_skipped_busy;
+extern uint32_t jpeg_lent_frames;
+extern uint32_t thumb_overwritten;
+extern uint32_t strip_late;
+extern uint32_t thumb_roi_frames;
+extern uint32_t thumb_track_skips;
 extern uint8_t  DCMI_Strip_Buf[2][STRIP_BUFFER_SIZE];
-extern uint8_t  JPEG_Out_Buf[JPEG_OUT_BUFFER_SIZE];
-extern volatile uint8_t jpeg_encode_complete;
+extern uint8_t  JPEG_Out_Buf[JPEG_OUT_SLOTS][JPEG_OUT_BUFFER_SIZE];
 
 #endif
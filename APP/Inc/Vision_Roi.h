@@ -0,0 +1,36 @@
+#ifndef VISION_ROI_H
+#define VISION_ROI_H
+
+#include <stdint.h>
+
+/*
+ * 缩略图裁切几何 (不依赖 HAL，主机回放工具 Tools/ai_ref 直接编译同一份代码)。
+ * 裁切区域先被扩成正方形再按最近邻抽样到 ROI_OUT_SIZE x ROI_OUT_SIZE，
+ * 正方形超出画面的部分填充 letterbox，保持宽高比。
+ */
+#define ROI_OUT_SIZE   96
+#define ROI_NONE       0xFFFFU   /* 行/列映射：该输出像素落在画面外 */
+
+typedef struct {
+    int16_t  x, y;            /* 左上角，可为负 (正方形超出画面) */
+    uint16_t w, h;
+} VisionRect_t;
+
+/* 由裁切正方形预先算好的抽样表，条带到达时只查表 */
+typedef struct {
+    VisionRect_t sq;
+    uint16_t row_src[ROI_OUT_SIZE];   /* 输出行 -> 源行 */
+    uint16_t col_src[ROI_OUT_SIZE];   /* 输出列 -> 源列 */
+    uint8_t  row_first, row_end;      /* 有效输出行 [first, end) */
+    uint8_t  col_first, col_end;      /* 有效输出列 [first, end) */
+} VisionRoiMap_t;
+
+void Vision_Roi_Fit(const VisionRect_t *box, uint16_t frame_w, uint16_t frame_h,
+                    uint16_t margin_pct, uint16_t min_side, VisionRect_t *sq);
+uint16_t Vision_Roi_IoU(const VisionRect_t *a, const VisionRect_t *b);
+void Vision_Roi_Map(const VisionRect_t *sq, uint16_t frame_w, uint16_t frame_h, VisionRoiMap_t *map);
+void Vision_Roi_FillBorder(const VisionRoiMap_t *map, uint8_t fill, uint8_t *dst);
+void Vision_Roi_Strip(const VisionRoiMap_t *map, const uint8_t *strip, uint16_t y0, uint16_t lines,
+                      uint16_t frame_w, const uint8_t *lut, uint8_t *dst);
+
+#endif
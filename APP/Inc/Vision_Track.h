@@ -0,0 +1,55 @@
+#ifndef VISION_TRACK_H
+#define VISION_TRACK_H
+
+#include <stdint.h>
+#include "Vision_Roi.h"
+
+/*
+ * 运动区域跟踪与结果融合 (不依赖 HAL，主机工具 Tools/track_sim 直接编译同一份代码)。
+ * 每帧把运动框按 IoU (不足时按中心距离) 关联到已有轨迹，每条轨迹对各次推理的类别概率
+ * 做指数投票；融合置信度达到阈值后该轨迹判定完成，之后不再为它推理，直到目标离开画面。
+ */
+#define TRACK_MAX       8
+#define TRACK_CLASSES   15
+#define TRACK_NONE      0xFF      /* 运动框未关联到轨迹 (轨迹已满) */
+
+/* 轨迹状态 (亦作为 AiResult_t.track_state 上报) */
+#define TRACK_STATE_NONE     0    /* 结果不属于任何轨迹 */
+#define TRACK_STATE_ACTIVE   1    /* 仍在积累投票 */
+#define TRACK_STATE_DECIDED  2    /* 本条结果使轨迹首次达到阈值 (每辆车只上报一次) */
+#define TRACK_STATE_DONE     3    /* 已判定的轨迹 (不应再推理，出现时表示调度未跳过) */
+
+typedef struct {
+    uint16_t iou_min;         /* Q8，IoU 不低于该值才按重叠关联 */
+    uint16_t dist_max;        /* 无重叠时允许的最大中心距离 (像素，曼哈顿距离) */
+    uint16_t max_miss;        /* 连续多少帧未关联即删除轨迹 */
+    uint16_t min_votes;       /* 判定前至少需要的推理次数 */
+    float    alpha;           /* 新一次推理的投票权重 (0~1] */
+    float    conf;            /* 判定阈值 */
+} TrackCfg_t;
+
+typedef struct {
+    VisionRect_t box;
+    uint16_t id;              /* 全局递增，0 表示空槽 */
+    uint16_t misses;
+    uint16_t votes;
+    uint8_t  state;           /* TRACK_STATE_ACTIVE / TRACK_STATE_DONE */
+    uint8_t  best;            /* 融合后最高分类别 */
+    float    score;           /* 融合后最高分 */
+    float    acc[TRACK_CLASSES];
+} Track_t;
+
+typedef struct {
+    Track_t  t[TRACK_MAX];
+    uint16_t next_id;
+    uint32_t created;         /* 累计新建的轨迹数 */
+    uint32_t decided;         /* 累计判定的轨迹数 */
+    uint32_t votes;           /* 累计投票 (推理) 次数 */
+} Tracker_t;
+
+void    Track_Init(Tracker_t *trk);
+void    Track_Update(Tracker_t *trk, const TrackCfg_t *cfg, const VisionRect_t *boxes, uint8_t n, uint8_t *slot);
+uint8_t Track_NeedsInference(const Tracker_t *trk, uint8_t slot);
+uint8_t Track_Vote(Tracker_t *trk, const TrackCfg_t *cfg, uint8_t slot, uint16_t id, const float *probs);
+
+#endif
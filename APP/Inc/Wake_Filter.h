@@ -0,0 +1,33 @@
+#ifndef WAKE_FILTER_H
+#define WAKE_FILTER_H
+
+#include <stdint.h>
+
+/*
+ * 唤醒级联第一级 (不依赖 HAL)：整帧抽样成 32x32 灰度图，逐点比较亮度与梯度能量
+ * (|gx| + |gy|) 相对慢速背景的变化，变化点数达到阈值才唤醒 MobileNetV2。
+ * 梯度项对整体光照变化不敏感，亮度项捕捉纹理较弱的大块目标。
+ */
+#define WAKE_SIZE       32
+#define WAKE_PIXELS     (WAKE_SIZE * WAKE_SIZE)
+#define WAKE_SCRATCH_BYTES (WAKE_PIXELS * 2)   /* Wake_Score 的梯度工作区 */
+
+typedef struct {
+    uint8_t  luma_thresh;     /* 单点亮度变化阈值 (0~255) */
+    uint8_t  edge_thresh;     /* 单点梯度能量变化阈值 */
+    uint16_t min_points;      /* 变化点数达到该值即唤醒 */
+    uint8_t  bg_shift;        /* 空场景时背景更新速率 1/2^shift，有目标时再慢 8 倍 */
+    uint8_t  warmup;          /* 上电后建立背景的帧数，期间总是唤醒 */
+} WakeCfg_t;
+
+typedef struct {
+    uint16_t luma[WAKE_PIXELS];   /* 背景亮度 (Q8) */
+    uint16_t edge[WAKE_PIXELS];   /* 背景梯度能量 (Q6) */
+    uint32_t frames;
+} WakeBg_t;
+
+void     Wake_Gray_Strip(const uint8_t *strip, uint16_t y0, uint16_t lines,
+                         uint16_t frame_w, uint16_t frame_h, uint8_t *gray);
+uint16_t Wake_Score(const WakeCfg_t *cfg, WakeBg_t *bg, const uint8_t *gray, uint16_t *scratch);
+
+#endif
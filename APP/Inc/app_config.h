@@ -9,22 +9,176 @@
 #define JPEG_STRIP_LINES    16
 #define STRIP_BUFFER_SIZE   (CAM_RES_WIDTH * JPEG_STRIP_LINES * 2)
 #define JPEG_OUT_BUFFER_SIZE (80 * 1024)
+#define JPEG_OUT_SLOTS       2    /* 编码输出槽：被网络/预览引用的槽不会被覆盖 */
+#define DEFER_REPORT_INTERVAL_MS 5000 /* 中断延后队列与中断最坏耗时打印周期 */
+
+/* AI 推理参数 (vehicle_detector：96x96x3 U8 输入，15 类输出) */
+#define AI_THUMB_WIDTH       96
+#define AI_THUMB_HEIGHT      96
+#define AI_THUMB_SIZE        (AI_THUMB_WIDTH * AI_THUMB_HEIGHT * 3)
+#define AI_THUMB_CROP_X      ((CAM_RES_WIDTH - CAM_RES_HEIGHT) / 2) /* 默认中心裁成 480x480 正方形，5 倍最近邻抽样 */
+#define AI_REPORT_INTERVAL_MS 5000                                 /* 推理耗时/吞吐打印周期 */
+
+/* ROI 裁切：有运动时只对运动区域 (扩成正方形) 做缩略图，远处的摩托/行人不再被缩成几个像素；
+ * 无运动时退回上面的中心 480x480 裁切 */
+#define AI_ROI_ENABLE        1
+#define AI_ROI_MARGIN_PCT    20    /* 运动框四周外扩比例 (相对长边)，覆盖检测滞后一帧的位移 */
+#define AI_ROI_MIN_SIDE      160   /* 裁切正方形最小边长 (像素) */
+#define AI_ROI_HOLD_FRAMES   5     /* 运动消失后沿用上一个 ROI 的帧数 */
+#define AI_ROI_FILL          128   /* 超出画面部分的 letterbox 灰度 */
+#define MOTION_CELL          16    /* 运动检测网格边长，须等于 JPEG_STRIP_LINES */
+#define MOTION_THRESH        20    /* 与背景的亮度差阈值 (0~255) */
+#define MOTION_MIN_CELLS     3     /* 少于该运动格数视为噪声 */
+#define MOTION_WARMUP_FRAMES 16    /* 上电后建立背景的帧数 */
+#define MOTION_MAX_BLOBS     8     /* 每帧最多跟踪的运动块数 */
+
+/* 多裁切调度：一帧中有多个运动区域时 (两辆车、卡车旁的行人) 最多生成 AI_MAX_CROPS 张缩略图，
+ * 按 面积 x (1 + 新颖度增益) 排序后依次推理，整帧推理时间不超过 AI_FRAME_BUDGET_US */
+#define AI_MAX_CROPS         2     /* 每多一张裁切占用 2 x 27 KB AXI (直写/备用两套缓冲) */
+#define AI_FRAME_BUDGET_US   100000 /* 每帧推理时间预算，按平均耗时预估下一张会超出时停止 */
+#define AI_CROP_NOVELTY_GAIN 2     /* 与近期裁切都不重叠的区域得分最多提高到 (1 + 增益) 倍 */
+#define AI_CROP_MERGE_IOU_PCT 50   /* 与已选裁切 IoU 超过该值的候选视为同一目标，不再单独推理 */
+
+/* 多模型：注册的网络 (AI_Model.c) 分时共用一块激活区 (取最大者)，按份额逐裁切分配网络 */
+#define AI_MODEL_VEHICLE_SHARE 1   /* 车型细分网络的调度份额 (0: 停用) */
+
+/* 跟踪与结果融合：运动框跨帧关联成轨迹，每条轨迹的推理结果做指数投票，
+ * 融合置信度达到 AI_TRACK_CONF (PRD 判定阈值) 后不再为该车辆推理，直到其离开画面 */
+#define AI_TRACK_ENABLE      1
+#define AI_TRACK_CONF        0.85f /* 判定阈值 */
+#define AI_TRACK_ALPHA       0.5f  /* 新一次推理的投票权重 */
+#define AI_TRACK_MIN_VOTES   2     /* 判定前至少推理的次数 (单帧高分可能是误检) */
+#define AI_TRACK_IOU_PCT     30    /* 相邻帧运动框 IoU 不低于该值即视为同一目标 */
+#define AI_TRACK_DIST        64    /* 无重叠时按中心距离关联的上限 (像素) */
+#define AI_TRACK_MAX_MISS    AI_ROI_HOLD_FRAMES /* 连续多少帧无运动即结束轨迹 */
+
+/* 唤醒级联：第一级在 32x32 灰度图上比较亮度/梯度能量与背景 (约 30 us)，
+ * 判定有目标才运行 MobileNetV2；第一级的梯度工作区借用推理前空闲的激活区 */
+#define AI_WAKE_ENABLE       1
+#define AI_WAKE_LUMA_THRESH  24    /* 单点亮度变化阈值 */
+#define AI_WAKE_EDGE_THRESH  20    /* 单点梯度能量变化阈值 */
+#define AI_WAKE_MIN_POINTS   6     /* 32x32 中变化点数达到该值即唤醒，调低可减少漏检 */
+#define AI_WAKE_BG_SHIFT     4     /* 空场景背景更新速率 1/16 */
+#define AI_WAKE_WARMUP       16    /* 上电后建立背景的帧数 (期间总是唤醒) */
+#define AI_WAKE_AUDIT_EVERY  20    /* 每拒绝多少帧仍跑一次第二级，用于估计第一级漏检 (0: 关闭) */
+
+/* AI 内存布局 (激活区 126.5 KB、权重 419 KB)：先用 AI_BENCH_ENABLE 在板上测出
+ * 各区域的逐层周期数，再按基准输出的建议填写热点层列表 */
+#define AI_MEM_FLASH         0
+#define AI_MEM_ITCM          1    /* 64 KB，0 等待，仅 CPU 访问 */
+#define AI_MEM_DTCM          2    /* 128 KB，与主栈/newlib 堆共用 */
+#define AI_MEM_AXI           3    /* 512 KB，与 JPEG/断网缓存/FreeRTOS 堆共用 */
+#define AI_ACT_REGION        AI_MEM_AXI   /* 激活区：AXI 或 DTCM (DTCM 需把链接脚本堆栈压到 1.5 KB 以内) */
+#define AI_WEIGHTS_HOT_REGION AI_MEM_FLASH /* 热点层权重搬到哪里；AI_MEM_FLASH 表示全部留在 Flash */
+/* #define AI_WEIGHTS_HOT_LAYERS { 79, 78, 76 } */ /* 热点层 c_idx，由基准测试打印 */
+#define AI_ITCM_POOL_SIZE    (64 * 1024)
+#define AI_DTCM_POOL_SIZE    (96 * 1024)
+#define AI_AXI_POOL_SIZE     (48 * 1024)
+#define AI_BENCH_ENABLE      0    /* 1: AI 任务启动时先跑一遍布局基准 */
+#define AI_BENCH_RUNS        10   /* 每种布局的推理次数 */
+#define AI_PROFILE_ENABLE    0    /* 1: 正常推理时逐层计时，每 AI_PROFILE_RUNS 次输出一次 AIPROF CSV */
+#define AI_PROFILE_RUNS      50
+#define AI_VALIDATE_ENABLE   0    /* 1: 板上金标验证/基准模式 (Tools/ai_validate.py)，不生成相机缩略图，另占 27 KB AXI */
+#define AI_VALIDATE_PORT     8002
+#define AI_VALIDATE_MAX_LOOPS 1000 /* 每个向量最多循环推理次数 */
+
+/* 激活区外借：AI 空闲时把激活区中输入张量与唤醒工作区以外的一块借给 JPEG 作为额外的编码输出槽
+ * (帧缓冲深度 JPEG_OUT_SLOTS + 1，不增加 RAM)，第二级推理前收回 (Mem_Overlay.c)。
+ * 仅 AI_ACT_REGION 为 AXI 时生效 (ETH DMA 不能访问 DTCM) */
+#define AI_LEND_ENABLE       1
+#define AI_LEND_RECLAIM_MS   20   /* 推理前等待借用方归还的上限，超时本帧不推理、计入 deadline miss */
+#define AI_LEND_DEBUG        1    /* 保护带、归还后毒化与过期凭证检查 (发布版可置 0) */
+#if AI_LEND_ENABLE && AI_ACT_REGION == AI_MEM_AXI
+#define JPEG_LEND_SLOTS      1    /* 借来的编码输出槽个数 (由上面两项推出，勿直接修改) */
+#else
+#define JPEG_LEND_SLOTS      0
+#endif
 
 /* 网络参数 */
-#define DEST_IP_ADDR0        192
-#define DEST_IP_ADDR1        168
-#define DEST_IP_ADDR2        1
-#define DEST_IP_ADDR3        255  /* 临时改为广播地址测试 */
+/*
+ * 上报目标不再写死：出厂时没有目标，图像/结果只进断网缓存与证据日志；主机向本机
+ * UDP_LOCAL_PORT 发送带 HMAC 标签的订阅包 (Tools/subscribe.py) 后成为上报目标 (并记入备份 SRAM)。
+ * 以下本机地址仅在 DHCP 超时后作为静态回退地址使用 (/24，网关 .1)。
+ */
 #define LOCAL_IP_ADDR0       192
 #define LOCAL_IP_ADDR1       168
 #define LOCAL_IP_ADDR2       1
 #define LOCAL_IP_ADDR3       10
 #define UDP_REMOTE_PORT      8080
 #define UDP_LOCAL_PORT       8000
+#define UDP_RESULT_PORT      8081 /* 识别结果/遥测记录端口，与图像流分开 */
+#define NET_AUTH_KEY         "ivcis-psk-change-me" /* 订阅/策略下发的 HMAC 预共享密钥 (<= 64 字节)，部署时必须修改 */
+
+/* RTP/JPEG (RFC 2435) 标准流输出，可直接用 ffplay/GStreamer 打开 Tools/ivcis_rtp.sdp */
+#define RTP_JPEG_ENABLE          1
+#define RTP_PORT                 5004  /* RTCP 使用 RTP_PORT + 1 */
+#define RTP_MAX_PAYLOAD          1400  /* 每包 JPEG 负载上限 (不含 RTP/JPEG 头) */
+#define RTP_SSRC                 0x49564353UL /* "IVCS" */
+#define RTCP_SR_INTERVAL_MS      5000
+
+/* MJPEG-over-HTTP 预览 (调试/开通用，浏览器直接打开 http://<板卡IP>/) */
+#define HTTP_MJPEG_ENABLE        1
+#define HTTP_PORT                80
+#define HTTP_MAX_VIEWERS         2
+#define HTTP_MIN_INTERVAL_MS     200   /* 每个观看者的帧间隔下限 (限速，保证证据上传带宽) */
+#define HTTP_STALL_MS            3000  /* 一帧持有超过该时长视为卡死，断开该观看者以释放帧 */
+
+/* DHCP 与快速上线参数 */
+#define NET_DHCP_FALLBACK_MS     5000  /* 链路建立后等待 DHCP 的上限，超时回退静态地址 */
+#define NET_ARP_STATIC_HOLD_MS   10000 /* 缓存的目标 MAC 作为静态 ARP 表项保留多久，之后恢复正常解析 */
+
+/* Net 任务：JPEG/推理结果由事件唤醒，以下只是链路维护、补发、RTCP 等周期工作的节拍 */
+#define NET_POLL_INTERVAL_MS     10
+#define NET_REPORT_INTERVAL_MS   5000  /* 交接延迟 (JPEG 完成中断 -> 开始发送) 打印周期 */
+#define NET_HANDOFF_BASELINE     0     /* 1: 仅用于对比测量，还原改造前每 NET_POLL_INTERVAL_MS 轮询一次的交接方式 */
+#define SYS_STATS_INTERVAL_MS    2000  /* 任务 CPU 占用/栈/堆遥测周期 (须小于 CYCCNT 回绕时间) */
+
+/* 流水线追踪 (Trace.h)：中断/任务切换/阶段/队列深度事件经 UDP 发往上报目标，上位机 Tools/trace_view 转 JSON */
+#define TRACE_ENABLE             0
+#define TRACE_PORT               8003
+#define TRACE_BUF_EVENTS         4096  /* 2 的幂，每条 8 字节；约 10k 事件/s 时可缓冲 0.4 s */
+#define TRACE_FLUSH_MS           50    /* 不满一包的事件最长滞留时间 */
+#define TRACE_META_INTERVAL_MS   1000  /* 任务名表发送周期 */
+
+/* 断网缓存 (Store-and-Forward) 参数 */
+#define NET_SF_POOL_SIZE         (160 * 1024) /* 断网期间的帧缓存池 (AXI SRAM) */
+#define NET_SF_DRAIN_INTERVAL_MS 50           /* 恢复后补发节拍：每隔多少 ms 补发一条 */
+
+/* 片上 Flash 证据日志 (Bank2 Sector4~7，与链接脚本 EVIDENCE 区保持一致)
+   与模型 B 区同 Bank，不挂起程序取指；轮换擦除前经 Model_Bank_EraseBegin 让推理改用出厂权重 */
+#define EVID_FLASH_BANK          FLASH_BANK_2
+#define EVID_FIRST_SECTOR        4
+#define EVID_SECTOR_COUNT        4
+#define EVID_FLASH_BASE          0x08180000UL
+#define EVID_SECTOR_SIZE         FLASH_SECTOR_SIZE   /* 128 KB */
+
+/* 模型权重 A/B 区 (与链接脚本 MODEL_A/MODEL_B 区保持一致，每区 4 个扇区) 与远程更新
+   A 区与程序同在 Bank1，运行中从不擦写；远程更新只写 B 区 (Bank2)，Bank2 擦除期间推理用 A 区 */
+#define MODEL_SLOT_A_BASE        0x08080000UL        /* Bank1 Sector4~7，出厂权重随固件链接在此 */
+#define MODEL_SLOT_A_BANK        FLASH_BANK_1
+#define MODEL_SLOT_A_SECTOR      4
+#define MODEL_SLOT_B_BASE        0x08100000UL        /* Bank2 Sector0~3 */
+#define MODEL_SLOT_B_BANK        FLASH_BANK_2
+#define MODEL_SLOT_B_SECTOR      0
+#define MODEL_SLOT_SIZE          (4 * FLASH_SECTOR_SIZE)
+#define MODEL_OTA_ENABLE         1
+#define MODEL_OTA_PORT           8001
+#define MODEL_OTA_RX_BUF         (8 * 1024)          /* 接收环形缓冲，不小于 TCP_WND */
+#define MODEL_OTA_IDLE_MS        10000               /* 连接无数据超过该时长即断开 (可续传) */
+
+/* 串口日志 (Log.c)：printf 与 LOG_x 写入环形缓冲，由 Task_Log 经 USART3 DMA 发出，调用方不等串口 */
+#define LOG_LEVEL                LOG_LVL_INFO  /* 高于该级别的 LOG_x 编译时去掉 */
+#define LOG_BINARY               0             /* 1: LOG_x 输出二进制记录 (格式串编号 + 参数)，用 Tools/log_decode.py 解码 */
+#define LOG_RING_SIZE            (8 * 1024)    /* 2 的幂 */
+#define LOG_TX_CHUNK             512           /* 每次 DMA 发送的最大字节数 */
+#define LOG_FLUSH_MS             5             /* 缓冲未过半时的发送节拍 */
 
 /* 内存段与对齐宏 (已更名以避免与 HAL 库冲突) */
 #define IVCIS_ALIGN_32       __attribute__((aligned(32)))
 #define D2_SRAM_SECTION      __attribute__((section(".RamDataSection")))
 #define D1_AXI_SECTION       __attribute__((section(".RamDataSectionAXI")))
+#define DTCM_SECTION         __attribute__((section(".dtcm_sec")))
+#define ITCM_SECTION         __attribute__((section(".itcm_sec")))
+#define RTOS_SECTION         __attribute__((section(".bss.rtos")))   /* D1 .rtos_sec：任务栈/控制块等静态 RTOS 对象 (启动时清零) */
 
 #endif
@@ -0,0 +1,64 @@
+#ifndef SHARED_TYPES_H
+#define SHARED_TYPES_H
+
+#include <stdint.h>
+
+/* 任务间/上位机共享的数据结构 (小端，按字节打包，直接作为 UDP 记录负载) */
+
+#define AI_NUM_CLASSES       15
+
+/* 一次推理的结果：AI 任务产生，Net 任务以 NET_REC_RESULT 上报 */
+typedef struct __attribute__((packed)) {
+    uint32_t frame_id;        /* 对应的采集帧号 (与 JPEG 帧号同源) */
+    uint32_t capture_tick;    /* 缩略图完成时刻 (HAL_GetTick) */
+    uint32_t latency_us;      /* 网络运行耗时 */
+    uint8_t  class_id;        /* 最高分类别 */
+    uint8_t  crop_idx;        /* 本帧第几张裁切 (按调度优先级) */
+    uint8_t  crop_count;      /* 本帧计划推理的裁切数 */
+    uint8_t  track_state;     /* TRACK_STATE_xxx (Vision_Track.h)，2 表示本条给出了该车辆的判定 */
+    int16_t  roi_x, roi_y;    /* 裁切正方形 (像素坐标，可超出画面) */
+    uint16_t roi_side;
+    uint16_t track_id;        /* 轨迹号 (0: 不属于轨迹) */
+    uint8_t  fused_class;     /* 轨迹融合后的类别 */
+    uint8_t  model_id;        /* 产生本条结果的网络 AI_MODEL_xxx (AI_Model.h) */
+    uint16_t track_votes;     /* 轨迹累计推理次数 */
+    float    fused_conf;      /* 轨迹融合置信度 */
+    uint8_t  action;          /* 本地策略判定 POLICY_ACT_xxx (Policy_Engine.h) */
+    uint8_t  bill;            /* 计费车型 (JT/T 489) */
+    uint8_t  alarm;           /* 拦截原因 POLICY_ALARM_xxx */
+    uint8_t  why;             /* 判定依据 POLICY_WHY_xxx */
+    uint16_t policy_version;  /* 所用规则表版本 */
+    uint16_t reserved3;
+    float    probs[AI_NUM_CLASSES];
+} AiResult_t;
+
+/*
+ * 系统运行统计遥测 (Sys_Stats 周期生成，Net 任务发往 UDP_RESULT_PORT，不进断网缓存)。
+ * 以 magic 与识别结果记录区分；tasks[] 只有前 n_tasks 项有效，数据报按实际长度发送。
+ */
+#define TELEM_MAGIC          0x4D4C4554UL  /* "TELM" */
+#define TELEM_MAX_TASKS      16
+#define TELEM_NAME_LEN       12            /* 任务名截断，不保证 '\0' 结尾 */
+
+typedef struct __attribute__((packed)) {
+    char     name[TELEM_NAME_LEN];
+    uint16_t cpu_permille;    /* 本窗口 CPU 占用 (千分比，中断时间计入被打断的任务) */
+    uint16_t stack_free;      /* 栈历史最小剩余 (字) */
+    uint8_t  priority;        /* 当前优先级 (FreeRTOS 数值) */
+    uint8_t  state;           /* eTaskState */
+} TelemTask_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;           /* TELEM_MAGIC */
+    uint32_t seq;
+    uint32_t tick;            /* 生成时刻 (HAL_GetTick) */
+    uint32_t window_us;       /* 统计窗口长度 */
+    uint16_t cpu_busy_permille; /* 1000 - IDLE 任务占用 */
+    uint8_t  n_tasks;
+    uint8_t  reserved;
+    uint32_t heap_free;       /* FreeRTOS 堆当前剩余 (字节) */
+    uint32_t heap_min_free;   /* FreeRTOS 堆历史最小剩余 */
+    TelemTask_t tasks[TELEM_MAX_TASKS];
+} TelemRecord_t;
+
+#endif
@@ -0,0 +1,155 @@
+#include "AI_Bench.h"
+#include "AI_Mem.h"
+#include "AI_Profiler.h"
+#include "app_config.h"
+#include "main.h"
+#include "vehicle_detector.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 逐层计时                                 */
+/* ========================================== */
+/*
+ * 逐层计时由 AI_Profiler (observer + DWT) 完成，每种布局跑 AI_BENCH_RUNS 次取平均。
+ * 每个权重池按层号顺序分批装填：一批内的层同时在池中测量，换批前权重全部指回 Flash，
+ * 直到所有放得下的层都测过；最后对每个区域按 "节省周期/字节" 贪心挑选热点层。
+ * 输出均以 "AIBENCH," 开头，便于从串口日志中 grep 出 CSV。
+ */
+#define N_REGIONS   4
+
+static uint32_t cyc[N_REGIONS][AI_MEM_MAX_LAYERS];   /* 各区域逐层平均周期，0 = 未测 */
+
+/**
+ * @brief  跑 AI_BENCH_RUNS 次 (先预热一次)，把逐层平均周期写入 out
+ * @retval 整网平均周期
+ */
+static uint32_t bench_measure(ai_handle net, ai_buffer *in, ai_buffer *out, uint32_t *dst) {
+    uint32_t total = 0;
+
+    ai_vehicle_detector_run(net, in, out);   /* 预热 I/D-Cache */
+    AI_Prof_Reset();
+    for (uint32_t r = 0; r < AI_BENCH_RUNS; r++) {
+        ai_vehicle_detector_run(net, in, out);
+    }
+    for (uint16_t c = 0; c < AI_Mem_LayerCount(); c++) {
+        dst[c] = AI_Prof_LayerAvg(c);
+        total += dst[c];
+    }
+    return total;
+}
+
+/* ========================================== */
+/* 2. 热点层规划                               */
+/* ========================================== */
+
+/**
+ * @brief  在 region 的池容量内按 (Flash 周期 - 池内周期) / 字节 贪心选层
+ * @retval 预计节省的周期数；sel/n_sel 返回选中的层
+ */
+static uint32_t bench_plan(uint8_t region, uint16_t *sel, uint16_t *n_sel) {
+    uint8_t taken[AI_MEM_MAX_LAYERS] = {0};
+    uint32_t budget = AI_Mem_PoolSize(region);
+    uint32_t used = 0, saved = 0;
+
+    *n_sel = 0;
+    for (;;) {
+        int16_t best = -1;
+        uint32_t best_ratio = 0;
+        for (uint16_t c = 0; c < AI_Mem_LayerCount(); c++) {
+            const AiLayerMem_t *l = AI_Mem_Layer(c);
+            uint32_t need = l->weight_bytes + 8U * l->n_arrays;
+            if (taken[c] || l->weight_bytes == 0 || cyc[region][c] == 0) continue;
+            if (cyc[region][c] >= cyc[AI_MEM_FLASH][c] || used + need > budget) continue;
+            uint32_t ratio = ((cyc[AI_MEM_FLASH][c] - cyc[region][c]) << 8) / l->weight_bytes;
+            if (ratio > best_ratio) {
+                best_ratio = ratio;
+                best = (int16_t)c;
+            }
+        }
+        if (best < 0) break;
+        taken[best] = 1;
+        used += AI_Mem_Layer(best)->weight_bytes + 8U * AI_Mem_Layer(best)->n_arrays;
+        saved += cyc[AI_MEM_FLASH][best] - cyc[region][best];
+        sel[(*n_sel)++] = (uint16_t)best;
+    }
+    return saved;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  布局基准：测 Flash 基线与各权重池的逐层周期，打印 CSV 与建议配置
+ * @param  input: 输入数据；NULL 表示沿用输入张量中的现有内容
+ * @note   AI 任务启动时调用一次 (AI_BENCH_ENABLE)，耗时约数十秒；结束后恢复配置布局
+ */
+void AI_Bench_Run(ai_handle net, const uint8_t *input) {
+    ai_buffer *in = ai_vehicle_detector_inputs_get(net, NULL);
+    ai_buffer *out = ai_vehicle_detector_outputs_get(net, NULL);
+    uint16_t list[AI_MEM_MAX_LAYERS];
+    uint8_t measured[AI_MEM_MAX_LAYERS];
+    uint32_t base_total;
+    uint16_t n_layers = AI_Mem_LayerCount();
+
+    if (in == NULL || out == NULL || n_layers == 0) return;
+    if (input != NULL) in[0].data = AI_HANDLE_PTR(input);
+    memset(cyc, 0, sizeof(cyc));
+
+    if (AI_Prof_Start(net) != 0) return;
+
+    AI_Mem_ResetWeights();
+    base_total = bench_measure(net, in, out, cyc[AI_MEM_FLASH]);
+    printf("[AIBENCH] act=%s baseline (all weights in FLASH): %ld cycles, %ld us\r\n",
+           AI_Mem_RegionName(AI_ACT_REGION), base_total, base_total / (SystemCoreClock / 1000000U));
+
+    for (uint8_t region = AI_MEM_ITCM; region < N_REGIONS; region++) {
+        uint32_t tmp[AI_MEM_MAX_LAYERS];
+        if (AI_Mem_PoolSize(region) == 0) continue;
+        memset(measured, 0, sizeof(measured));
+
+        for (;;) {
+            uint16_t n = 0;
+            AI_Mem_ResetWeights();
+            for (uint16_t c = 0; c < n_layers; c++) {
+                if (!measured[c] && AI_Mem_Layer(c)->weight_bytes > 0) list[n++] = c;
+            }
+            if (n == 0 || AI_Mem_PlaceWeights(net, list, n, region) == 0) break;  /* 余下的层单层就超过池容量 */
+
+            bench_measure(net, in, out, tmp);
+            for (uint16_t c = 0; c < n_layers; c++) {
+                if (AI_Mem_Layer(c)->region == region) {
+                    cyc[region][c] = (tmp[c] != 0) ? tmp[c] : 1;
+                    measured[c] = 1;
+                }
+            }
+        }
+    }
+    AI_Mem_ResetWeights();
+    AI_Prof_Stop(net);
+
+    printf("AIBENCH,c_idx,name,weight_bytes,flash,itcm,dtcm,axi\r\n");
+    for (uint16_t c = 0; c < n_layers; c++) {
+        const AiLayerMem_t *l = AI_Mem_Layer(c);
+        printf("AIBENCH,%d,%s,%ld,%ld,%ld,%ld,%ld\r\n", c, AI_Prof_LayerName(c), l->weight_bytes,
+               cyc[AI_MEM_FLASH][c], cyc[AI_MEM_ITCM][c], cyc[AI_MEM_DTCM][c], cyc[AI_MEM_AXI][c]);
+    }
+
+    for (uint8_t region = AI_MEM_ITCM; region < N_REGIONS; region++) {
+        uint16_t n_sel;
+        if (AI_Mem_PoolSize(region) == 0) continue;
+        uint32_t saved = bench_plan(region, list, &n_sel);
+        printf("[AIBENCH] %s pool %ld B: %d hot layers save %ld cycles (%ld -> %ld)\r\n",
+               AI_Mem_RegionName(region), AI_Mem_PoolSize(region), n_sel, saved, base_total, base_total - saved);
+        printf("[AIBENCH]   #define AI_WEIGHTS_HOT_REGION AI_MEM_%s\r\n[AIBENCH]   #define AI_WEIGHTS_HOT_LAYERS {",
+               AI_Mem_RegionName(region));
+        for (uint16_t i = 0; i < n_sel; i++) {
+            printf("%s%d", i ? ", " : " ", list[i]);
+        }
+        printf(" }\r\n");
+    }
+
+    AI_Mem_ApplyConfig(net);
+    AI_Mem_PrintPlan();
+}
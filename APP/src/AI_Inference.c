@@ -0,0 +1,560 @@
+#include "AI_Inference.h"
+#include "AI_Mem.h"
+#include "AI_Model.h"
+#include "AI_Bench.h"
+#include "AI_Profiler.h"
+#include "Vision_Pipeline.h"
+#include "Wake_Filter.h"
+#include "Policy_Engine.h"
+#include "Model_Bank.h"
+#include "Model_Ota.h"
+#include "Mem_Overlay.h"
+#include "Net_Client.h"
+#include "Trace.h"
+#include "Log.h"
+#include "app_config.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include "vehicle_detector.h"
+#include "vehicle_detector_data.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 模型与内存                               */
+/* ========================================== */
+/*
+ * 激活区 (126.5 KB) 由 AI_Mem 按 AI_ACT_REGION 静态放置。模型以 allocate-inputs 生成，
+ * 输入张量位于激活区内：初始化后把其地址与量化查找表交给 Vision，缩略图在采集时
+ * 直接缩放+量化写入，推理前无需再拷贝。推理期间激活区由 Vision_Thumb_Acquire/Release
+ * 保护，新帧先写入 Vision 的备用缓冲。
+ * 网络由 AI_Model 注册表创建并分时共用激活区；本文件只针对主模型 (车型细分) 做权重布局、
+ * 剖析、远程更新与轨迹投票，每张裁切交给哪个网络由 AI_Model_Pick 决定。
+ */
+_Static_assert(AI_THUMB_SIZE == AI_VEHICLE_DETECTOR_IN_1_SIZE_BYTES, "thumbnail size must match model input");
+_Static_assert(AI_NUM_CLASSES == AI_VEHICLE_DETECTOR_OUT_1_SIZE, "class count must match model output");
+_Static_assert(TRACK_CLASSES == AI_NUM_CLASSES, "tracker class count must match model output");
+
+static ai_handle ai_net = AI_HANDLE_NULL; // 主模型
+static uint8_t *ai_in_tensor = NULL;   // 激活区内的主模型输入张量 (缩略图直写目标)
+static const uint8_t *ai_weights = NULL; // 主模型当前绑定的权重
+
+static AiStats_t stats = {0};
+static uint32_t win_start_tick = 0;    // 吞吐统计窗口起点
+static uint32_t win_runs = 0;
+static uint32_t last_report_tick = 0;
+
+extern osMessageQueueId_t Q_Net_Handle;
+
+/*
+ * 唤醒级联：第一级 (Wake_Filter) 判定整帧有目标才运行本模型。第一级的梯度工作区借用
+ * 激活区中输入张量以外的部分 (两级串行执行，第一级结束后才推理)，不额外占用 RAM。
+ * 每拒绝 AI_WAKE_AUDIT_EVERY 帧仍抽查一次第二级，第二级高置信即计为第一级漏检。
+ */
+#if AI_WAKE_ENABLE
+static WakeCfg_t wake_cfg = {   // min_points 可由 AI_Inference_SetWakeThreshold 在线调整
+    AI_WAKE_LUMA_THRESH, AI_WAKE_EDGE_THRESH, AI_WAKE_MIN_POINTS, AI_WAKE_BG_SHIFT, AI_WAKE_WARMUP
+};
+static WakeBg_t wake_bg;
+static uint16_t *wake_scratch = NULL;  // 激活区内的工作区 (NULL: 第一级不可用，总是唤醒)
+static uint32_t wake_rejects = 0;      // 距上次抽查连续拒绝的帧数
+#endif
+
+/*
+ * 激活区外借：输入张量 (中断随时写入) 与唤醒工作区 (每帧使用) 以外切出一块 JPEG 输出槽大小的
+ * 内存登记到 Mem_Overlay。唤醒级联拒绝的帧不需要收回，只有运行第二级或切换权重前才收回，
+ * 本帧结束后重新借出。
+ */
+#define AI_LEND_BLOCK_SIZE  (JPEG_OUT_BUFFER_SIZE + 2 * OVERLAY_GUARD)
+
+/* 结果队列 (AI 任务写，Net 任务读)：一帧可有多张裁切的结果，满时丢弃最旧的一条 */
+#define AI_RESULT_QUEUE  (2 * AI_MAX_CROPS)
+static AiResult_t result_q[AI_RESULT_QUEUE];
+static uint8_t result_head = 0;
+static uint8_t result_count = 0;
+static uint8_t result_evt_pending = 0;  // 已投递 NET_EVT_RESULT，Net 任务尚未把结果队列取空
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+/**
+ * @brief  打开 DWT 周期计数器，用于微秒级推理计时
+ */
+static void ai_cycle_counter_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;  /* M7 需先解锁 DWT */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief  在激活区中为 JPEG 切出外借块 (须在输入张量与唤醒工作区确定之后)
+ */
+static void ai_lend_init(void) {
+#if AI_LEND_ENABLE && AI_ACT_REGION == AI_MEM_AXI
+    AiMemSpan_t keep[2] = { { ai_in_tensor, AI_THUMB_SIZE }, { NULL, 0 } };
+    uint8_t *block;
+
+#if AI_WAKE_ENABLE
+    keep[1].base = (const uint8_t *)wake_scratch;
+    keep[1].size = (wake_scratch != NULL) ? WAKE_SCRATCH_BYTES : 0;
+#endif
+    block = (uint8_t *)AI_Mem_Carve(keep, 2, AI_LEND_BLOCK_SIZE);
+    if (block == NULL || Mem_Overlay_AddBlock(block, AI_LEND_BLOCK_SIZE) < 0) {
+        printf("[AI] arena lending disabled: no %d B gap in activations\r\n", AI_LEND_BLOCK_SIZE);
+        return;
+    }
+    printf("[AI] lending %d B of activations @0x%08lX to JPEG between inferences\r\n",
+           AI_LEND_BLOCK_SIZE, (uint32_t)block);
+#endif
+}
+
+/**
+ * @brief  唤醒级联第一级
+ * @param  audit: 输出，1 表示第一级拒绝但本帧被抽查
+ * @retval 1: 运行第二级; 0: 跳过本帧
+ */
+static uint8_t ai_wake_stage(uint8_t *audit) {
+    *audit = 0;
+#if AI_WAKE_ENABLE
+    const uint32_t cyc_per_us = SystemCoreClock / 1000000U;
+    uint32_t start = DWT->CYCCNT;
+    WakeCfg_t cfg = wake_cfg;   // 本帧快照：背景冻结判断与唤醒判断使用同一阈值
+    uint16_t points;
+    uint32_t us;
+
+    if (wake_scratch == NULL) return 1;
+    points = Wake_Score(&cfg, &wake_bg, Vision_Thumb_Gray(), wake_scratch);
+    us = (DWT->CYCCNT - start) / cyc_per_us;
+
+    stats.wake_frames++;
+    stats.wake_points_last = points;
+    stats.wake_avg_us = (stats.wake_avg_us == 0) ? us : stats.wake_avg_us - stats.wake_avg_us / 8 + us / 8;
+    if (points >= cfg.min_points) {
+        stats.wake_pass++;
+        return 1;
+    }
+    if (AI_WAKE_AUDIT_EVERY > 0 && ++wake_rejects >= AI_WAKE_AUDIT_EVERY) {
+        wake_rejects = 0;
+        stats.wake_audits++;
+        *audit = 1;
+        return 1;
+    }
+    return 0;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief  本地策略判定：未跟踪的结果与刚判定的轨迹按融合结果决策，
+ *         仍在投票的轨迹标记为 PENDING (等待下一次推理，不上交云端)；
+ *         其他网络的类别不在规则表中，一律上交云端按 model_id 处理
+ */
+static void ai_apply_policy(AiResult_t *result) {
+    PolicyDecision_t d;
+
+    if (result->model_id != AI_MODEL_VEHICLE) {
+        d.action = POLICY_ACT_ESCALATE;
+        d.bill = 0;
+        d.alarm = POLICY_ALARM_NONE;
+        d.why = POLICY_WHY_RULE;
+        d.version = Policy_Active()->version;
+    } else if (result->track_state == TRACK_STATE_ACTIVE) {
+        d.action = POLICY_ACT_PENDING;
+        d.bill = 0;
+        d.alarm = POLICY_ALARM_NONE;
+        d.why = POLICY_WHY_TRACKING;
+        d.version = Policy_Active()->version;
+    } else {
+        Policy_Decide(result->fused_class, result->fused_conf, &d);
+    }
+    result->action = d.action;
+    result->bill = d.bill;
+    result->alarm = d.alarm;
+    result->why = d.why;
+    result->policy_version = d.version;
+    result->reserved3 = 0;
+}
+
+static void ai_update_stats(uint32_t us) {
+    uint32_t now = HAL_GetTick();
+
+    stats.runs++;
+    stats.last_us = us;
+    if (stats.min_us == 0 || us < stats.min_us) stats.min_us = us;
+    if (us > stats.max_us) stats.max_us = us;
+    stats.avg_us = (stats.avg_us == 0) ? us : stats.avg_us - stats.avg_us / 8 + us / 8;
+
+    win_runs++;
+    if (now - win_start_tick >= 1000) {
+        stats.ips_x100 = win_runs * 100000U / (now - win_start_tick);
+        win_start_tick = now;
+        win_runs = 0;
+    }
+}
+
+/**
+ * @brief  在主模型输入张量中的缩略图上运行一个网络，并计入总体统计
+ */
+static int8_t ai_run_model(uint8_t id, AiResult_t *result) {
+    int8_t ret;
+
+    TRACE_BEGIN(TRACE_STAGE_AI_MODEL, id);
+    ret = AI_Model_Run(id, result);
+    TRACE_END(TRACE_STAGE_AI_MODEL, id);
+    if (ret != 0) {
+        stats.errors++;
+        return -1;
+    }
+    ai_update_stats(result->latency_us);
+#if AI_PROFILE_ENABLE
+    if (AI_Prof_Runs() >= AI_PROFILE_RUNS) {
+        AI_Prof_Dump();
+        AI_Prof_Reset();
+    }
+#endif
+    return 0;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  把主模型换绑到 Model_Bank_ReadBegin 给出的权重 (与当前相同时什么也不做)
+ * @note   远程更新提交后换到 B 区；Bank2 擦除期间退回出厂权重，擦完再换回。在两次推理之间、
+ *         持有激活区与读权重许可时调用 (ai_run_frame / AI_Validate_Poll)。只重新绑定各层权重
+ *         数组指针并按配置重新搬移热点层，不重建网络；停顿时间记入 stats.model_swap_us
+ * @retval 0: 已绑定; -1: 失败 (仍用原权重)
+ */
+int8_t AI_Inference_BindWeights(const uint8_t *weights, uint32_t version) {
+    uint32_t start;
+    uint8_t ok;
+
+    if (weights == ai_weights) return 0;
+    if (weights == NULL || ai_net == AI_HANDLE_NULL) return -1;
+
+    start = DWT->CYCCNT;
+    AI_Mem_ResetWeights();
+    ok = (AI_Model_SetWeights(AI_MODEL_VEHICLE, weights) == 0);
+    if (!ok) {
+        AI_Model_SetWeights(AI_MODEL_VEHICLE, ai_weights);
+    }
+    AI_Mem_Scan(ai_net);
+    AI_Mem_ApplyConfig(ai_net);
+
+    stats.model_swap_us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000U);
+    if (ok) {
+        ai_weights = weights;
+        stats.model_version = version;
+        stats.model_swaps++;
+    }
+    printf("[AI] weights %s v%ld, inference paused %ld us\r\n",
+           ok ? "switched to" : "NOT switched to", version, stats.model_swap_us);
+    return ok ? 0 : -1;
+}
+
+int8_t AI_Inference_Init(void) {
+    ai_cycle_counter_init();
+    Policy_Init();
+
+    /* 主模型权重取自 A/B 区中的活动区 (Bank2 正在擦除时先用出厂权重)；两区都无效时使用链接的权重 */
+    Model_Ota_Mount(NULL);
+    ai_weights = Model_Bank_ReadBegin(&stats.model_version);
+    Model_Bank_ReadEnd();
+    if (AI_Model_Init(AI_Mem_Activations(), ai_weights) != 0) {
+        ai_net = AI_HANDLE_NULL;
+        return -1;
+    }
+    ai_net = AI_Model_Net(AI_MODEL_VEHICLE);
+    ai_in_tensor = AI_Model_Input(AI_MODEL_VEHICLE);
+
+    /* 权重布局：统计逐层权重，按配置把热点层搬出 Flash */
+    AI_Mem_Scan(ai_net);
+#if AI_BENCH_ENABLE
+    AI_Bench_Run(ai_net, NULL);  /* 输入内容不影响计时，直接用输入张量现有内容 */
+#else
+    AI_Mem_ApplyConfig(ai_net);
+    AI_Mem_PrintPlan();
+#endif
+
+#if AI_PROFILE_ENABLE
+    AI_Prof_Start(ai_net);
+#endif
+#if AI_WAKE_ENABLE
+    wake_scratch = (uint16_t *)AI_Mem_Scratch(ai_in_tensor, AI_THUMB_SIZE, WAKE_SCRATCH_BYTES);
+    if (wake_scratch == NULL) printf("[AI] wake stage disabled: no room in activations\r\n");
+#endif
+    ai_lend_init();
+    Mem_Overlay_Lend();
+#if AI_VALIDATE_ENABLE
+    /* 验证模式：输入张量只由 AI_Validate 写入，不生成相机缩略图 */
+#else
+    /* 从下一帧起缩略图直接写入输入张量 */
+    Vision_Thumb_SetTarget(ai_in_tensor, AI_Model_InputLut(AI_MODEL_VEHICLE));
+#endif
+
+    win_start_tick = HAL_GetTick();
+    last_report_tick = win_start_tick;
+    printf("[AI] %s ready: in %dx%dx%d, %d classes, %d layers; %d net(s) on a %d B arena\r\n",
+           AI_VEHICLE_DETECTOR_MODEL_NAME, AI_VEHICLE_DETECTOR_IN_1_WIDTH, AI_VEHICLE_DETECTOR_IN_1_HEIGHT,
+           AI_VEHICLE_DETECTOR_IN_1_CHANNEL, AI_VEHICLE_DETECTOR_OUT_1_SIZE, AI_Mem_LayerCount(),
+           AI_Model_Count(), AI_MODEL_ARENA_SIZE);
+    return 0;
+}
+
+/**
+ * @brief  用主模型对一帧缩略图做一次推理
+ * @param  input: 已量化的 AI_THUMB_SIZE 字节 RGB 数据；通常就是 Vision_Thumb_Acquire
+ *         返回的输入张量本身 (零拷贝)，其他来源会先拷入输入张量
+ * @retval 0: 成功 (result 中 class_id/probs/latency_us 有效); -1: 失败
+ */
+int8_t AI_Inference_Run(const uint8_t *input, AiResult_t *result) {
+    if (ai_net == AI_HANDLE_NULL || input == NULL || result == NULL) return -1;
+
+    if (input != ai_in_tensor) {
+        memcpy(ai_in_tensor, input, AI_THUMB_SIZE);
+    }
+    return ai_run_model(AI_MODEL_VEHICLE, result);
+}
+
+/**
+ * @brief  按调度顺序推理 Vision_Thumb_Acquire 取得的一帧中的各裁切，逐条发布结果
+ * @param  input: Acquire 的返回值 (第 1 张裁切已在输入张量中)
+ * @retval 实际推理的裁切数
+ * @note   先经唤醒级联第一级判定整帧有目标，否则直接返回 0；再从 JPEG 收回外借的激活区，
+ *         AI_LEND_RECLAIM_MS 内未归还则本帧不推理 (计为 deadline miss)。
+ *         各裁切共用同一激活区与输入张量，依次载入、背靠背推理；每张裁切由 AI_Model_Pick
+ *         按份额选择网络，只有主模型的结果参与轨迹投票。按所选网络的平均耗时预估下一张
+ *         会超出 AI_FRAME_BUDGET_US 时放弃剩余裁切，与整帧实际超时一起计为一次 deadline miss；
+ *         并按 预算/平均耗时 限制 Vision 之后每帧生成的裁切数
+ */
+static uint8_t ai_run_frame(const uint8_t *input, uint32_t frame_id, uint32_t tick) {
+    const uint32_t cyc_per_us = SystemCoreClock / 1000000U;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t elapsed_us = 0;
+    uint8_t n = Vision_Thumb_Crops();
+    uint8_t i, done = 0, audit, hit = 0;
+    int8_t id;
+    const uint8_t *weights;
+    uint32_t version;
+    AiModelStats_t ms;
+    AiResult_t result;
+    VisionRect_t roi;
+    Track_t track;
+
+    if (input == NULL || n == 0) return 0;
+
+    if (!ai_wake_stage(&audit)) {
+        elapsed_us = (DWT->CYCCNT - start) / cyc_per_us;
+        stats.cpu_avg_us = (stats.cpu_avg_us == 0) ? elapsed_us : stats.cpu_avg_us - stats.cpu_avg_us / 8 + elapsed_us / 8;
+        return 0;
+    }
+    /* Bank2 正在擦除 (远程更新或证据日志轮换) 时拿到的是 Bank1 的出厂权重，推理照常进行 */
+    weights = Model_Bank_ReadBegin(&version);
+    if (weights == NULL) {
+        stats.frames++;
+        stats.model_erase_skips++;
+        return 0;
+    }
+    if (Mem_Overlay_Reclaim(AI_LEND_RECLAIM_MS) != 0) {
+        Model_Bank_ReadEnd();
+        stats.frames++;
+        stats.deadline_miss++;
+        return 0;
+    }
+    if (AI_Inference_BindWeights(weights, version) != 0) {
+        Model_Bank_ReadEnd();
+        stats.frames++;
+        stats.errors++;
+        return 0;
+    }
+
+    for (i = 0; i < n; i++) {
+        id = AI_Model_Pick();
+        if (id < 0) break;
+        if (i > 0) {
+            AI_Model_GetStats((uint8_t)id, &ms);
+            elapsed_us = (DWT->CYCCNT - start) / cyc_per_us;
+            if (elapsed_us + ms.avg_us > AI_FRAME_BUDGET_US) break;
+            input = Vision_Thumb_LoadCrop(i);
+            if (input == NULL) break;
+        }
+        if (ai_run_model((uint8_t)id, &result) != 0) continue;
+        if (id == AI_MODEL_VEHICLE && result.probs[result.class_id] >= AI_TRACK_CONF) hit = 1;
+
+        Vision_Thumb_GetRoi(i, &roi);
+        result.frame_id = frame_id;
+        result.capture_tick = tick;
+        result.crop_idx = i;
+        result.crop_count = n;
+        result.roi_x = roi.x;
+        result.roi_y = roi.y;
+        result.roi_side = roi.w;
+
+        /* 投给所属轨迹 (输出张量中仍是本次的概率)；判定后该车辆不再进入裁切候选 */
+        result.track_state = (id == AI_MODEL_VEHICLE) ?
+                             Vision_Thumb_Vote(i, AI_Model_Output(AI_MODEL_VEHICLE), &track) : TRACK_STATE_NONE;
+        if (result.track_state != TRACK_STATE_NONE) {
+            result.track_id = track.id;
+            result.fused_class = track.best;
+            result.fused_conf = track.score;
+            result.track_votes = track.votes;
+        } else {
+            result.track_id = 0;
+            result.fused_class = result.class_id;
+            result.fused_conf = result.probs[result.class_id];
+            result.track_votes = 0;
+        }
+        ai_apply_policy(&result);
+        AI_Inference_Publish(&result);
+        done++;
+    }
+    Model_Bank_ReadEnd();
+    elapsed_us = (DWT->CYCCNT - start) / cyc_per_us;
+
+    stats.frames++;
+    stats.crops += done;
+    stats.crops_last = done;
+    if (i < n || elapsed_us > AI_FRAME_BUDGET_US) stats.deadline_miss++;
+    stats.hits += hit;
+    if (audit && hit) stats.wake_misses++;
+    stats.cpu_avg_us = (stats.cpu_avg_us == 0) ? elapsed_us : stats.cpu_avg_us - stats.cpu_avg_us / 8 + elapsed_us / 8;
+
+    if (stats.avg_us != 0) {
+        uint32_t limit = AI_FRAME_BUDGET_US / stats.avg_us;
+        Vision_Thumb_SetCropLimit((uint8_t)((limit > AI_MAX_CROPS) ? AI_MAX_CROPS : limit));
+    }
+    return done;
+}
+
+uint8_t AI_Inference_RunFrame(const uint8_t *input, uint32_t frame_id, uint32_t tick) {
+    uint8_t done;
+
+    TRACE_BEGIN(TRACE_STAGE_AI_FRAME, frame_id);
+    done = ai_run_frame(input, frame_id, tick);
+    TRACE_END(TRACE_STAGE_AI_FRAME, frame_id);
+
+    Mem_Overlay_Lend();
+    return done;
+}
+
+/**
+ * @brief  发布一条结果并通知 Net 任务 (队列满时丢弃最旧的一条)
+ */
+void AI_Inference_Publish(const AiResult_t *result) {
+    NetEvent_t ev = { NET_EVT_RESULT, NULL, 0 };
+    uint8_t notify;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (result_count == AI_RESULT_QUEUE) {
+        result_head = (uint8_t)((result_head + 1) % AI_RESULT_QUEUE);
+        result_count--;
+        stats.dropped++;
+    }
+    result_q[(result_head + result_count) % AI_RESULT_QUEUE] = *result;
+    result_count++;
+    /* 上一条事件未被取空前不再投递：Net 任务取空时清标志，事件队列中最多一条结果事件 */
+    notify = !result_evt_pending && Q_Net_Handle != NULL;
+    if (notify) result_evt_pending = 1;
+    __set_PRIMASK(primask);
+
+    if (notify) {
+        ev.stamp = DWT->CYCCNT;
+        if (osMessageQueuePut(Q_Net_Handle, &ev, 0, 0) != osOK) {
+            result_evt_pending = 0;  /* 下一条结果重新投递 */
+            Net_Client_NoteEvtDrop();
+        }
+    }
+}
+
+/**
+ * @brief  按发布顺序取走一条结果 (Net 任务调用，NET_EVT_RESULT 只表示"有新结果"，需循环取空)
+ * @retval 0: 取到; -1: 队列为空 (同时允许投递下一条结果事件)
+ */
+int8_t AI_Inference_GetNext(AiResult_t *result) {
+    int8_t ret = -1;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (result_count > 0) {
+        *result = result_q[result_head];
+        result_head = (uint8_t)((result_head + 1) % AI_RESULT_QUEUE);
+        result_count--;
+        ret = 0;
+    } else {
+        result_evt_pending = 0;
+    }
+    __set_PRIMASK(primask);
+    return ret;
+}
+
+/**
+ * @brief  调整唤醒级联第一级的唤醒点数阈值 (调参用，调低减少漏检、调高减少推理)
+ * @note   同时决定唤醒与背景冻结 (Wake_Score 中有目标时背景更新放慢)，下一帧生效
+ */
+void AI_Inference_SetWakeThreshold(uint16_t min_points) {
+#if AI_WAKE_ENABLE
+    wake_cfg.min_points = min_points;   // 16 位对齐写入为原子操作，AI 任务每帧取快照
+#else
+    (void)min_points;
+#endif
+}
+
+void AI_Inference_GetStats(AiStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
+
+/**
+ * @brief  每 AI_REPORT_INTERVAL_MS 打印一次推理耗时与吞吐 (AI 任务调用)
+ */
+void AI_Inference_Report(void) {
+    uint32_t now = HAL_GetTick();
+    uint32_t cpf_x100 = (stats.frames == 0) ? 0 : (uint32_t)((uint64_t)stats.crops * 100U / stats.frames);
+    uint32_t created, decided, votes;
+    PolicyStats_t pol;
+    ModelBankStats_t bank;
+    OverlayStats_t ovl;
+
+    if (now - last_report_tick < AI_REPORT_INTERVAL_MS) return;
+    last_report_tick = now;
+    /* 周期报告走 LOG_I (二进制模式下每条最多 LOG_MAX_ARGS 个整数参数，超出的拆成多行) */
+    LOG_I("[AI] runs=%ld err=%ld latency us: last=%ld avg=%ld min=%ld max=%ld\r\n",
+          stats.runs, stats.errors, stats.last_us, stats.avg_us, stats.min_us, stats.max_us);
+    LOG_I("[AI] %ld.%02ld inf/s, roi frames=%ld\r\n", stats.ips_x100 / 100, stats.ips_x100 % 100, thumb_roi_frames);
+    LOG_I("[AI] frames=%ld crops/frame=%ld.%02ld (last %ld) deadline miss=%ld dropped=%ld strip late=%ld\r\n",
+          stats.frames, cpf_x100 / 100, cpf_x100 % 100, stats.crops_last, stats.deadline_miss, stats.dropped,
+          strip_late);
+#if AI_WAKE_ENABLE
+    LOG_I("[AI] wake stage1 %ld/%ld pass (%ld us, last %d pts, thr %d), audits=%ld missed=%ld\r\n",
+          stats.wake_pass, stats.wake_frames, stats.wake_avg_us, stats.wake_points_last, wake_cfg.min_points,
+          stats.wake_audits, stats.wake_misses);
+    LOG_I("[AI] wake stage2 %ld/%ld hit; cpu/frame avg %ld us\r\n", stats.hits, stats.frames, stats.cpu_avg_us);
+#endif
+    Policy_GetStats(&pol);
+    LOG_I("[AI] policy v%d: local=%ld escalated=%ld offline=%ld max %ld cycles, reloads=%ld rejected=%ld\r\n",
+          Policy_Active()->version, pol.local, pol.escalated, pol.offline, pol.max_cycles, pol.reloads, pol.rejected);
+    Model_Bank_GetStats(&bank);
+    LOG_I("[AI] model v%ld slot %c gen %ld: swaps=%ld last pause %ld us\r\n",
+          stats.model_version, 'A' + (char)bank.active, bank.generation, stats.model_swaps, stats.model_swap_us);
+    LOG_I("[AI] model updates=%ld resumes=%ld rejected=%ld built-in fallbacks=%ld erase skips=%ld\r\n",
+          bank.updates, bank.resumes, bank.rejected, bank.fallback_reads, stats.model_erase_skips);
+    if (bank.receiving) LOG_I("[AI] model rx v%ld %ld/%ld B\r\n", bank.rx_version, bank.rx_done, bank.rx_size);
+    for (uint8_t id = 0; AI_Model_Count() > 1 && id < AI_Model_Count(); id++) {
+        AiModelStats_t ms;
+        AI_Model_GetStats(id, &ms);
+        /* 带模型名 (%s)，二进制模式不支持，保留 printf (仅多模型时每周期几行) */
+        printf("[AI] net %d %s: runs=%ld err=%ld avg %ld us\r\n", id, AI_Model_Name(id), ms.runs, ms.errors, ms.avg_us);
+    }
+    Mem_Overlay_GetStats(&ovl);
+    LOG_I("[AI] arena lend: phase %d lent %d, reclaims=%ld (waited %ld, max %ld ms) timeouts=%ld\r\n",
+          ovl.phase, ovl.lent, ovl.reclaims, ovl.reclaim_waits, ovl.max_wait_ms, ovl.timeouts);
+    LOG_I("[AI] arena lend: jpeg frames=%ld; stale=%ld guard=%ld poison=%ld\r\n",
+          jpeg_lent_frames, ovl.stale, ovl.guard_errors, ovl.poison_errors);
+    Vision_Track_GetStats(&created, &decided, &votes);
+    LOG_I("[AI] tracks=%ld decided=%ld votes=%ld skipped frames=%ld\r\n", created, decided, votes, thumb_track_skips);
+}
@@ -0,0 +1,280 @@
+#include "AI_Mem.h"
+#include "AI_Model.h"
+#include "app_config.h"
+#include "main.h"
+#include "ai_platform_interface.h"
+#include "vehicle_detector.h"
+#include "vehicle_detector_data.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 区域与缓冲                               */
+/* ========================================== */
+/*
+ * 激活区按 AI_ACT_REGION 静态链接到 AXI 或 DTCM；放不下时链接阶段直接报错。
+ * 所有注册网络 (AI_Model) 分时共用这一块，大小取各网络需求的最大值。
+ * 权重整体留在 Flash (4 等待周期，经 D-Cache)，热点层的权重/偏置数组在初始化后
+ * 拷入 ITCM/DTCM/AXI 权重池，并改写其 ai_array 指针 (与生成代码
+ * vehicle_detector_configure_weights 绑定 Flash 地址的方式相同)。
+ * 各层权重在 Flash 中连续，逐数组搬移即可，不需要重新生成模型。
+ */
+#if AI_ACT_REGION == AI_MEM_DTCM
+DTCM_SECTION IVCIS_ALIGN_32 static uint8_t ai_activations[AI_MODEL_ARENA_SIZE];
+#else
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t ai_activations[AI_MODEL_ARENA_SIZE];
+#endif
+
+/* 权重池只在实际使用 (或基准模式) 时占用内存 */
+#define POOL_USED(r)  (AI_BENCH_ENABLE || AI_WEIGHTS_HOT_REGION == (r))
+
+#if POOL_USED(AI_MEM_ITCM)
+ITCM_SECTION IVCIS_ALIGN_32 static uint8_t pool_itcm[AI_ITCM_POOL_SIZE];
+#endif
+#if POOL_USED(AI_MEM_DTCM) && AI_ACT_REGION != AI_MEM_DTCM
+DTCM_SECTION IVCIS_ALIGN_32 static uint8_t pool_dtcm[AI_DTCM_POOL_SIZE];
+#endif
+#if POOL_USED(AI_MEM_AXI)
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t pool_axi[AI_AXI_POOL_SIZE];
+#endif
+
+/* 被搬移的数组及其 Flash 原址，用于恢复 */
+#define MAX_MOVED   (AI_MEM_MAX_LAYERS * 2)
+
+typedef struct {
+    ai_array *arr;
+    ai_ptr flash_data;
+    uint16_t c_idx;
+} Moved_t;
+
+static AiLayerMem_t layers[AI_MEM_MAX_LAYERS];
+static uint16_t layer_count = 0;
+static Moved_t moved[MAX_MOVED];
+static uint16_t moved_count = 0;
+static uint32_t pool_used[4] = {0};
+
+extern uint8_t _Min_Heap_Size[], _Min_Stack_Size[];  /* 链接脚本符号 (取地址即数值) */
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static uint8_t *pool_base(uint8_t region) {
+    switch (region) {
+#if POOL_USED(AI_MEM_ITCM)
+    case AI_MEM_ITCM: return pool_itcm;
+#endif
+#if POOL_USED(AI_MEM_DTCM) && AI_ACT_REGION != AI_MEM_DTCM
+    case AI_MEM_DTCM: return pool_dtcm;
+#endif
+#if POOL_USED(AI_MEM_AXI)
+    case AI_MEM_AXI:  return pool_axi;
+#endif
+    default:          return NULL;
+    }
+}
+
+static uint8_t is_flash(ai_ptr p) {
+    return ((uint32_t)p >= FLASH_BANK1_BASE && (uint32_t)p < FLASH_BANK1_BASE + FLASH_SIZE);
+}
+
+/**
+ * @brief  取节点的参数张量表 (权重、偏置等常量)，无参数层返回 NULL
+ */
+static const ai_tensor_list *weights_of(ai_handle net, uint16_t c_idx, ai_observer_node *node) {
+    node->c_idx = c_idx;
+    if (!ai_platform_observer_node_info(net, node) || node->tensors == NULL) return NULL;
+    if (node->tensors->size <= AI_TENSOR_CHAIN_WEIGHTS) return NULL;
+    return &node->tensors->chain[AI_TENSOR_CHAIN_WEIGHTS];
+}
+
+static uint32_t array_bytes(const ai_array *arr) {
+    return (uint32_t)ai_array_get_byte_size(arr->format, arr->size);
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+ai_handle AI_Mem_Activations(void) {
+    return AI_HANDLE_PTR(ai_activations);
+}
+
+/**
+ * @brief  借用激活区中输入张量以外的部分作为推理前的临时工作区 (如唤醒级联第一级)
+ * @param  in/in_size: 位于激活区内的输入张量 (其内容推理前不能被破坏)
+ * @retval 32 字节对齐的工作区；放不下时返回 NULL
+ * @note   工作区内容在下一次推理时被覆盖，只能在推理之间使用
+ */
+void *AI_Mem_Scratch(const uint8_t *in, uint32_t in_size, uint32_t size) {
+    const AiMemSpan_t keep = { in, in_size };
+
+    return AI_Mem_Carve(&keep, 1, size);
+}
+
+/**
+ * @brief  在激活区中找一段不与给定区间重叠的空间 (首次适配)
+ * @param  keep/n_keep: 推理之间仍在使用、不能被覆盖的区间，激活区外的区间不影响结果
+ * @retval 32 字节对齐的起始地址；放不下时返回 NULL
+ * @note   与 AI_Mem_Scratch 相同，所得空间只能在推理之间使用
+ */
+void *AI_Mem_Carve(const AiMemSpan_t *keep, uint8_t n_keep, uint32_t size) {
+    uint8_t *p = ai_activations;
+    uint8_t *end = ai_activations + sizeof(ai_activations);
+    uint8_t moved = 1;
+
+    while (moved) {
+        moved = 0;
+        if (p > end || size > (uint32_t)(end - p)) return NULL;
+        for (uint8_t i = 0; i < n_keep; i++) {
+            if (keep[i].base < p + size && keep[i].base + keep[i].size > p) {
+                p = (uint8_t *)(((uint32_t)(keep[i].base + keep[i].size) + 31U) & ~31U);
+                moved = 1;
+            }
+        }
+    }
+    return p;
+}
+
+const char *AI_Mem_RegionName(uint8_t region) {
+    static const char *const names[] = { "FLASH", "ITCM", "DTCM", "AXI" };
+    return (region < 4) ? names[region] : "?";
+}
+
+/**
+ * @brief  遍历网络节点，统计每层权重字节数 (网络初始化后调用一次)
+ */
+int8_t AI_Mem_Scan(ai_handle net) {
+    ai_observer_node node;
+
+    memset(layers, 0, sizeof(layers));
+    layer_count = 0;
+    for (uint16_t i = 0; i < AI_MEM_MAX_LAYERS; i++) {
+        node.c_idx = i;
+        if (!ai_platform_observer_node_info(net, &node)) break;
+        layers[i].type = node.type;
+        layers[i].region = AI_MEM_FLASH;
+        layer_count = i + 1;
+
+        const ai_tensor_list *wl = weights_of(net, i, &node);
+        if (wl == NULL) continue;
+        for (uint16_t k = 0; k < wl->size; k++) {
+            ai_tensor *t = wl->tensor[k];
+            if (t == NULL || t->data == NULL || !is_flash(t->data->data)) continue;
+            layers[i].weight_bytes += array_bytes(t->data);
+            layers[i].n_arrays++;
+        }
+    }
+    return (layer_count > 0) ? 0 : -1;
+}
+
+uint16_t AI_Mem_LayerCount(void) {
+    return layer_count;
+}
+
+const AiLayerMem_t *AI_Mem_Layer(uint16_t c_idx) {
+    return (c_idx < layer_count) ? &layers[c_idx] : NULL;
+}
+
+uint32_t AI_Mem_PoolSize(uint8_t region) {
+    if (pool_base(region) == NULL) return 0;
+    switch (region) {
+    case AI_MEM_ITCM: return AI_ITCM_POOL_SIZE;
+    case AI_MEM_DTCM: return AI_DTCM_POOL_SIZE;
+    case AI_MEM_AXI:  return AI_AXI_POOL_SIZE;
+    default:          return 0;
+    }
+}
+
+/**
+ * @brief  把指定层的权重拷入 region 的权重池并改写数组指针
+ * @note   按列表顺序装填，池满的层跳过；不能在推理过程中调用
+ * @retval 本次搬移的字节数
+ */
+uint32_t AI_Mem_PlaceWeights(ai_handle net, const uint16_t *list, uint16_t n, uint8_t region) {
+    uint8_t *base = pool_base(region);
+    uint32_t size = AI_Mem_PoolSize(region);
+    uint32_t total = 0;
+    ai_observer_node node;
+
+    if (base == NULL) return 0;
+
+    for (uint16_t j = 0; j < n; j++) {
+        uint16_t c = list[j];
+        if (c >= layer_count || layers[c].weight_bytes == 0 || layers[c].region != AI_MEM_FLASH) continue;
+        /* 按 8 字节对齐逐数组摆放，先确认整层放得下 */
+        uint32_t need = layers[c].weight_bytes + 8U * layers[c].n_arrays;
+        if (pool_used[region] + need > size || moved_count + layers[c].n_arrays > MAX_MOVED) continue;
+
+        const ai_tensor_list *wl = weights_of(net, c, &node);
+        if (wl == NULL) continue;
+        for (uint16_t k = 0; k < wl->size; k++) {
+            ai_tensor *t = wl->tensor[k];
+            if (t == NULL || t->data == NULL || !is_flash(t->data->data)) continue;
+            ai_array *arr = t->data;
+            uint32_t bytes = array_bytes(arr);
+            uint8_t *dst = base + ((pool_used[region] + 7U) & ~7U);
+
+            memcpy(dst, arr->data, bytes);
+            moved[moved_count].arr = arr;
+            moved[moved_count].flash_data = arr->data;
+            moved[moved_count].c_idx = c;
+            moved_count++;
+            arr->data = AI_PTR(dst);
+            arr->data_start = AI_PTR(dst);
+            pool_used[region] = (uint32_t)(dst - base) + bytes;
+            total += bytes;
+        }
+        layers[c].region = region;
+    }
+    return total;
+}
+
+/**
+ * @brief  所有权重指回 Flash，清空权重池
+ */
+void AI_Mem_ResetWeights(void) {
+    for (uint16_t i = 0; i < moved_count; i++) {
+        moved[i].arr->data = moved[i].flash_data;
+        moved[i].arr->data_start = moved[i].flash_data;
+        layers[moved[i].c_idx].region = AI_MEM_FLASH;
+    }
+    moved_count = 0;
+    memset(pool_used, 0, sizeof(pool_used));
+}
+
+/**
+ * @brief  按 app_config.h 的热点层列表搬移权重 (AI_Inference_Init 调用)
+ */
+void AI_Mem_ApplyConfig(ai_handle net) {
+#if defined(AI_WEIGHTS_HOT_LAYERS) && AI_WEIGHTS_HOT_REGION != AI_MEM_FLASH
+    static const uint16_t hot[] = AI_WEIGHTS_HOT_LAYERS;
+    uint32_t bytes = AI_Mem_PlaceWeights(net, hot, sizeof(hot) / sizeof(hot[0]), AI_WEIGHTS_HOT_REGION);
+    printf("[AI] hot weights: %d layers, %ld B -> %s\r\n", (int)(sizeof(hot) / sizeof(hot[0])),
+           bytes, AI_Mem_RegionName(AI_WEIGHTS_HOT_REGION));
+#else
+    (void)net;
+#endif
+}
+
+/**
+ * @brief  打印当前布局与各区域余量 (启动时/基准模式调用)
+ */
+void AI_Mem_PrintPlan(void) {
+    uint32_t dtcm_reserved = (uint32_t)_Min_Heap_Size + (uint32_t)_Min_Stack_Size;
+    uint32_t dtcm_free = 128U * 1024U - dtcm_reserved;
+
+    printf("[AIMEM] activations %d B in %s @0x%08lX\r\n", AI_MODEL_ARENA_SIZE,
+           AI_Mem_RegionName(AI_ACT_REGION), (uint32_t)ai_activations);
+    printf("[AIMEM] DTCM: %ld B after heap/stack (%ld B) -> activations %s",
+           dtcm_free, dtcm_reserved,
+           (dtcm_free >= AI_MODEL_ARENA_SIZE) ? "fit" : "do NOT fit");
+    if (dtcm_free < AI_MODEL_ARENA_SIZE) {
+        printf(" (short %ld B)", AI_MODEL_ARENA_SIZE - dtcm_free);
+    }
+    printf("\r\n[AIMEM] weights %d B in FLASH, pools: ITCM %ld/%ld DTCM %ld/%ld AXI %ld/%ld\r\n",
+           AI_VEHICLE_DETECTOR_DATA_WEIGHTS_SIZE,
+           pool_used[AI_MEM_ITCM], AI_Mem_PoolSize(AI_MEM_ITCM),
+           pool_used[AI_MEM_DTCM], AI_Mem_PoolSize(AI_MEM_DTCM),
+           pool_used[AI_MEM_AXI], AI_Mem_PoolSize(AI_MEM_AXI));
+}
@@ -0,0 +1,284 @@
+#include "AI_Model.h"
+#include "app_config.h"
+#include "main.h"
+#include "vehicle_detector.h"
+#include "vehicle_detector_data.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 注册表                                   */
+/* ========================================== */
+/*
+ * 新增网络：用 X-CUBE-AI 生成代码后在 model_table 末尾追加一条，并把其激活区大小并入
+ * AI_MODEL_ARENA_SIZE。输入须与缩略图同为 AI_THUMB_SIZE 字节的 U8 张量、输出为 float，
+ * 不满足的网络在初始化时被停用 (主模型除外，主模型不满足则初始化失败)。
+ */
+static const AiModelDesc_t model_table[] = {
+    { AI_VEHICLE_DETECTOR_MODEL_NAME,
+      ai_vehicle_detector_create_and_init, ai_vehicle_detector_inputs_get, ai_vehicle_detector_outputs_get,
+      ai_vehicle_detector_run, ai_vehicle_detector_get_error,
+      ai_vehicle_detector_data_params_get, ai_vehicle_detector_init,
+      AI_VEHICLE_DETECTOR_DATA_ACTIVATIONS_SIZE, AI_MODEL_VEHICLE_SHARE },
+    /* 黑名单目标 (行人/拖拉机/三轮) 等专用网络生成后在此追加 */
+};
+
+#define MODEL_COUNT   ((uint8_t)(sizeof(model_table) / sizeof(model_table[0])))
+#define MODEL_STRIDE  0x10000U   /* 调度步长基数：每运行一次，虚拟时间前进 MODEL_STRIDE / share */
+
+_Static_assert(sizeof(model_table) / sizeof(model_table[0]) <= AI_MODEL_MAX, "too many models");
+_Static_assert(AI_VEHICLE_DETECTOR_DATA_ACTIVATIONS_SIZE <= AI_MODEL_ARENA_SIZE, "arena smaller than a model");
+
+/* 每个网络的运行时绑定 */
+typedef struct {
+    ai_handle  net;
+    ai_buffer *in;
+    ai_buffer *out;
+    uint8_t   *in_tensor;     // 激活区内的输入张量
+    uint16_t   n_out;         // 取用的输出个数 (<= AI_NUM_CLASSES)
+    uint8_t    share;
+    uint8_t    identity;      // requant 为恒等映射，搬入后无需重映射
+    uint32_t   pass;          // 调度虚拟时间
+    uint8_t    lut[256];      // 8bit 像素值 -> 本网络输入量化值
+    uint8_t    requant[256];  // 主模型输入量化值 -> 本网络输入量化值
+    AiModelStats_t stats;
+} AiModel_t;
+
+static AiModel_t models[MODEL_COUNT];
+static ai_handle arena = AI_HANDLE_NULL;
+static uint32_t vtime = 0;    // 最近一次运行时的虚拟时间
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+/**
+ * @brief  按输入张量的量化参数生成像素查找表 (q = round(v / scale) + zp)
+ * @note   vehicle_detector 为 QLinear(1.0, 0)，查找表即恒等映射
+ */
+static void model_build_lut(uint8_t id, AiModel_t *m) {
+    float scale = 1.0f;
+    int32_t zp = 0;
+
+    if (AI_BUFFER_META_INFO_INTQ(m->in[0].meta_info) != NULL) {
+        scale = AI_BUFFER_META_INFO_INTQ_GET_SCALE(m->in[0].meta_info, 0);
+        zp = AI_BUFFER_META_INFO_INTQ_GET_ZEROPOINT(m->in[0].meta_info, 0);
+        if (scale <= 0.0f) scale = 1.0f;
+    }
+    for (uint32_t v = 0; v < 256; v++) {
+        int32_t q = (int32_t)((float)v / scale + 0.5f) + zp;
+        m->lut[v] = (uint8_t)((q < 0) ? 0 : (q > 255) ? 255 : q);
+    }
+    printf("[AI] %s input quant: scale=%ld/1000 zp=%ld\r\n",
+           model_table[id].name, (int32_t)(scale * 1000.0f), zp);
+}
+
+/**
+ * @brief  生成主模型量化值到本网络量化值的映射 (主模型查找表多对一时取较大像素值)
+ */
+static void model_build_requant(AiModel_t *m) {
+    const uint8_t *primary = models[AI_MODEL_VEHICLE].lut;
+
+    m->identity = 1;
+    for (uint32_t v = 0; v < 256; v++) {
+        m->requant[primary[v]] = m->lut[v];
+    }
+    for (uint32_t q = 0; q < 256; q++) {
+        if (m->requant[q] != q) m->identity = 0;
+    }
+}
+
+/**
+ * @brief  创建一个网络并检查其输入/输出能否与缩略图、结果结构对接
+ * @retval 0: 可用; -1: 不可用 (已打印原因)
+ */
+static int8_t model_create(uint8_t id, const uint8_t *weights) {
+    const AiModelDesc_t *d = &model_table[id];
+    AiModel_t *m = &models[id];
+    const ai_handle acts[] = { arena };
+    const ai_handle w[] = { AI_HANDLE_PTR(weights) };
+    ai_error err;
+
+    if (d->act_size > AI_MODEL_ARENA_SIZE) {
+        printf("[AI] %s needs %ld B activations > arena %d B\r\n", d->name, d->act_size, AI_MODEL_ARENA_SIZE);
+        return -1;
+    }
+    err = d->create_and_init(&m->net, acts, (weights != NULL) ? w : NULL);
+    if (err.type != AI_ERROR_NONE) {
+        printf("[AI] %s init failed: type=%d code=%d\r\n", d->name, err.type, err.code);
+        m->net = AI_HANDLE_NULL;
+        return -1;
+    }
+    m->in = d->inputs_get(m->net, NULL);
+    m->out = d->outputs_get(m->net, NULL);
+    if (m->in == NULL || m->out == NULL || m->in[0].data == NULL ||
+        AI_BUFFER_BYTE_SIZE(AI_BUFFER_SIZE(&m->in[0]), m->in[0].format) != AI_THUMB_SIZE ||
+        AI_BUFFER_FMT_GET_TYPE(m->out[0].format) != AI_BUFFER_FMT_TYPE_FLOAT) {
+        printf("[AI] %s: I/O does not match the %d B thumbnail / float output\r\n", d->name, AI_THUMB_SIZE);
+        m->net = AI_HANDLE_NULL;
+        return -1;
+    }
+    m->in_tensor = (uint8_t *)m->in[0].data;
+    m->n_out = (uint16_t)AI_BUFFER_SIZE(&m->out[0]);
+    if (m->n_out > AI_NUM_CLASSES) m->n_out = AI_NUM_CLASSES;
+    m->share = d->share;
+    model_build_lut(id, m);
+    if (id != AI_MODEL_VEHICLE) model_build_requant(m);
+    return 0;
+}
+
+/**
+ * @brief  把主模型输入张量中的缩略图搬入本网络的输入张量 (各网络输入在激活区内位置不同)
+ */
+static void model_bind_input(AiModel_t *m) {
+    const uint8_t *src = models[AI_MODEL_VEHICLE].in_tensor;
+
+    if (m->in_tensor != src) memmove(m->in_tensor, src, AI_THUMB_SIZE);
+    if (!m->identity) {
+        for (uint32_t i = 0; i < AI_THUMB_SIZE; i++) {
+            m->in_tensor[i] = m->requant[m->in_tensor[i]];
+        }
+    }
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  在共享激活区上创建所有注册网络
+ * @param  arena: AI_Mem_Activations()，大小为 AI_MODEL_ARENA_SIZE
+ * @param  primary_weights: 主模型权重 (A/B 区中的活动区)，NULL 表示使用链接的权重
+ * @retval 0: 主模型可用; -1: 主模型创建失败 (其他网络失败只停用该网络)
+ */
+int8_t AI_Model_Init(ai_handle act, const uint8_t *primary_weights) {
+    memset(models, 0, sizeof(models));
+    arena = act;
+    vtime = 0;
+
+    for (uint8_t id = 0; id < MODEL_COUNT; id++) {
+        if (model_create(id, (id == AI_MODEL_VEHICLE) ? primary_weights : NULL) != 0) {
+            if (id == AI_MODEL_VEHICLE) return -1;
+            continue;
+        }
+        printf("[AI] net %d %s: %ld B activations, share %d\r\n",
+               id, model_table[id].name, model_table[id].act_size, models[id].share);
+    }
+    return 0;
+}
+
+uint8_t AI_Model_Count(void) {
+    return MODEL_COUNT;
+}
+
+const char *AI_Model_Name(uint8_t id) {
+    return (id < MODEL_COUNT) ? model_table[id].name : "?";
+}
+
+ai_handle AI_Model_Net(uint8_t id) {
+    return (id < MODEL_COUNT) ? models[id].net : AI_HANDLE_NULL;
+}
+
+uint8_t *AI_Model_Input(uint8_t id) {
+    return (id < MODEL_COUNT && models[id].net != AI_HANDLE_NULL) ? models[id].in_tensor : NULL;
+}
+
+const uint8_t *AI_Model_InputLut(uint8_t id) {
+    return (id < MODEL_COUNT) ? models[id].lut : NULL;
+}
+
+/**
+ * @brief  最近一次运行的输出 (float，至少 AI_Model_Run 填入 probs 的个数)
+ */
+const float *AI_Model_Output(uint8_t id) {
+    return (id < MODEL_COUNT && models[id].net != AI_HANDLE_NULL) ? (const float *)models[id].out[0].data : NULL;
+}
+
+/**
+ * @brief  把网络重新绑定到另一份权重 (远程更新切换)，激活区不变，不重建网络
+ * @retval 0: 成功; -1: 失败 (网络状态未定义，调用方应绑回旧权重)
+ */
+int8_t AI_Model_SetWeights(uint8_t id, const uint8_t *weights) {
+    ai_network_params params;
+
+    if (id >= MODEL_COUNT || models[id].net == AI_HANDLE_NULL || weights == NULL) return -1;
+    if (!model_table[id].params_get(&params)) return -1;
+    AI_BUFFER_ARRAY_ITEM_SET_ADDRESS(&params.map_activations, 0, arena);
+    AI_BUFFER_ARRAY_ITEM_SET_ADDRESS(&params.map_weights, 0, AI_HANDLE_PTR(weights));
+    return model_table[id].init(models[id].net, &params) ? 0 : -1;
+}
+
+/**
+ * @brief  调度：为下一张裁切选择网络 (按份额做步长调度，只查询不计账)
+ * @retval 网络编号; -1: 没有可用网络
+ * @note   虚拟时间在 AI_Model_Run 实际运行时才推进，因预算放弃的裁切不占份额
+ */
+int8_t AI_Model_Pick(void) {
+    int8_t best = -1;
+
+    for (uint8_t id = 0; id < MODEL_COUNT; id++) {
+        if (models[id].net == AI_HANDLE_NULL || models[id].share == 0) continue;
+        if (best < 0 || (int32_t)(models[id].pass - models[best].pass) < 0) best = (int8_t)id;
+    }
+    return best;
+}
+
+/**
+ * @brief  调整网络的调度份额 (0: 停用)；重新启用时从当前虚拟时间起算，不补偿停用期间
+ */
+void AI_Model_SetShare(uint8_t id, uint8_t share) {
+    if (id >= MODEL_COUNT) return;
+    if (models[id].share == 0 && share != 0) models[id].pass = vtime;
+    models[id].share = share;
+}
+
+/**
+ * @brief  运行一个网络，填写 result 的 model_id/class_id/probs/latency_us
+ * @note   输入为主模型输入张量中的当前缩略图；其他网络先搬入各自的输入张量。
+ *         所有网络共用激活区，运行后主模型输入张量的内容不再有效
+ * @retval 0: 成功; -1: 失败
+ */
+int8_t AI_Model_Run(uint8_t id, AiResult_t *result) {
+    const uint32_t cyc_per_us = SystemCoreClock / 1000000U;
+    AiModel_t *m;
+    uint32_t start, us;
+    ai_i32 batches;
+
+    if (id >= MODEL_COUNT || models[id].net == AI_HANDLE_NULL || result == NULL) return -1;
+    m = &models[id];
+
+    start = DWT->CYCCNT;
+    if (id != AI_MODEL_VEHICLE) model_bind_input(m);
+    batches = model_table[id].run(m->net, &m->in[0], &m->out[0]);
+    us = (DWT->CYCCNT - start) / cyc_per_us;
+
+    vtime = m->pass;
+    m->pass += MODEL_STRIDE / ((m->share != 0) ? m->share : 1U);
+    if (batches != 1) {
+        ai_error err = model_table[id].get_error(m->net);
+        m->stats.errors++;
+        printf("[AI] %s run failed: type=%d code=%d\r\n", model_table[id].name, err.type, err.code);
+        return -1;
+    }
+
+    const float *probs = (const float *)m->out[0].data;
+    uint8_t best = 0;
+    for (uint16_t i = 0; i < AI_NUM_CLASSES; i++) {
+        result->probs[i] = (i < m->n_out) ? probs[i] : 0.0f;
+        if (i < m->n_out && probs[i] > probs[best]) best = (uint8_t)i;
+    }
+    result->class_id = best;
+    result->model_id = id;
+    result->latency_us = us;
+
+    m->stats.runs++;
+    m->stats.last_us = us;
+    m->stats.avg_us = (m->stats.avg_us == 0) ? us : m->stats.avg_us - m->stats.avg_us / 8 + us / 8;
+    return 0;
+}
+
+void AI_Model_GetStats(uint8_t id, AiModelStats_t *out) {
+    if (out != NULL && id < MODEL_COUNT) {
+        *out = models[id].stats;
+    }
+}
@@ -0,0 +1,138 @@
+#include "AI_Profiler.h"
+#include "app_config.h"
+#include "main.h"
+#include "ai_platform_interface.h"
+#include "vehicle_detector.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 层名表与统计                             */
+/* ========================================== */
+/*
+ * 运行时 observer 在每个 c-node 执行前后回调，回调里读 DWT->CYCCNT 计时。
+ * 层名按 c_id 顺序取自 vehicle_detector_generate_report.txt 的
+ * "Number of operations per c-layer" 表，重新生成模型后需同步更新。
+ * 计时包含 observer 分派本身的少量开销 (每层约数十周期)。
+ */
+static const char *const layer_names[] = {
+    "conversion_0", "conv2d_1", "conv2d_2_pad_before", "conv2d_2", "conv2d_3", "conv2d_4",
+    "conv2d_6_pad_before", "conv2d_6", "conv2d_7", "conv2d_8", "conv2d_9_pad_before", "conv2d_9",
+    "conv2d_10", "eltwise_11", "conv2d_12", "conv2d_14_pad_before", "conv2d_14", "conv2d_15",
+    "conv2d_16", "conv2d_17_pad_before", "conv2d_17", "conv2d_18", "eltwise_19", "conv2d_20",
+    "conv2d_21_pad_before", "conv2d_21", "conv2d_22", "eltwise_23", "conv2d_24",
+    "conv2d_26_pad_before", "conv2d_26", "conv2d_27", "conv2d_28", "conv2d_29_pad_before",
+    "conv2d_29", "conv2d_30", "eltwise_31", "conv2d_32", "conv2d_33_pad_before", "conv2d_33",
+    "conv2d_34", "eltwise_35", "conv2d_36", "conv2d_37_pad_before", "conv2d_37", "conv2d_38",
+    "eltwise_39", "conv2d_40", "conv2d_41_pad_before", "conv2d_41", "conv2d_42", "conv2d_43",
+    "conv2d_44_pad_before", "conv2d_44", "conv2d_45", "eltwise_46", "conv2d_47",
+    "conv2d_48_pad_before", "conv2d_48", "conv2d_49", "eltwise_50", "conv2d_51",
+    "conv2d_53_pad_before", "conv2d_53", "conv2d_54", "conv2d_55", "conv2d_56_pad_before",
+    "conv2d_56", "conv2d_57", "eltwise_58", "conv2d_59", "conv2d_60_pad_before", "conv2d_60",
+    "conv2d_61", "eltwise_62", "conv2d_63", "conv2d_64_pad_before", "conv2d_64", "conv2d_65",
+    "conv2d_66", "pool_67", "gemm_68", "nl_69", "conversion_70"
+};
+_Static_assert(sizeof(layer_names) / sizeof(layer_names[0]) == AI_VEHICLE_DETECTOR_N_NODES,
+               "layer name table out of sync with the generated network");
+
+#define N_LAYERS    AI_VEHICLE_DETECTOR_N_NODES
+
+static AiLayerProf_t prof[N_LAYERS];
+static AiLayerProf_t prof_total;        /* 整网 (各层之和) */
+static uint32_t runs = 0;
+static uint32_t node_start = 0;
+static uint32_t run_cycles = 0;
+
+/* ========================================== */
+/* 2. observer 回调 (AI 任务上下文)             */
+/* ========================================== */
+
+static void prof_add(AiLayerProf_t *p, uint32_t cycles) {
+    if (p->sum == 0 || cycles < p->min) p->min = cycles;
+    if (cycles > p->max) p->max = cycles;
+    p->sum += cycles;
+}
+
+static ai_u32 prof_node_cb(const ai_handle cookie, const ai_u32 flags, const ai_observer_node *node) {
+    uint32_t now = DWT->CYCCNT;
+
+    if (flags & AI_OBSERVER_PRE_EVT) {
+        if ((flags & AI_OBSERVER_FIRST_EVT) || node->c_idx == 0) run_cycles = 0;
+        node_start = now;
+    } else if (flags & AI_OBSERVER_POST_EVT) {
+        uint32_t cycles = now - node_start;
+        if (node->c_idx < N_LAYERS) prof_add(&prof[node->c_idx], cycles);
+        run_cycles += cycles;
+        if ((flags & AI_OBSERVER_LAST_EVT) || node->c_idx == N_LAYERS - 1) {
+            prof_add(&prof_total, run_cycles);
+            runs++;
+        }
+    }
+    return 0;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  注册 observer 并清零统计；之后每次 ai_vehicle_detector_run 都会被逐层计时
+ */
+int8_t AI_Prof_Start(ai_handle net) {
+    AI_Prof_Reset();
+    if (!ai_platform_observer_register(net, prof_node_cb, AI_HANDLE_NULL,
+                                       AI_OBSERVER_PRE_EVT | AI_OBSERVER_POST_EVT)) {
+        printf("[AIPROF] observer register failed\r\n");
+        return -1;
+    }
+    return 0;
+}
+
+void AI_Prof_Stop(ai_handle net) {
+    ai_platform_observer_unregister(net, prof_node_cb, AI_HANDLE_NULL);
+}
+
+void AI_Prof_Reset(void) {
+    memset(prof, 0, sizeof(prof));
+    memset(&prof_total, 0, sizeof(prof_total));
+    runs = 0;
+}
+
+uint32_t AI_Prof_Runs(void) {
+    return runs;
+}
+
+const AiLayerProf_t *AI_Prof_Layer(uint16_t c_idx) {
+    return (c_idx < N_LAYERS) ? &prof[c_idx] : NULL;
+}
+
+uint32_t AI_Prof_LayerAvg(uint16_t c_idx) {
+    return (c_idx < N_LAYERS && runs > 0) ? (uint32_t)(prof[c_idx].sum / runs) : 0;
+}
+
+const char *AI_Prof_LayerName(uint16_t c_idx) {
+    return (c_idx < N_LAYERS) ? layer_names[c_idx] : "?";
+}
+
+/**
+ * @brief  以 CSV 打印逐层 min/avg/max 周期与占比 (行首 "AIPROF," 便于 grep)
+ * @note   Tools/ai_profile_report.py 可把它与生成报告的 MACC 对照
+ */
+void AI_Prof_Dump(void) {
+    uint32_t mhz = SystemCoreClock / 1000000U;
+    uint64_t total_avg;
+
+    if (runs == 0) return;
+    total_avg = prof_total.sum / runs;
+    printf("AIPROF,c_id,name,runs,min_cyc,avg_cyc,max_cyc,pct_x100\r\n");
+    for (uint16_t c = 0; c < N_LAYERS; c++) {
+        uint32_t avg = (uint32_t)(prof[c].sum / runs);
+        printf("AIPROF,%d,%s,%ld,%ld,%ld,%ld,%ld\r\n", c, layer_names[c], runs,
+               prof[c].min, avg, prof[c].max,
+               (uint32_t)(total_avg ? (uint64_t)avg * 10000U / total_avg : 0));
+    }
+    printf("AIPROF,total,%s,%ld,%ld,%ld,%ld,10000\r\n", AI_VEHICLE_DETECTOR_MODEL_NAME, runs,
+           prof_total.min, (uint32_t)total_avg, prof_total.max);
+    printf("[AIPROF] %ld runs @%ld MHz: avg %ld us (min %ld, max %ld)\r\n", runs, mhz,
+           (uint32_t)(total_avg / mhz), prof_total.min / mhz, prof_total.max / mhz);
+}
@@ -0,0 +1,208 @@
+#include "AI_Validate.h"
+#include "AI_Model.h"
+#include "AI_Inference.h"
+#include "Model_Bank.h"
+#include "Mem_Overlay.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include "lwip/udp.h"
+#include "lwip/tcpip.h"
+#include "vehicle_detector.h"
+#include <string.h>
+#include <stdio.h>
+
+#if AI_VALIDATE_ENABLE
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/*
+ * 分片在 tcpip 线程中拷入暂存区，RUN 到达后置 busy 并唤醒 AI 任务；AI 任务收回激活区后
+ * 每次推理前把暂存区经输入查找表写入输入张量 (与相机缩略图路径相同的像素量化；输入张量
+ * 位于激活区，推理会覆盖它)，只对 ai_vehicle_detector_run 本身计时。
+ * 此模式下不生成相机缩略图，输入张量只由本模块写入。
+ */
+_Static_assert(AI_VAL_CHUNKS <= 32, "missing bitmap is 32 bits");
+_Static_assert(AI_THUMB_SIZE == AI_VEHICLE_DETECTOR_IN_1_SIZE_BYTES, "validation input must match model input");
+
+#define VAL_ALL_CHUNKS  ((AI_VAL_CHUNKS == 32) ? 0xFFFFFFFFU : ((1U << AI_VAL_CHUNKS) - 1U))
+
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t val_input[AI_THUMB_SIZE];
+static struct udp_pcb *val_pcb = NULL;
+static uint16_t rx_vec = 0xFFFF;
+static uint32_t rx_have = 0;            // 已收分片位图
+static volatile uint8_t busy = 0;       // 已受理 RUN，AI 任务尚未回复
+static uint16_t req_vec, req_loops;
+static ip_addr_t req_addr;
+static u16_t req_port;
+static float first_out[AI_NUM_CLASSES];
+
+extern osSemaphoreId_t Sem_AI_Handle;
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+/**
+ * @brief  发送结果 (tcpip 线程中直接调用；任务中调用须持核心锁)
+ */
+static void val_send(const AiValResult_t *res, const ip_addr_t *addr, u16_t port) {
+    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, sizeof(*res), PBUF_RAM);
+
+    if (p == NULL) return;
+    memcpy(p->payload, res, sizeof(*res));
+    udp_sendto(val_pcb, p, addr, port);
+    pbuf_free(p);
+}
+
+static void val_reply_status(uint16_t vec, uint8_t status, const ip_addr_t *addr, u16_t port) {
+    AiValResult_t res;
+
+    memset(&res, 0, sizeof(res));
+    res.magic = AI_VAL_MAGIC_RES;
+    res.vec = vec;
+    res.status = status;
+    res.missing = (vec == rx_vec) ? (VAL_ALL_CHUNKS & ~rx_have) : VAL_ALL_CHUNKS;
+    val_send(&res, addr, port);
+}
+
+/**
+ * @brief  接收回调 (tcpip 线程)
+ */
+static void val_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port) {
+    AiValData_t hdr;
+    AiValRun_t run;
+
+    if (p->tot_len >= sizeof(hdr) && pbuf_copy_partial(p, &hdr, sizeof(hdr), 0) == sizeof(hdr)) {
+        if (hdr.magic == AI_VAL_MAGIC_DATA && !busy && hdr.chunk < AI_VAL_CHUNKS) {
+            uint32_t off = (uint32_t)hdr.chunk * AI_VAL_CHUNK;
+            uint32_t len = (AI_THUMB_SIZE - off < AI_VAL_CHUNK) ? AI_THUMB_SIZE - off : AI_VAL_CHUNK;
+            if (hdr.vec != rx_vec) {
+                rx_vec = hdr.vec;
+                rx_have = 0;
+            }
+            if (p->tot_len == sizeof(hdr) + len &&
+                pbuf_copy_partial(p, val_input + off, (u16_t)len, sizeof(hdr)) == len) {
+                rx_have |= 1U << hdr.chunk;
+            }
+        } else if (hdr.magic == AI_VAL_MAGIC_RUN && p->tot_len == sizeof(run)) {
+            pbuf_copy_partial(p, &run, sizeof(run), 0);
+            if (busy) {
+                val_reply_status(run.vec, AI_VAL_BUSY, addr, port);
+            } else if (run.vec != rx_vec || rx_have != VAL_ALL_CHUNKS) {
+                val_reply_status(run.vec, AI_VAL_MISSING, addr, port);
+            } else {
+                req_vec = run.vec;
+                req_loops = (run.loops == 0) ? 1 : (run.loops > AI_VALIDATE_MAX_LOOPS) ? AI_VALIDATE_MAX_LOOPS : run.loops;
+                ip_addr_copy(req_addr, *addr);
+                req_port = port;
+                busy = 1;
+                osSemaphoreRelease(Sem_AI_Handle);
+            }
+        }
+    }
+    pbuf_free(p);
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  在 AI_VALIDATE_PORT 上监听 (Net 任务在网络就绪后调用)
+ */
+int8_t AI_Validate_Init(void) {
+    LOCK_TCPIP_CORE();
+    val_pcb = udp_new();
+    if (val_pcb != NULL) {
+        udp_bind(val_pcb, IP_ADDR_ANY, AI_VALIDATE_PORT);
+        udp_recv(val_pcb, val_recv, NULL);
+    }
+    UNLOCK_TCPIP_CORE();
+    if (val_pcb == NULL) return -1;
+    printf("[AIVAL] validation mode: UDP %d, %d x %d B chunks, up to %d loops\r\n",
+           AI_VALIDATE_PORT, AI_VAL_CHUNKS, AI_VAL_CHUNK, AI_VALIDATE_MAX_LOOPS);
+    return 0;
+}
+
+/**
+ * @brief  执行已受理的验证请求 (AI 任务调用，无请求时立即返回)
+ */
+void AI_Validate_Poll(void) {
+    ai_handle net = AI_Model_Net(AI_MODEL_VEHICLE);
+    uint8_t *tensor = AI_Model_Input(AI_MODEL_VEHICLE);
+    const uint8_t *lut = AI_Model_InputLut(AI_MODEL_VEHICLE);
+    ai_buffer *in, *out;
+    AiValResult_t res;
+    AiStats_t ai;
+    uint64_t total = 0;
+    const uint8_t *weights = NULL;
+    uint32_t version = 0;
+
+    if (!busy) return;
+
+    memset(&res, 0, sizeof(res));
+    res.magic = AI_VAL_MAGIC_RES;
+    res.vec = req_vec;
+    res.stable = 1;
+    res.cpu_hz = SystemCoreClock;
+    AI_Inference_GetStats(&ai);
+    res.model_version = ai.model_version;
+
+    if (net != AI_HANDLE_NULL && tensor != NULL && lut != NULL) weights = Model_Bank_ReadBegin(&version);
+    if (weights == NULL) {
+        Model_Bank_ReadEnd();
+        res.status = AI_VAL_BUSY;   /* 无权重可读，上位机稍后重发 */
+    } else if (Mem_Overlay_Reclaim(AI_LEND_RECLAIM_MS) != 0) {
+        Model_Bank_ReadEnd();
+        res.status = AI_VAL_BUSY;
+    } else if (AI_Inference_BindWeights(weights, version) != 0) {
+        Mem_Overlay_Lend();
+        Model_Bank_ReadEnd();
+        res.status = AI_VAL_BUSY;
+    } else {
+        res.model_version = version;  /* Bank2 擦除期间为出厂权重 (v0) */
+        in = ai_vehicle_detector_inputs_get(net, NULL);
+        out = ai_vehicle_detector_outputs_get(net, NULL);
+        res.n_out = AI_NUM_CLASSES;
+        for (uint16_t r = 0; r < req_loops; r++) {
+            uint32_t start, cyc;
+            for (uint32_t i = 0; i < AI_THUMB_SIZE; i++) tensor[i] = lut[val_input[i]];
+            start = DWT->CYCCNT;
+            if (ai_vehicle_detector_run(net, &in[0], &out[0]) != 1) {
+                res.status = AI_VAL_FAILED;
+                break;
+            }
+            cyc = DWT->CYCCNT - start;
+            if (r == 0) {
+                res.cyc_first = res.cyc_min = res.cyc_max = cyc;
+                memcpy(first_out, out[0].data, sizeof(first_out));
+            } else {
+                if (cyc < res.cyc_min) res.cyc_min = cyc;
+                if (cyc > res.cyc_max) res.cyc_max = cyc;
+                if (memcmp(first_out, out[0].data, sizeof(first_out)) != 0) res.stable = 0;
+            }
+            total += cyc;
+            res.loops = r + 1;
+        }
+        if (res.loops > 0) {
+            res.cyc_avg = (uint32_t)(total / res.loops);
+            memcpy(res.out, out[0].data, sizeof(res.out));
+            for (uint8_t i = 1; i < AI_NUM_CLASSES; i++) {
+                if (res.out[i] > res.out[res.class_id]) res.class_id = i;
+            }
+        }
+        Mem_Overlay_Lend();
+        Model_Bank_ReadEnd();
+    }
+
+    printf("[AIVAL] vec %d: status %d, %d loops, cycles first=%ld min=%ld avg=%ld max=%ld%s\r\n",
+           res.vec, res.status, res.loops, res.cyc_first, res.cyc_min, res.cyc_avg, res.cyc_max,
+           res.stable ? "" : " (outputs differ between loops)");
+    LOCK_TCPIP_CORE();
+    val_send(&res, &req_addr, req_port);
+    UNLOCK_TCPIP_CORE();
+    busy = 0;
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include "Boot_Timing.h"
+#include "app_config.h"
+#include <stdio.h>
+
+static uint32_t marks[BOOT_MS_COUNT];
+static volatile uint8_t marked[BOOT_MS_COUNT];  // 各里程碑由不同任务写入，按字节分开避免读改写竞争
+static uint8_t reported = 0;
+
+/**
+ * @brief  记录里程碑 (只记第一次)
+ */
+void Boot_Mark(BootMilestone_t m) {
+    if (m >= BOOT_MS_COUNT || marked[m]) return;
+    marks[m] = HAL_GetTick();
+    marked[m] = 1;
+}
+
+uint32_t Boot_GetMark(BootMilestone_t m) {
+    return (m < BOOT_MS_COUNT && marked[m]) ? marks[m] : 0xFFFFFFFFUL;
+}
+
+/**
+ * @brief  第一帧发出后打印一次启动时间线，未到达的里程碑显示为 -
+ */
+void Boot_Timing_Report(const char *addr_src) {
+    static const char * const names[BOOT_MS_COUNT] = {
+        "main", "sched", "cam", "link", "ip", "jpeg", "tx"
+    };
+
+    if (reported || !marked[BOOT_FIRST_TX]) return;
+    reported = 1;
+
+    printf("[BOOT]");
+    for (uint32_t i = 0; i < BOOT_MS_COUNT; i++) {
+        if (marked[i]) {
+            printf(" %s=%lu", names[i], marks[i]);
+        } else {
+            printf(" %s=-", names[i]);
+        }
+    }
+    printf(" ms (addr: %s)\r\n", (addr_src != NULL) ? addr_src : "?");
+}
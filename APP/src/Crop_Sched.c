@@ -0,0 +1,78 @@
+#include "Crop_Sched.h"
+#include <stddef.h>
+
+/* ========================================== */
+/* 1. 候选评分                                 */
+/* ========================================== */
+
+/* 新颖度 (Q8)：256 减去与历史裁切的最大 IoU */
+static uint16_t novelty(const CropSchedHist_t *hist, const VisionRect_t *sq) {
+    uint16_t best = 0;
+
+    for (uint8_t i = 0; i < hist->n; i++) {
+        uint16_t iou = Vision_Roi_IoU(&hist->sq[i], sq);
+        if (iou > best) best = iou;
+    }
+    return (uint16_t)(256U - best);
+}
+
+static void hist_push(CropSchedHist_t *hist, const VisionRect_t *sq) {
+    hist->sq[hist->head] = *sq;
+    hist->head = (uint8_t)((hist->head + 1) % CROP_HIST_LEN);
+    if (hist->n < CROP_HIST_LEN) hist->n++;
+}
+
+/* ========================================== */
+/* 2. 调度                                     */
+/* ========================================== */
+
+/**
+ * @brief  为一帧挑选要推理的裁切正方形 (帧首调用)
+ * @param  boxes: 运动框 (像素坐标)
+ * @param  crops: 输出，按得分从高到低
+ * @param  src: 输出，各裁切来自 boxes 的下标 (可为 NULL)
+ * @param  limit: 最多输出的裁切数
+ * @retval 裁切数 (无运动框时为 0，由调用方退回默认裁切)
+ * @note   得分 = 运动框面积 x (1 + gain x 新颖度)，面积用原始运动框而非扩展后的正方形，
+ *         避免被 min_side 抬高的小目标与大目标同分。选中的裁切计入历史
+ */
+uint8_t Crop_Sched_Plan(const CropSchedCfg_t *cfg, CropSchedHist_t *hist,
+                        const VisionRect_t *boxes, uint8_t n_boxes, VisionRect_t *crops, uint8_t *src, uint8_t limit) {
+    VisionRect_t sq[CROP_MAX_CANDS];
+    uint32_t score[CROP_MAX_CANDS];
+    uint8_t n = 0;
+
+    if (n_boxes > CROP_MAX_CANDS) n_boxes = CROP_MAX_CANDS;
+    for (uint8_t i = 0; i < n_boxes; i++) {
+        uint32_t area = ((uint32_t)boxes[i].w * boxes[i].h) >> 8;
+        Vision_Roi_Fit(&boxes[i], cfg->frame_w, cfg->frame_h, cfg->margin_pct, cfg->min_side, &sq[i]);
+        score[i] = (area + 1U) * (256U + cfg->novelty_gain * novelty(hist, &sq[i]));
+    }
+
+    /* 按得分依次选取，与已选裁切重叠过多的候选视为同一目标 (选择排序，候选很少) */
+    while (n < limit) {
+        int8_t best = -1;
+        for (uint8_t i = 0; i < n_boxes; i++) {
+            if (score[i] != 0 && (best < 0 || score[i] > score[best])) best = (int8_t)i;
+        }
+        if (best < 0) break;
+        score[best] = 0;
+
+        uint8_t dup = 0;
+        for (uint8_t j = 0; j < n; j++) {
+            if (Vision_Roi_IoU(&crops[j], &sq[best]) > cfg->merge_iou) {
+                dup = 1;
+                break;
+            }
+        }
+        if (!dup) {
+            if (src != NULL) src[n] = (uint8_t)best;
+            crops[n++] = sq[best];
+        }
+    }
+
+    for (uint8_t j = 0; j < n; j++) {
+        hist_push(hist, &crops[j]);
+    }
+    return n;
+}
@@ -0,0 +1,162 @@
+#include "Defer_Work.h"
+#include "Trace.h"
+#include "Log.h"
+#include "app_config.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/*
+ * 有界多生产者单消费者队列：每格带序号，生产者 CAS 抢占写位置、填好后发布序号，
+ * 工作任务按序号取出。不同优先级的中断可以互相嵌套投递，全程不关中断；
+ * 低优先级中断抢到位置尚未发布时，工作任务在该格停下，等该中断发布后的通知再继续。
+ */
+#define DEFER_MASK   (DEFER_QUEUE_LEN - 1U)
+#define DEFER_FLAG   0x0001U
+
+_Static_assert((DEFER_QUEUE_LEN & DEFER_MASK) == 0, "DEFER_QUEUE_LEN must be a power of 2");
+
+typedef struct {
+    volatile uint32_t seq;    // == 位置: 空闲可写; == 位置 + 1: 已发布可取
+    DeferFn_t fn;
+    uint32_t a;
+    uint32_t b;
+    uint32_t stamp;           // 投递时的 DWT->CYCCNT
+} DeferCell_t;
+
+static DeferCell_t cells[DEFER_QUEUE_LEN];
+static volatile uint32_t enq_pos = 0;   // 生产者 (中断) 共享
+static uint32_t deq_pos = 0;            // 仅工作任务
+static osThreadId_t worker = NULL;
+static DeferStats_t stats = {0};
+static uint32_t last_report_tick = 0;
+
+/* ========================================== */
+/* 2. 中断侧接口                               */
+/* ========================================== */
+
+/**
+ * @brief  投递一项延后工作 (中断中调用，不关中断，耗时固定)
+ * @retval 0: 已投递; -1: 队列满，丢弃
+ */
+int8_t Defer_Post(DeferFn_t fn, uint32_t a, uint32_t b) {
+    uint32_t pos = enq_pos;
+    DeferCell_t *c;
+
+    for (;;) {
+        c = &cells[pos & DEFER_MASK];
+        int32_t dif = (int32_t)(c->seq - pos);
+        if (dif == 0) {
+            if (__atomic_compare_exchange_n(&enq_pos, &pos, pos + 1U, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+        } else if (dif < 0) {
+            __atomic_fetch_add(&stats.dropped, 1U, __ATOMIC_RELAXED);
+            return -1;
+        } else {
+            pos = enq_pos;
+        }
+    }
+    c->fn = fn;
+    c->a = a;
+    c->b = b;
+    c->stamp = DWT->CYCCNT;
+    __atomic_store_n(&c->seq, pos + 1U, __ATOMIC_RELEASE);
+
+    __atomic_fetch_add(&stats.posted, 1U, __ATOMIC_RELAXED);
+    if (pos + 1U - deq_pos > stats.depth_max) stats.depth_max = pos + 1U - deq_pos;
+    TRACE_COUNTER(TRACE_CNT_DEFER, pos + 1U - deq_pos);
+    if (worker != NULL) osThreadFlagsSet(worker, DEFER_FLAG);
+    return 0;
+}
+
+/**
+ * @brief  记录一次中断回调的耗时 (回调末尾调用)
+ * @param  start: 回调入口处的 DEFER_ISR_ENTER()
+ */
+void Defer_IsrExit(DeferIsr_t isr, uint32_t start) {
+    uint32_t cyc = DWT->CYCCNT - start;
+
+    stats.isr_calls[isr]++;
+    if (cyc > stats.isr_max_cyc[isr]) stats.isr_max_cyc[isr] = cyc;
+}
+
+/* ========================================== */
+/* 3. 工作任务接口                             */
+/* ========================================== */
+
+/**
+ * @brief  绑定工作任务 (Task_Camera 启动时、打开 DCMI 之前调用)，并打开 DWT 周期计数器
+ */
+int8_t Defer_Init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;  /* M7 需先解锁 DWT */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint32_t i = 0; i < DEFER_QUEUE_LEN; i++) cells[i].seq = i;
+    worker = osThreadGetId();
+    last_report_tick = HAL_GetTick();
+    return (worker != NULL) ? 0 : -1;
+}
+
+/**
+ * @brief  等待并依次执行已投递的工作 (工作任务循环调用)
+ * @param  timeout_ms: 无工作时最长等待
+ */
+void Defer_Run(uint32_t timeout_ms) {
+    uint32_t cyc_per_us = SystemCoreClock / 1000000U;
+
+    osThreadFlagsWait(DEFER_FLAG, osFlagsWaitAny, timeout_ms);
+    for (;;) {
+        DeferCell_t *c = &cells[deq_pos & DEFER_MASK];
+        DeferFn_t fn;
+        uint32_t a, b, wait_us;
+
+        if (__atomic_load_n(&c->seq, __ATOMIC_ACQUIRE) != deq_pos + 1U) break;
+        fn = c->fn;
+        a = c->a;
+        b = c->b;
+        wait_us = (DWT->CYCCNT - c->stamp) / cyc_per_us;
+        __atomic_store_n(&c->seq, deq_pos + DEFER_QUEUE_LEN, __ATOMIC_RELEASE);
+        deq_pos++;
+
+        if (wait_us > stats.wait_max_us) stats.wait_max_us = wait_us;
+        fn(a, b);
+        stats.done++;
+    }
+}
+
+void Defer_GetStats(DeferStats_t *out) {
+    if (out != NULL) *out = stats;
+}
+
+/**
+ * @brief  每 DEFER_REPORT_INTERVAL_MS 打印一次队列统计与各中断回调的最坏耗时 (工作任务调用)
+ */
+void Defer_Report(void) {
+    uint32_t cyc_per_us = SystemCoreClock / 1000000U;
+    uint32_t now = HAL_GetTick();
+    uint32_t x100[DEFER_ISR_COUNT];   /* 各回调最坏耗时 (0.01 us) */
+    const uint32_t *n = stats.isr_calls;
+
+    _Static_assert(DEFER_ISR_COUNT == 5, "update the ISR lines in Defer_Report");
+
+    if (now - last_report_tick < DEFER_REPORT_INTERVAL_MS) return;
+    last_report_tick = now;
+    for (uint8_t i = 0; i < DEFER_ISR_COUNT; i++) {
+        x100[i] = stats.isr_max_cyc[i] * 100U / cyc_per_us;
+    }
+    /* 回调名写在格式串里 (二进制模式不支持 %s)，每条不超过 LOG_MAX_ARGS 个参数 */
+    LOG_I("[DEFER] posted=%ld done=%ld dropped=%ld depth max %ld, wait max %ld us\r\n",
+          stats.posted, stats.done, stats.dropped, stats.depth_max, stats.wait_max_us);
+    LOG_I("[DEFER] ISR worst us: dma_half %ld.%02ld (%ld) dma_full %ld.%02ld (%ld)\r\n",
+          x100[DEFER_ISR_DMA_HALF] / 100, x100[DEFER_ISR_DMA_HALF] % 100, n[DEFER_ISR_DMA_HALF],
+          x100[DEFER_ISR_DMA_FULL] / 100, x100[DEFER_ISR_DMA_FULL] % 100, n[DEFER_ISR_DMA_FULL]);
+    LOG_I("[DEFER] ISR worst us: jpeg_in %ld.%02ld (%ld) jpeg_out %ld.%02ld (%ld)\r\n",
+          x100[DEFER_ISR_JPEG_IN] / 100, x100[DEFER_ISR_JPEG_IN] % 100, n[DEFER_ISR_JPEG_IN],
+          x100[DEFER_ISR_JPEG_OUT] / 100, x100[DEFER_ISR_JPEG_OUT] % 100, n[DEFER_ISR_JPEG_OUT]);
+    LOG_I("[DEFER] ISR worst us: jpeg_done %ld.%02ld (%ld)\r\n",
+          x100[DEFER_ISR_JPEG_DONE] / 100, x100[DEFER_ISR_JPEG_DONE] % 100, n[DEFER_ISR_JPEG_DONE]);
+}
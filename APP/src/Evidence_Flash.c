@@ -0,0 +1,65 @@
+#include "Evidence_Log.h"
+#include "Model_Bank.h"
+#include "Hw_Crc.h"
+#include "app_config.h"
+#include "cmsis_os.h"
+
+/* ========================================== */
+/* 片上 Flash 实现 (HAL)                       */
+/* ========================================== */
+/*
+ * 日志格式与挂载/追加逻辑在 Evidence_Log.c (不依赖 HAL)，这里只提供扇区擦除、
+ * Flash 字编程与 CRC。日志区位置见 app_config.h 的 EVID_*，与链接脚本 EVIDENCE 区一致。
+ * 日志区与模型 B 区同在 Bank2：擦除前经 Model_Bank_EraseBegin 等正在读 B 区的那次推理结束
+ * (此后的推理改用 Bank1 的出厂权重)，擦完 EraseEnd，推理在下一帧回到 B 区。
+ */
+
+static int8_t hal_flash_erase(uint32_t sector) {
+    FLASH_EraseInitTypeDef erase = {0};
+    uint32_t sector_error = 0;
+    HAL_StatusTypeDef st;
+
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Banks = EVID_FLASH_BANK;
+    erase.Sector = EVID_FIRST_SECTOR + sector;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+    while (Model_Bank_EraseBegin() != 0) {
+        osDelay(1);   /* 最多等一帧推理 */
+    }
+    HAL_FLASH_Unlock();
+    st = HAL_FLASHEx_Erase(&erase, &sector_error);
+    HAL_FLASH_Lock();
+    Model_Bank_EraseEnd();
+    /* Flash 映射区可被 D-Cache 缓存，擦写后必须作废对应缓存行 */
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(EVID_FLASH_BASE + sector * EVID_SECTOR_SIZE), EVID_SECTOR_SIZE);
+    return (st == HAL_OK) ? 0 : -1;
+}
+
+static int8_t hal_flash_program(uint32_t offset, const uint8_t *src32) {
+    HAL_StatusTypeDef st;
+
+    HAL_FLASH_Unlock();
+    st = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, EVID_FLASH_BASE + offset, (uint32_t)src32);
+    HAL_FLASH_Lock();
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(EVID_FLASH_BASE + offset), 32);
+    return (st == HAL_OK) ? 0 : -1;
+}
+
+static uint32_t hal_crc(const uint8_t *p, uint32_t len) {
+    return Hw_Crc_Calc(p, len);
+}
+
+static const EvidFlashOps_t hal_flash_ops = {
+    .base = (const uint8_t *)EVID_FLASH_BASE,
+    .sector_size = EVID_SECTOR_SIZE,
+    .sector_count = EVID_SECTOR_COUNT,
+    .erase = hal_flash_erase,
+    .program = hal_flash_program,
+    .crc = hal_crc,
+};
+
+const EvidFlashOps_t *Evidence_Flash_Ops(void) {
+    return &hal_flash_ops;
+}
@@ -0,0 +1,391 @@
+#include "Evidence_Log.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. 日志格式                                 */
+/* ========================================== */
+/*
+ * 日志区由 sector_count 个扇区组成环形日志，只追加、整扇区回收：
+ *
+ *   扇区: [扇区头 32B][记录][记录]...[0xFF 擦除态]
+ *   记录: [记录头 32B][负载, 32B 补齐][提交字 32B]
+ *
+ * - H7 的 Flash 以 256bit (32B) 为编程单位且每个 Flash 字只能写一次，
+ *   因此所有结构都按 32B 对齐，提交字单独占一个 Flash 字。
+ * - 记录头带 CRC，先写头、再写负载、最后写提交字；断电残缺的记录没有
+ *   提交字，挂载时按头里的长度整体跳过。
+ * - 扇区头记录擦除次数与扇区内首条记录序号，挂载只需读 N 个扇区头即可
+ *   确定活动扇区；环形轮转本身保证各扇区均匀磨损。
+ * - 上传游标以 ACK 记录的形式追加在日志里，复位后取最大值恢复。
+ * - 注意：若断电恰好发生在某个 Flash 字编程过程中，读取该字可能触发
+ *   ECC 双错误，此类情况由 HardFault 复位兜底，本模块不做处理。
+ */
+#define FW_SIZE            32U
+#define FW_ALIGN(x)        (((x) + FW_SIZE - 1U) & ~(FW_SIZE - 1U))
+#define SECT_MAGIC         0x48535645UL  /* "EVSH" */
+#define REC_MAGIC          0x43525645UL  /* "EVRC" */
+#define COMMIT_MAGIC       0x4B4F5645UL  /* "EVOK" */
+#define ERASED_WORD        0xFFFFFFFFUL
+
+typedef struct {
+    uint32_t magic;
+    uint32_t erase_count;
+    uint32_t first_seq;
+    uint32_t crc;            /* 前 12 字节的 CRC */
+    uint32_t pad[4];
+} SectHdr_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t type;
+    uint16_t reserved;
+    uint32_t seq;
+    uint32_t len;
+    uint32_t frame_id;
+    uint32_t data_crc;
+    uint32_t hdr_crc;        /* 前 24 字节的 CRC */
+    uint32_t pad;
+} EvRecHdr_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t pad[6];
+} EvCommit_t;
+
+static const EvidFlashOps_t *flash = NULL;
+static EvidStats_t stats = {0};
+static uint32_t rd_sector = 0;   // 上传游标所在扇区/偏移
+static uint32_t rd_off = 0;
+static uint32_t ack_pending = 0; // 已上传但尚未落盘游标的条数
+static uint32_t sect_erase_cnt[EVID_MAX_SECTORS];
+static uint8_t fw_buf[FW_SIZE] __attribute__((aligned(32))); // Flash 字编程暂存 (保证源地址对齐)
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static uint32_t evid_crc(const void *p, uint32_t len) {
+    return flash->crc((const uint8_t *)p, len);
+}
+
+static inline uint32_t sect_base(uint32_t sector) {
+    return sector * flash->sector_size;
+}
+
+static inline const SectHdr_t *sect_hdr(uint32_t sector) {
+    return (const SectHdr_t *)(flash->base + sect_base(sector));
+}
+
+static inline const EvRecHdr_t *rec_hdr(uint32_t sector, uint32_t off) {
+    return (const EvRecHdr_t *)(flash->base + sect_base(sector) + off);
+}
+
+static uint8_t sect_valid(uint32_t sector) {
+    const SectHdr_t *h = sect_hdr(sector);
+    return (h->magic == SECT_MAGIC && h->crc == evid_crc(h, 12)) ? 1 : 0;
+}
+
+static inline uint32_t rec_footprint(uint32_t len) {
+    return FW_SIZE + FW_ALIGN(len) + FW_SIZE;
+}
+
+/**
+ * @brief  解析 off 处的记录
+ * @retval 1: 完整记录; 0: 残缺记录(可按长度跳过); -1: 擦除态(扇区数据结束); -2: 头损坏
+ */
+static int8_t rec_check(uint32_t sector, uint32_t off) {
+    const EvRecHdr_t *h;
+    const EvCommit_t *c;
+
+    if (off + FW_SIZE > flash->sector_size) return -1;
+    h = rec_hdr(sector, off);
+    if (h->magic == ERASED_WORD) return -1;
+    if (h->magic != REC_MAGIC || h->hdr_crc != evid_crc(h, 24)) return -2;
+    if (off + rec_footprint(h->len) > flash->sector_size) return -2;
+
+    c = (const EvCommit_t *)((const uint8_t *)h + FW_SIZE + FW_ALIGN(h->len));
+    return (c->magic == COMMIT_MAGIC && c->seq == h->seq) ? 1 : 0;
+}
+
+/**
+ * @brief  解析 *off 处的记录，写记录头时掉电留下的半个头跳过一个 Flash 字
+ * @note   半个头之后紧跟擦除态 (挂载后从下一个 Flash 字继续写) 或有效记录时才跳过；
+ *         否则无法得知长度，仍按头损坏返回
+ */
+static int8_t rec_at(uint32_t sector, uint32_t *off) {
+    int8_t r = rec_check(sector, *off);
+
+    if (r == -2) {
+        int8_t next = rec_check(sector, *off + FW_SIZE);
+        if (next != -2) {
+            *off += FW_SIZE;
+            r = next;
+        }
+    }
+    return r;
+}
+
+/**
+ * @brief  以 32B 为单位把 src 写到 offset (尾部不足一字的部分用 0xFF 填充)
+ */
+static int8_t program_bytes(uint32_t offset, const uint8_t *src, uint32_t len) {
+    uint32_t done = 0;
+
+    while (done < len) {
+        uint32_t n = (len - done > FW_SIZE) ? FW_SIZE : (len - done);
+        memset(fw_buf, 0xFF, FW_SIZE);
+        memcpy(fw_buf, src + done, n);
+        if (flash->program(offset + done, fw_buf) != 0) return -1;
+        done += FW_SIZE;
+    }
+    return 0;
+}
+
+static void update_wear_stats(void) {
+    stats.erase_min = 0xFFFFFFFFUL;
+    stats.erase_max = 0;
+    for (uint32_t s = 0; s < flash->sector_count; s++) {
+        if (sect_erase_cnt[s] < stats.erase_min) stats.erase_min = sect_erase_cnt[s];
+        if (sect_erase_cnt[s] > stats.erase_max) stats.erase_max = sect_erase_cnt[s];
+    }
+}
+
+/**
+ * @brief  擦除并格式化一个扇区作为新的活动扇区
+ */
+static int8_t open_sector(uint32_t sector) {
+    SectHdr_t h;
+
+    if (flash->erase(sector) != 0) {
+        stats.write_errors++;
+        return -1;
+    }
+    sect_erase_cnt[sector]++;
+
+    memset(&h, 0xFF, sizeof(h));
+    h.magic = SECT_MAGIC;
+    h.erase_count = sect_erase_cnt[sector];
+    h.first_seq = stats.next_seq;
+    h.crc = evid_crc(&h, 12);
+    if (program_bytes(sect_base(sector), (const uint8_t *)&h, sizeof(h)) != 0) {
+        stats.write_errors++;
+        return -1;
+    }
+
+    stats.active_sector = sector;
+    stats.write_off = FW_SIZE;
+    update_wear_stats();
+    return 0;
+}
+
+/**
+ * @brief  活动扇区写满：回收最旧扇区 (环形下一个)，统计其中未上传的记录
+ */
+static int8_t rotate_sector(void) {
+    uint32_t next = (stats.active_sector + 1) % flash->sector_count;
+
+    if (sect_valid(next)) {
+        uint32_t off = FW_SIZE;
+        while (rec_at(next, &off) >= 0) {
+            const EvRecHdr_t *h = rec_hdr(next, off);
+            if (h->type != EVID_REC_ACK && h->seq > stats.acked_seq) {
+                stats.lost_unsent++;
+            }
+            off += rec_footprint(h->len);
+        }
+    }
+    if (rd_sector == next) {
+        rd_sector = (next + 1) % flash->sector_count;
+        rd_off = FW_SIZE;
+    }
+    return open_sector(next);
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  挂载日志：读扇区头定位活动扇区，跳读记录头恢复序号与上传游标
+ * @param  ops: Flash 操作表 (板端为 Evidence_Flash_Ops())
+ * @retval 0: 成功; -1: 操作表无效或格式化失败
+ */
+int8_t Evidence_Log_Mount(const EvidFlashOps_t *ops) {
+    uint32_t oldest = 0, min_seq = 0xFFFFFFFFUL, max_seq = 0;
+    int8_t found = 0;
+
+    if (ops == NULL || ops->sector_count < 2 || ops->sector_count > EVID_MAX_SECTORS) return -1;
+    flash = ops;
+    memset(&stats, 0, sizeof(stats));
+    stats.next_seq = 1;
+    ack_pending = 0;
+
+    for (uint32_t s = 0; s < flash->sector_count; s++) {
+        sect_erase_cnt[s] = 0;
+        if (!sect_valid(s)) continue;
+        const SectHdr_t *h = sect_hdr(s);
+        sect_erase_cnt[s] = h->erase_count;
+        if (!found || h->first_seq >= max_seq) {
+            max_seq = h->first_seq;
+            stats.active_sector = s;
+        }
+        if (!found || h->first_seq < min_seq) {
+            min_seq = h->first_seq;
+            oldest = s;
+        }
+        found = 1;
+    }
+
+    if (!found) {
+        /* 全新或损坏的日志区：从扇区 0 开始格式化 */
+        if (open_sector(0) != 0) return -1;
+        rd_sector = 0;
+        rd_off = FW_SIZE;
+        stats.mounted = 1;
+        return 0;
+    }
+
+    /* 由旧到新跳读各扇区记录头 */
+    for (uint32_t i = 0; i < flash->sector_count; i++) {
+        uint32_t s = (oldest + i) % flash->sector_count;
+        uint32_t off = FW_SIZE;
+        int8_t r = -1;
+
+        if (!sect_valid(s)) continue;
+        if (sect_hdr(s)->first_seq > stats.next_seq) stats.next_seq = sect_hdr(s)->first_seq;
+
+        while ((r = rec_at(s, &off)) >= 0) {
+            const EvRecHdr_t *h = rec_hdr(s, off);
+            if (r == 0) {
+                stats.torn_records++;
+            } else {
+                if (h->seq >= stats.next_seq) stats.next_seq = h->seq + 1;
+                if (h->type == EVID_REC_ACK && h->len >= 4) {
+                    uint32_t acked;
+                    memcpy(&acked, (const uint8_t *)h + FW_SIZE, 4);
+                    if (acked > stats.acked_seq) stats.acked_seq = acked;
+                }
+            }
+            off += rec_footprint(h->len);
+        }
+        if (s == stats.active_sector) {
+            /* 头损坏且无法跳过时不知道长度，直接视为扇区已满，下次写入时轮转 */
+            stats.write_off = (r == -2) ? flash->sector_size : off;
+        }
+    }
+
+    rd_sector = oldest;
+    rd_off = FW_SIZE;
+    update_wear_stats();
+    stats.mounted = 1;
+    return 0;
+}
+
+/**
+ * @brief  追加一条记录
+ * @retval 0: 成功; -1: 未挂载/参数无效/写入失败
+ */
+int8_t Evidence_Log_Append(EvidRecType_t type, const uint8_t *pData, uint32_t len, uint32_t frame_id) {
+    EvRecHdr_t h;
+    EvCommit_t c;
+    uint32_t foot = rec_footprint(len);
+    uint32_t base;
+
+    if (!stats.mounted || pData == NULL || len == 0) return -1;
+    if (foot > flash->sector_size - FW_SIZE) return -1;
+
+    if (stats.write_off + foot > flash->sector_size) {
+        if (rotate_sector() != 0) return -1;
+    }
+    base = sect_base(stats.active_sector) + stats.write_off;
+
+    memset(&h, 0xFF, sizeof(h));
+    h.magic = REC_MAGIC;
+    h.type = (uint16_t)type;
+    h.reserved = 0;
+    h.seq = stats.next_seq;
+    h.len = len;
+    h.frame_id = frame_id;
+    h.data_crc = evid_crc(pData, len);
+    h.hdr_crc = evid_crc(&h, 24);
+
+    memset(&c, 0xFF, sizeof(c));
+    c.magic = COMMIT_MAGIC;
+    c.seq = h.seq;
+
+    /* 无论成败写指针都要越过该记录：Flash 字不可重复编程 */
+    stats.write_off += foot;
+    stats.next_seq++;
+
+    if (program_bytes(base, (const uint8_t *)&h, FW_SIZE) != 0 ||
+        program_bytes(base + FW_SIZE, pData, len) != 0 ||
+        program_bytes(base + FW_SIZE + FW_ALIGN(len), (const uint8_t *)&c, FW_SIZE) != 0) {
+        stats.write_errors++;
+        return -1;
+    }
+    stats.appended++;
+    return 0;
+}
+
+/**
+ * @brief  取下一条未上传记录 (跳过 ACK、残缺与负载校验失败的记录)
+ * @retval 0: 有记录; -1: 全部已上传
+ */
+int8_t Evidence_Log_PeekUnsent(EvidRecord_t *rec) {
+    if (!stats.mounted || rec == NULL) return -1;
+
+    for (uint32_t hops = 0; hops < flash->sector_count + 1; ) {
+        if (rd_sector == stats.active_sector && rd_off >= stats.write_off) {
+            return -1;
+        }
+        int8_t r = sect_valid(rd_sector) ? rec_at(rd_sector, &rd_off) : -1;
+        if (r < 0) {
+            /* 本扇区读完 (或无效)，前进到下一个扇区 */
+            if (rd_sector == stats.active_sector) return -1;
+            rd_sector = (rd_sector + 1) % flash->sector_count;
+            rd_off = FW_SIZE;
+            hops++;
+            continue;
+        }
+
+        const EvRecHdr_t *h = rec_hdr(rd_sector, rd_off);
+        const uint8_t *payload = (const uint8_t *)h + FW_SIZE;
+        if (r == 1 && h->type != EVID_REC_ACK && h->seq > stats.acked_seq &&
+            h->data_crc == evid_crc(payload, h->len)) {
+            rec->type = (EvidRecType_t)h->type;
+            rec->seq = h->seq;
+            rec->frame_id = h->frame_id;
+            rec->pData = payload;
+            rec->len = h->len;
+            return 0;
+        }
+        rd_off += rec_footprint(h->len);
+    }
+    return -1;
+}
+
+/**
+ * @brief  记录已上传成功：前移游标，每 EVID_ACK_EVERY 条或追平时落盘一次
+ */
+void Evidence_Log_MarkSent(uint32_t seq) {
+    EvidRecord_t next;
+
+    if (!stats.mounted) return;
+    if (rd_sector != stats.active_sector || rd_off < stats.write_off) {
+        rd_off += rec_footprint(rec_hdr(rd_sector, rd_off)->len);
+    }
+    if (seq > stats.acked_seq) stats.acked_seq = seq;
+    stats.uploaded++;
+
+    if (++ack_pending >= EVID_ACK_EVERY || Evidence_Log_PeekUnsent(&next) != 0) {
+        ack_pending = 0;
+        Evidence_Log_Append(EVID_REC_ACK, (const uint8_t *)&stats.acked_seq, sizeof(uint32_t), 0);
+    }
+}
+
+void Evidence_Log_GetStats(EvidStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
@@ -0,0 +1,345 @@
+#include "Http_Mjpeg.h"
+#include "Vision_Pipeline.h"
+#include "app_config.h"
+#include "main.h"
+#include "lwip/tcp.h"
+#include "lwip/tcpip.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 连接状态                                 */
+/* ========================================== */
+/*
+ * 基于 lwIP raw TCP API，所有回调运行在 tcpip 线程；Net 任务通过
+ * Http_Mjpeg_Publish (持核心锁) 通知新帧。
+ * 每帧按 [分段头 (COPY)][JPEG 数据 (NOCOPY)][CRLF (NOCOPY)] 写入 TCP，
+ * JPEG 数据直接引用编码输出槽，直到对端全部 ACK 后才释放帧引用，
+ * 多个观看者同时发送同一帧时共享同一个槽。
+ */
+#define HTTP_BOUNDARY   "ivcisframe"
+
+/* 预览最多占住 JPEG_OUT_SLOTS - 1 个输出槽，只有一个槽时预览永远取不到帧 */
+_Static_assert(JPEG_OUT_SLOTS >= 2, "HTTP preview needs at least two JPEG output slots");
+
+typedef enum {
+    VIEWER_FREE = 0,
+    VIEWER_REQUEST,     /* 已连接，等待 HTTP 请求 */
+    VIEWER_STREAM       /* 已回复 multipart 头，持续推帧 */
+} ViewerState_t;
+
+typedef struct {
+    struct tcp_pcb *pcb;
+    ViewerState_t state;
+    VisionFrame_t *frame;     /* 正在发送的帧 (持有引用) */
+    uint32_t last_frame_id;
+    uint32_t frame_tick;      /* 本帧开始发送的时刻 (限速/卡死检测) */
+    uint32_t queued;          /* 本帧已写入 TCP 的字节数 */
+    uint32_t total;           /* 本帧总字节数 (分段头 + 数据 + CRLF) */
+    uint32_t unacked;
+    uint16_t part_hdr_len;
+    char part_hdr[80];
+} Viewer_t;
+
+static const char http_ok_hdr[] =
+    "HTTP/1.0 200 OK\r\n"
+    "Content-Type: multipart/x-mixed-replace; boundary=" HTTP_BOUNDARY "\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Pragma: no-cache\r\n"
+    "Connection: close\r\n\r\n";
+static const char http_404[] = "HTTP/1.0 404 Not Found\r\nConnection: close\r\n\r\n";
+static const char http_503[] = "HTTP/1.0 503 Service Unavailable\r\nConnection: close\r\n\r\n";
+static const char crlf[] = "\r\n";
+
+static struct tcp_pcb *listen_pcb = NULL;
+static Viewer_t viewers[HTTP_MAX_VIEWERS];
+static HttpMjpegStats_t stats = {0};
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static void viewer_drop_frame(Viewer_t *v) {
+    if (v->frame != NULL) {
+        Vision_Frame_ReleasePreview(v->frame);
+        v->frame = NULL;
+    }
+}
+
+static void viewer_detach(Viewer_t *v) {
+    if (v->pcb != NULL) {
+        tcp_arg(v->pcb, NULL);
+        tcp_recv(v->pcb, NULL);
+        tcp_sent(v->pcb, NULL);
+        tcp_err(v->pcb, NULL);
+        tcp_poll(v->pcb, NULL, 0);
+    }
+    viewer_drop_frame(v);
+    if (v->state != VIEWER_FREE && stats.viewers > 0) stats.viewers--;
+    v->pcb = NULL;
+    v->state = VIEWER_FREE;
+}
+
+static void viewer_close(Viewer_t *v) {
+    struct tcp_pcb *pcb = v->pcb;
+
+    viewer_detach(v);
+    if (pcb != NULL && tcp_close(pcb) != ERR_OK) {
+        tcp_abort(pcb);
+    }
+}
+
+/**
+ * @brief  立即中止 (RST)：丢弃仍引用帧数据的发送队列。回调中调用后必须返回 ERR_ABRT
+ */
+static void viewer_abort(Viewer_t *v) {
+    struct tcp_pcb *pcb = v->pcb;
+
+    viewer_detach(v);
+    if (pcb != NULL) {
+        tcp_abort(pcb);
+    }
+}
+
+/**
+ * @brief  按发送窗口把当前帧尽量写入 TCP
+ * @retval ERR_OK 或写入失败的错误码 (调用方负责关闭)
+ */
+static err_t viewer_pump(Viewer_t *v) {
+    uint32_t hdr = v->part_hdr_len;
+    uint32_t len = (v->frame != NULL) ? v->frame->len : 0;
+
+    while (v->frame != NULL && v->queued < v->total) {
+        const uint8_t *src;
+        uint32_t n;
+        uint8_t flags = 0;
+        uint16_t room = tcp_sndbuf(v->pcb);
+
+        if (room == 0 || tcp_sndqueuelen(v->pcb) >= TCP_SND_QUEUELEN - 1) break;
+
+        if (v->queued < hdr) {
+            src = (const uint8_t *)v->part_hdr + v->queued;
+            n = hdr - v->queued;
+            flags = TCP_WRITE_FLAG_COPY;
+        } else if (v->queued < hdr + len) {
+            src = v->frame->data + (v->queued - hdr);
+            n = hdr + len - v->queued;
+        } else {
+            src = (const uint8_t *)crlf + (v->queued - hdr - len);
+            n = v->total - v->queued;
+        }
+        if (n > room) n = room;
+        if (v->queued + n < v->total) flags |= TCP_WRITE_FLAG_MORE;
+
+        err_t err = tcp_write(v->pcb, src, (u16_t)n, flags);
+        if (err == ERR_MEM) break;   /* 队列满，等 sent 回调再继续 */
+        if (err != ERR_OK) return err;
+        v->queued += n;
+        v->unacked += n;
+    }
+    return tcp_output(v->pcb);
+}
+
+/**
+ * @brief  观看者空闲且已过限速间隔时，取最新帧开始发送
+ */
+static err_t viewer_next_frame(Viewer_t *v) {
+    VisionFrame_t *f;
+    uint32_t now = HAL_GetTick();
+
+    if (v->state != VIEWER_STREAM || v->frame != NULL) return ERR_OK;
+    if (v->last_frame_id != 0 && now - v->frame_tick < HTTP_MIN_INTERVAL_MS) return ERR_OK;
+
+    f = Vision_Frame_AcquirePreview();
+    if (f == NULL) return ERR_OK;
+    if (f->frame_id == v->last_frame_id) {
+        Vision_Frame_ReleasePreview(f);
+        return ERR_OK;
+    }
+
+    v->frame = f;
+    v->last_frame_id = f->frame_id;
+    v->frame_tick = now;
+    v->part_hdr_len = (uint16_t)snprintf(v->part_hdr, sizeof(v->part_hdr),
+                                         "--" HTTP_BOUNDARY "\r\nContent-Type: image/jpeg\r\nContent-Length: %lu\r\n\r\n",
+                                         (unsigned long)f->len);
+    v->queued = 0;
+    v->unacked = 0;
+    v->total = v->part_hdr_len + f->len + 2;
+    return viewer_pump(v);
+}
+
+/* ========================================== */
+/* 3. lwIP 回调 (tcpip 线程)                   */
+/* ========================================== */
+
+static err_t http_sent(void *arg, struct tcp_pcb *pcb, u16_t len) {
+    Viewer_t *v = (Viewer_t *)arg;
+
+    if (v == NULL) return ERR_OK;
+    v->unacked = (len > v->unacked) ? 0 : v->unacked - len;
+    stats.bytes_sent += len;
+
+    if (v->frame != NULL && v->queued >= v->total && v->unacked == 0) {
+        /* 整帧已被对端确认，NOCOPY 数据不再被引用 */
+        viewer_drop_frame(v);
+        stats.frames_sent++;
+    }
+    err_t err = (v->frame != NULL) ? viewer_pump(v) : viewer_next_frame(v);
+    if (err != ERR_OK) {
+        viewer_abort(v);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+static err_t http_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err) {
+    Viewer_t *v = (Viewer_t *)arg;
+    char line[16] = {0};
+
+    if (v == NULL) {
+        if (p != NULL) pbuf_free(p);
+        return ERR_OK;
+    }
+    if (p == NULL) {
+        /* 对端关闭；仍有帧数据在发送队列中时直接中止，避免引用已释放的槽 */
+        if (v->frame != NULL) {
+            viewer_abort(v);
+            return ERR_ABRT;
+        }
+        viewer_close(v);
+        return ERR_OK;
+    }
+    tcp_recved(pcb, p->tot_len);
+
+    if (v->state == VIEWER_REQUEST) {
+        pbuf_copy_partial(p, line, sizeof(line) - 1, 0);
+        if (strncmp(line, "GET / ", 6) == 0 || strncmp(line, "GET /stream", 11) == 0) {
+            tcp_write(pcb, http_ok_hdr, sizeof(http_ok_hdr) - 1, 0);
+            v->state = VIEWER_STREAM;
+            v->last_frame_id = 0;
+            pbuf_free(p);
+            if (viewer_next_frame(v) != ERR_OK) {
+                viewer_abort(v);
+                return ERR_ABRT;
+            }
+            return ERR_OK;
+        }
+        tcp_write(pcb, http_404, sizeof(http_404) - 1, 0);
+        pbuf_free(p);
+        viewer_close(v);
+        return ERR_OK;
+    }
+    pbuf_free(p);  /* 推流阶段忽略客户端数据 */
+    return ERR_OK;
+}
+
+static void http_err(void *arg, err_t err) {
+    Viewer_t *v = (Viewer_t *)arg;
+
+    if (v == NULL) return;
+    v->pcb = NULL;   /* pcb 已被 lwIP 释放 */
+    viewer_detach(v);
+}
+
+/**
+ * @brief  每 500ms 调用：卡死检测，并在没有新 Publish 时补推
+ */
+static err_t http_poll(void *arg, struct tcp_pcb *pcb) {
+    Viewer_t *v = (Viewer_t *)arg;
+
+    if (v == NULL) return ERR_OK;
+    if (v->frame != NULL && HAL_GetTick() - v->frame_tick > HTTP_STALL_MS) {
+        stats.stalls++;
+        printf("[HTTP] viewer stalled, dropping\r\n");
+        viewer_abort(v);
+        return ERR_ABRT;
+    }
+    if (v->state == VIEWER_STREAM && viewer_next_frame(v) != ERR_OK) {
+        viewer_abort(v);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+static err_t http_accept(void *arg, struct tcp_pcb *newpcb, err_t err) {
+    Viewer_t *v = NULL;
+
+    if (err != ERR_OK || newpcb == NULL) return ERR_VAL;
+
+    for (uint32_t i = 0; i < HTTP_MAX_VIEWERS; i++) {
+        if (viewers[i].state == VIEWER_FREE) {
+            v = &viewers[i];
+            break;
+        }
+    }
+    if (v == NULL) {
+        stats.rejected++;
+        tcp_write(newpcb, http_503, sizeof(http_503) - 1, 0);
+        tcp_close(newpcb);
+        return ERR_OK;
+    }
+
+    memset(v, 0, sizeof(*v));
+    v->pcb = newpcb;
+    v->state = VIEWER_REQUEST;
+    stats.accepted++;
+    stats.viewers++;
+
+    tcp_setprio(newpcb, TCP_PRIO_MIN);  /* 预览优先级最低 */
+    tcp_arg(newpcb, v);
+    tcp_recv(newpcb, http_recv);
+    tcp_sent(newpcb, http_sent);
+    tcp_err(newpcb, http_err);
+    tcp_poll(newpcb, http_poll, 1);
+    return ERR_OK;
+}
+
+/* ========================================== */
+/* 4. 对外接口                                 */
+/* ========================================== */
+
+int8_t Http_Mjpeg_Init(void) {
+    struct tcp_pcb *pcb;
+    int8_t ret = -1;
+
+    LOCK_TCPIP_CORE();
+    pcb = tcp_new();
+    if (pcb != NULL && tcp_bind(pcb, IP_ADDR_ANY, HTTP_PORT) == ERR_OK) {
+        listen_pcb = tcp_listen_with_backlog(pcb, HTTP_MAX_VIEWERS);
+        if (listen_pcb != NULL) {
+            tcp_accept(listen_pcb, http_accept);
+            ret = 0;
+        }
+    } else if (pcb != NULL) {
+        tcp_close(pcb);
+    }
+    UNLOCK_TCPIP_CORE();
+
+    if (ret == 0) {
+        printf("[HTTP] MJPEG preview on port %d (max %d viewers)\r\n", HTTP_PORT, HTTP_MAX_VIEWERS);
+    }
+    return ret;
+}
+
+/**
+ * @brief  新帧编码完成后由 Net 任务调用，给空闲的观看者推送最新帧
+ */
+void Http_Mjpeg_Publish(void) {
+    if (listen_pcb == NULL) return;
+
+    LOCK_TCPIP_CORE();
+    for (uint32_t i = 0; i < HTTP_MAX_VIEWERS; i++) {
+        Viewer_t *v = &viewers[i];
+        if (v->state == VIEWER_STREAM && viewer_next_frame(v) != ERR_OK) {
+            viewer_abort(v);
+        }
+    }
+    UNLOCK_TCPIP_CORE();
+}
+
+void Http_Mjpeg_GetStats(HttpMjpegStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
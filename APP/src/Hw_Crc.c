@@ -0,0 +1,36 @@
+#include "Hw_Crc.h"
+#include "app_config.h"
+#include "FreeRTOS.h"
+#include "cmsis_os.h"
+
+extern CRC_HandleTypeDef hcrc;
+
+static osMutexId_t crc_mutex = NULL;
+RTOS_SECTION static StaticSemaphore_t crc_mutex_cb;
+
+static const osMutexAttr_t crc_mutex_attr = {
+    .name = "Mtx_CRC",
+    .cb_mem = &crc_mutex_cb,
+    .cb_size = sizeof(crc_mutex_cb),
+};
+
+/**
+ * @brief  创建互斥量 (MX_FREERTOS_Init 中调用，早于所有使用者)
+ */
+void Hw_Crc_Init(void) {
+    crc_mutex = osMutexNew(&crc_mutex_attr);
+}
+
+/**
+ * @brief  计算 CRC (任务上下文；持锁期间其他任务的 CRC 计算等待)
+ * @note   权重区整段校验 (约 430 KB) 持锁数 ms，其余使用者都是几十字节到一帧 JPEG
+ */
+uint32_t Hw_Crc_Calc(const void *p, uint32_t len) {
+    uint8_t locked = (crc_mutex != NULL && osKernelGetState() == osKernelRunning) ? 1 : 0;
+    uint32_t crc;
+
+    if (locked) osMutexAcquire(crc_mutex, osWaitForever);
+    crc = HAL_CRC_Calculate(&hcrc, (uint32_t *)p, len);
+    if (locked) osMutexRelease(crc_mutex);
+    return crc;
+}
@@ -0,0 +1,201 @@
+#include "Log.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include "usart.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/*
+ * 环形缓冲按 4 字节对齐存放记录：头部一个字 [15:0] 记录总长 (含头部) | [27:16] 负载长度 |
+ * bit30 填充 | bit31 已提交。生产者 (任意任务/中断) CAS 推进 head 预留空间，写负载后以
+ * release 语义写头部提交；到缓冲末尾放不下时连同一条填充记录一起预留。Task_Log 从 tail
+ * 依次取已提交的记录，遇到未提交的即停 (预留后被抢占的生产者提交后再继续)，取走的区域清零，
+ * 保证新预留的区域在提交前头部一定是 0。
+ */
+#define RING_MASK        (LOG_RING_SIZE - 1U)
+#define HDR_COMMIT       0x80000000U
+#define HDR_PAD          0x40000000U
+#define HDR_TOTAL(h)     ((h) & 0xFFFFU)
+#define HDR_LEN(h)       (((h) >> 16) & 0xFFFU)
+#define LOG_MAX_RECORD   128U       /* 单条记录最大负载，更长的 _write 拆成多条 */
+#define LOG_FLAG_KICK    0x0001U
+#define LOG_FLAG_TXDONE  0x0002U
+#define LOG_TX_TIMEOUT_MS 100U      /* 一块 (LOG_TX_CHUNK) 在 921600 下约 6 ms */
+
+_Static_assert((LOG_RING_SIZE & RING_MASK) == 0, "LOG_RING_SIZE must be a power of 2");
+_Static_assert(LOG_MAX_RECORD <= LOG_TX_CHUNK, "a record must fit in one DMA chunk");
+
+static uint8_t ring[LOG_RING_SIZE] __attribute__((aligned(4)));
+static volatile uint32_t head = 0;      // 生产者预留位置 (单调增)
+static volatile uint32_t tail = 0;      // Task_Log 已取走的位置
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t tx_buf[LOG_TX_CHUNK];  // DMA1 不能访问 DTCM
+static osThreadId_t log_task = NULL;
+static LogStats_t stats = {0};
+
+/* ========================================== */
+/* 2. 生产者                                   */
+/* ========================================== */
+
+/**
+ * @brief  预留一条记录 (可在中断中调用，不关中断)
+ * @retval 负载地址; NULL: 缓冲满，已计入 dropped
+ */
+static uint8_t *ring_reserve(uint32_t len, uint32_t **hdr) {
+    uint32_t total = 4U + ((len + 3U) & ~3U);
+    uint32_t pos = head;
+    uint32_t off, pad, used;
+
+    do {
+        off = pos & RING_MASK;
+        pad = (off + total > LOG_RING_SIZE) ? LOG_RING_SIZE - off : 0;
+        used = pos + pad + total - tail;
+        if (used > LOG_RING_SIZE) {
+            __atomic_fetch_add(&stats.dropped, 1U, __ATOMIC_RELAXED);
+            return NULL;
+        }
+    } while (!__atomic_compare_exchange_n(&head, &pos, pos + pad + total, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    if (used > stats.high_water) stats.high_water = used;
+    if (pad > 0) {
+        __atomic_store_n((uint32_t *)&ring[off], HDR_COMMIT | HDR_PAD | pad, __ATOMIC_RELEASE);
+        off = 0;
+    }
+    *hdr = (uint32_t *)&ring[off];
+    return &ring[off + 4U];
+}
+
+static void ring_commit(uint32_t *hdr, uint32_t len) {
+    uint32_t total = 4U + ((len + 3U) & ~3U);
+
+    __atomic_store_n(hdr, HDR_COMMIT | (len << 16) | total, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&stats.records, 1U, __ATOMIC_RELAXED);
+    /* 平时由 Task_Log 按 LOG_FLUSH_MS 节拍取走，过半才提前唤醒，避免每条日志都切换任务 */
+    if (log_task != NULL && head - tail > LOG_RING_SIZE / 2U) {
+        osThreadFlagsSet(log_task, LOG_FLAG_KICK);
+    }
+}
+
+/**
+ * @brief  写入一段文本 (_write 调用，任意上下文)；缓冲满时丢弃
+ */
+void Log_Write(const char *ptr, uint32_t len) {
+    while (len > 0) {
+        uint32_t n = (len > LOG_MAX_RECORD) ? LOG_MAX_RECORD : len;
+        uint32_t *hdr;
+        uint8_t *p = ring_reserve(n, &hdr);
+
+        if (p == NULL) return;
+        memcpy(p, ptr, n);
+        ring_commit(hdr, n);
+        ptr += n;
+        len -= n;
+    }
+}
+
+/**
+ * @brief  写入一条二进制记录 (LOG_x 在 LOG_BINARY=1 时调用，任意上下文)，不做格式化
+ * @param  fmt: .log_fmt 段中的格式串，地址即编号 (不解引用)
+ */
+void Log_Binary(uint8_t level, const char *fmt, const uint32_t *args, uint8_t nargs) {
+    uint32_t len = 9U + 4U * nargs;
+    uint32_t id = (uint32_t)fmt;
+    uint32_t tick = HAL_GetTick();
+    uint32_t *hdr;
+    uint8_t *p = ring_reserve(len, &hdr);
+    uint8_t sum = 0;
+
+    if (p == NULL) return;
+    p[0] = LOG_SYNC;
+    p[1] = (uint8_t)((level << 4) | nargs);
+    p[2] = (uint8_t)id;
+    p[3] = (uint8_t)(id >> 8);
+    memcpy(&p[4], &tick, 4);
+    memcpy(&p[8], args, 4U * nargs);
+    for (uint32_t i = 1; i < len - 1U; i++) sum ^= p[i];
+    p[len - 1U] = sum;
+    ring_commit(hdr, len);
+}
+
+/* ========================================== */
+/* 3. 发送任务                                 */
+/* ========================================== */
+
+/**
+ * @brief  把已提交的记录拷入 DMA 发送缓冲并释放环形缓冲空间
+ * @retval 拷入的字节数
+ */
+static uint32_t ring_collect(void) {
+    uint32_t pos = tail;
+    uint32_t n = 0;
+
+    while (pos != head) {
+        uint32_t off = pos & RING_MASK;
+        uint32_t h = __atomic_load_n((uint32_t *)&ring[off], __ATOMIC_ACQUIRE);
+
+        if ((h & HDR_COMMIT) == 0) break;
+        if ((h & HDR_PAD) == 0) {
+            if (n + HDR_LEN(h) > LOG_TX_CHUNK) break;
+            memcpy(&tx_buf[n], &ring[off + 4U], HDR_LEN(h));
+            n += HDR_LEN(h);
+        }
+        memset(&ring[off], 0, HDR_TOTAL(h));
+        pos += HDR_TOTAL(h);
+    }
+    __atomic_store_n(&tail, pos, __ATOMIC_RELEASE);
+    return n;
+}
+
+/**
+ * @brief  Task_Log：每 LOG_FLUSH_MS 或缓冲过半时把日志经 USART3 DMA 发出，一次一块
+ */
+void Log_Task(void *argument) {
+    uint32_t dropped_seen = 0;
+
+    log_task = osThreadGetId();
+    for (;;) {
+        uint32_t n = ring_collect();
+
+        if (n == 0) {
+            osThreadFlagsWait(LOG_FLAG_KICK, osFlagsWaitAny, LOG_FLUSH_MS);
+            if (stats.dropped != dropped_seen) {
+                /* 丢弃提示本身也走缓冲，此时已有空间 */
+                char line[48];
+                int len = snprintf(line, sizeof(line), "[LOG] %ld records dropped\r\n", stats.dropped - dropped_seen);
+                dropped_seen = stats.dropped;
+                Log_Write(line, (uint32_t)len);
+            }
+            continue;
+        }
+        SCB_CleanDCache_by_Addr((uint32_t *)tx_buf, (int32_t)n);
+        osThreadFlagsClear(LOG_FLAG_TXDONE);
+        if (HAL_UART_Transmit_DMA(&huart3, tx_buf, (uint16_t)n) != HAL_OK) {
+            continue;   /* 串口被其他代码占用，数据已取走，丢弃这一块 */
+        }
+        if (osThreadFlagsWait(LOG_FLAG_TXDONE, osFlagsWaitAny, LOG_TX_TIMEOUT_MS) & osFlagsError) {
+            HAL_UART_AbortTransmit(&huart3);   /* 串口错误未回调：放弃这一块，避免永久卡住 */
+            continue;
+        }
+        stats.bytes += n;
+    }
+}
+
+/**
+ * @brief  DMA 发送完成 (USART3 中断)
+ */
+void Log_TxDone(void) {
+    if (log_task != NULL) osThreadFlagsSet(log_task, LOG_FLAG_TXDONE);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+    if (huart == &huart3) Log_TxDone();
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+    if (huart == &huart3) Log_TxDone();
+}
+
+void Log_GetStats(LogStats_t *out) {
+    if (out != NULL) *out = stats;
+}
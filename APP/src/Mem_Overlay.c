@@ -0,0 +1,275 @@
+#include "Mem_Overlay.h"
+#include "app_config.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/*
+ * 块的首尾各留 OVERLAY_GUARD 字节保护带，借用方拿到的是中间部分。Acquire 可在中断中调用
+ * (JPEG 选槽)，所有状态修改都在关中断下进行。借用方通常是 DMA (MDMA 写入、ETH 读出)：
+ * 进入 LEND 时把所有者的脏行写回并作废，归还后的内容由借用方自行 invalidate 后才被 CPU 读取。
+ * AI_LEND_DEBUG 时：借出时写保护带、归还时检查；在线程中归还时整块写毒化值，
+ * 收回时核对，借用方归还后仍写入 (DMA 未停、迟到的回调) 即计入 poison_errors。
+ */
+#define GUARD_BYTE    0xA5U
+#define POISON_BYTE   0xDBU
+
+typedef struct {
+    uint8_t *base;
+    uint32_t size;            // 含首尾保护带
+    uint32_t epoch;           // 每次借出/归还加 1，凭证中的代数不符即失效
+    OverlayYield_t yield;
+    uint8_t  lent;
+    uint8_t  poisoned;        // 归还时已写毒化值，收回时核对
+} OverlayBlock_t;
+
+static OverlayBlock_t blocks[OVERLAY_MAX_BLOCKS];
+static uint8_t n_blocks = 0;
+static volatile uint8_t phase = OVERLAY_PHASE_OWNER;
+static OverlayStats_t stats = {0};
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static inline OverlayLease_t make_lease(uint8_t idx, uint32_t epoch) {
+    return (epoch << 8) | idx;
+}
+
+/* 凭证对应的块 (已失效时返回 NULL)，调用方需关中断 */
+static OverlayBlock_t *lease_block(OverlayLease_t lease) {
+    uint8_t idx = (uint8_t)(lease & 0xFFU);
+
+    if (lease == 0 || idx >= n_blocks) return NULL;
+    if (!blocks[idx].lent || (blocks[idx].epoch & 0xFFFFFFU) != (lease >> 8)) return NULL;
+    return &blocks[idx];
+}
+
+static uint8_t lent_count(void) {
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; i < n_blocks; i++) n += blocks[i].lent;
+    return n;
+}
+
+#if AI_LEND_DEBUG
+static void guard_fill(OverlayBlock_t *b) {
+    memset(b->base, GUARD_BYTE, OVERLAY_GUARD);
+    memset(b->base + b->size - OVERLAY_GUARD, GUARD_BYTE, OVERLAY_GUARD);
+    SCB_CleanDCache_by_Addr((uint32_t *)b->base, OVERLAY_GUARD);
+    SCB_CleanDCache_by_Addr((uint32_t *)(b->base + b->size - OVERLAY_GUARD), OVERLAY_GUARD);
+}
+
+static uint8_t span_is(uint8_t *p, uint32_t len, uint8_t v) {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)p, (int32_t)len);  /* 借用方可能是 DMA */
+    for (uint32_t i = 0; i < len; i++) {
+        if (p[i] != v) return 0;
+    }
+    return 1;
+}
+#endif
+
+/* ========================================== */
+/* 3. 所有者接口                               */
+/* ========================================== */
+
+/**
+ * @brief  登记一块可外借的内存 (所有者初始化时调用，此时处于 OWNER 阶段)
+ * @param  base/size: 32 字节对齐，含首尾保护带
+ * @retval 块号; -1: 块数已满或参数无效
+ */
+int8_t Mem_Overlay_AddBlock(uint8_t *base, uint32_t size) {
+    if (n_blocks >= OVERLAY_MAX_BLOCKS || base == NULL || size <= 2U * OVERLAY_GUARD ||
+        ((uint32_t)base & 31U) != 0 || (size & 31U) != 0) {
+        return -1;
+    }
+    memset(&blocks[n_blocks], 0, sizeof(blocks[n_blocks]));
+    blocks[n_blocks].base = base;
+    blocks[n_blocks].size = size;
+    return (int8_t)n_blocks++;
+}
+
+/**
+ * @brief  所有者用完内存，进入 LEND 阶段
+ * @note   上一次收回超时、仍有块未归还时保持 RECLAIM，避免借用方一直续借使所有者饿死
+ */
+void Mem_Overlay_Lend(void) {
+    uint32_t primask;
+
+    if (phase == OVERLAY_PHASE_LEND) return;
+    if (phase == OVERLAY_PHASE_OWNER) {
+        /* 所有者写入的脏行必须先落到内存，避免之后被逐出时覆盖 DMA 写入的数据 */
+        for (uint8_t i = 0; i < n_blocks; i++) {
+            SCB_CleanInvalidateDCache_by_Addr((uint32_t *)blocks[i].base, (int32_t)blocks[i].size);
+        }
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (phase == OVERLAY_PHASE_OWNER || lent_count() == 0) {
+        phase = OVERLAY_PHASE_LEND;
+        stats.lends++;
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  所有者收回全部块，进入 OWNER 阶段 (所有者任务中调用)
+ * @param  timeout_ms: 等待借用方归还的上限
+ * @retval 0: 已收回，可以使用; -1: 超时 (保持 RECLAIM，所有者本次不得使用这些内存)
+ * @note   反复通知借用方 (yield 回调) 并让出 CPU，借用方在 tcpip 线程等低优先级上下文中归还
+ */
+int8_t Mem_Overlay_Reclaim(uint32_t timeout_ms) {
+    uint32_t start = HAL_GetTick();
+    uint32_t waited = 0;
+    uint32_t primask;
+
+    if (phase == OVERLAY_PHASE_OWNER) return 0;
+    phase = OVERLAY_PHASE_RECLAIM;
+
+    for (;;) {
+        for (uint8_t i = 0; i < n_blocks; i++) {
+            OverlayYield_t yield = blocks[i].yield;
+            if (blocks[i].lent && yield != NULL) yield();
+        }
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if (lent_count() == 0) {
+            phase = OVERLAY_PHASE_OWNER;  /* 关中断下切换，之后 Acquire 必然失败 */
+            __set_PRIMASK(primask);
+            break;
+        }
+        __set_PRIMASK(primask);
+        waited = HAL_GetTick() - start;
+        if (waited >= timeout_ms) {
+            stats.timeouts++;
+            return -1;
+        }
+        osDelay(1);
+    }
+
+#if AI_LEND_DEBUG
+    for (uint8_t i = 0; i < n_blocks; i++) {
+        OverlayBlock_t *b = &blocks[i];
+        if (!b->poisoned) continue;
+        b->poisoned = 0;
+        if (!span_is(b->base + OVERLAY_GUARD, b->size - 2U * OVERLAY_GUARD, POISON_BYTE)) {
+            stats.poison_errors++;
+            printf("[OVL] block %d written after release\r\n", i);
+        }
+    }
+#endif
+    stats.reclaims++;
+    if (waited > 0) {
+        stats.reclaim_waits++;
+        if (waited > stats.max_wait_ms) stats.max_wait_ms = waited;
+    }
+    return 0;
+}
+
+/**
+ * @brief  借用方查询是否正在收回 (应尽快归还，不再开始新的使用)
+ */
+uint8_t Mem_Overlay_Reclaiming(void) {
+    return (phase == OVERLAY_PHASE_RECLAIM) ? 1 : 0;
+}
+
+/* ========================================== */
+/* 4. 借用方接口                               */
+/* ========================================== */
+
+/**
+ * @brief  借一块至少 size 字节的内存 (可在中断中调用)
+ * @param  yield: 所有者请求收回时的回调 (所有者任务上下文)
+ * @retval 凭证; 0: 不在 LEND 阶段或没有合适的空闲块
+ */
+OverlayLease_t Mem_Overlay_Acquire(uint32_t size, OverlayYield_t yield) {
+    OverlayLease_t lease = 0;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (phase == OVERLAY_PHASE_LEND) {
+        for (uint8_t i = 0; i < n_blocks; i++) {
+            OverlayBlock_t *b = &blocks[i];
+            if (b->lent || b->size - 2U * OVERLAY_GUARD < size) continue;
+            b->lent = 1;
+            b->poisoned = 0;   /* 重新借出，毒化值作废 */
+            b->yield = yield;
+            b->epoch++;
+            if ((b->epoch & 0xFFFFFFU) == 0) b->epoch++;
+#if AI_LEND_DEBUG
+            guard_fill(b);
+#endif
+            lease = make_lease(i, b->epoch & 0xFFFFFFU);
+            stats.acquires++;
+            break;
+        }
+    }
+    __set_PRIMASK(primask);
+    return lease;
+}
+
+/**
+ * @brief  凭证对应的可用内存 (保护带之后)；凭证已失效时返回 NULL 并计入 stale
+ */
+uint8_t *Mem_Overlay_Ptr(OverlayLease_t lease) {
+    uint8_t *p = NULL;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    OverlayBlock_t *b = lease_block(lease);
+    if (b != NULL) {
+        p = b->base + OVERLAY_GUARD;
+    } else {
+        stats.stale++;
+    }
+    __set_PRIMASK(primask);
+    return p;
+}
+
+/**
+ * @brief  归还 (借用方须保证 DMA 已停止)；重复归还或凭证已失效时只计入 stale
+ */
+void Mem_Overlay_Release(OverlayLease_t lease) {
+    OverlayBlock_t *b;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    b = lease_block(lease);
+    if (b == NULL) {
+        stats.stale++;
+        __set_PRIMASK(primask);
+        return;
+    }
+    b->epoch++;      /* 旧凭证立即失效 */
+    __set_PRIMASK(primask);
+
+#if AI_LEND_DEBUG
+    if (!span_is(b->base, OVERLAY_GUARD, GUARD_BYTE) ||
+        !span_is(b->base + b->size - OVERLAY_GUARD, OVERLAY_GUARD, GUARD_BYTE)) {
+        stats.guard_errors++;
+        printf("[OVL] block %d guard overwritten\r\n", (int)(b - blocks));
+    }
+    if (__get_IPSR() == 0) {
+        /* 中断中归还时跳过毒化，避免长时间占用中断 */
+        memset(b->base + OVERLAY_GUARD, POISON_BYTE, b->size - 2U * OVERLAY_GUARD);
+        SCB_CleanDCache_by_Addr((uint32_t *)(b->base + OVERLAY_GUARD), (int32_t)(b->size - 2U * OVERLAY_GUARD));
+        b->poisoned = 1;
+    }
+#endif
+    __disable_irq();
+    b->lent = 0;
+    b->yield = NULL;
+    __set_PRIMASK(primask);
+}
+
+void Mem_Overlay_GetStats(OverlayStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+        out->phase = phase;
+        out->lent = lent_count();
+    }
+}
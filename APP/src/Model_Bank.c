@@ -0,0 +1,362 @@
+#include "Model_Bank.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/*
+ * 接收会话只存在 RAM 中：同一上电周期内以相同的头重新 Begin 即从 rx_done 续传，
+ * 复位后重新开始 (B 区整区重写)。扇区在数据写到时才擦除，擦除开销分摊到传输过程中；
+ * 擦除期间不消费数据 (发送方被 TCP 窗口限速)，由 Model_Bank_Poll 查询完成。
+ * 所有写操作只针对 B 区。B 区是活动区时，第一次擦除前先把活动区退回 A 区 (出厂权重)，
+ * 等持有 B 区的读者结束后才擦；提交后 B 区重新成为活动区，AI 任务在下一次 ReadBegin 时换绑。
+ */
+#define HDR_CRC_LEN   28U
+
+static const ModelFlashOps_t *flash = NULL;
+static uint32_t signature = 0;
+static ModelBankStats_t stats = {0};
+static const uint8_t *builtin_w = NULL;  // 固件链接的出厂权重
+static uint8_t builtin_ok = 0;           // A 区出厂头有效，可作为回退
+static uint32_t last_gen = 0;            // B 区最近一次提交的代数
+
+static ModelBlobHdr_t rx_hdr;
+static uint32_t rx_erased = 0;          // 本次会话已擦除的扇区数
+static uint8_t tail[MODEL_FW_SIZE];     // 未凑满一个 Flash 字的尾部
+static uint32_t tail_len = 0;
+static uint32_t word[MODEL_FW_SIZE / 4]; // Flash 字编程暂存 (保证源地址字对齐)
+
+static uint8_t erasing = 0;             // 本模块启动的扇区擦除在进行 (Net 任务)
+static volatile uint8_t bank_busy = 0;  // Bank2 有擦除请求或正在擦除 (Net 任务置位/清除)
+static volatile uint8_t read_hold = 0;  // AI 任务正在读 B 区权重
+static uint32_t erase_sector = 0;
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static inline const ModelBlobHdr_t *slot_hdr(uint8_t slot) {
+    return (const ModelBlobHdr_t *)flash->base[slot];
+}
+
+static inline const ModelCommit_t *slot_commit(uint8_t slot) {
+    return (const ModelCommit_t *)(flash->base[slot] + MODEL_FW_SIZE);
+}
+
+static inline const uint8_t *slot_data(uint8_t slot) {
+    return flash->base[slot] + MODEL_DATA_OFFSET;
+}
+
+static uint8_t hdr_valid(const ModelBlobHdr_t *h) {
+    if (h->magic != MODEL_MAGIC || (h->flags & MODEL_F_BUILTIN) != 0) return 0;
+    if (h->hdr_crc != flash->crc((const uint8_t *)h, HDR_CRC_LEN) || h->signature != signature) return 0;
+    return (h->size != 0 && h->size <= flash->slot_size - MODEL_DATA_OFFSET) ? 1 : 0;
+}
+
+/**
+ * @brief  检查一个区是否为已提交的有效 blob
+ * @note   A 区只认出厂头，且数据恰好是固件链接的权重；B 区只认下发的头
+ */
+static int8_t slot_check(uint8_t slot) {
+    const ModelBlobHdr_t *h = slot_hdr(slot);
+
+    if (h->magic != MODEL_MAGIC || slot_commit(slot)->magic != MODEL_COMMIT_MAGIC) return -1;
+    if (slot == MODEL_SLOT_BUILTIN) {
+        return ((h->flags & MODEL_F_BUILTIN) != 0 && builtin_w != NULL && slot_data(slot) == builtin_w) ? 0 : -1;
+    }
+    if (!hdr_valid(h)) return -1;
+    return (flash->crc(slot_data(slot), h->size) == h->crc) ? 0 : -1;
+}
+
+/**
+ * @brief  把活动区切到 slot (Net 任务；AI 任务在下一次 ReadBegin 时看到)
+ */
+static void set_active(uint8_t slot, uint32_t generation) {
+    stats.version = slot_hdr(slot)->version;
+    stats.generation = generation;
+    __sync_synchronize();
+    stats.active = slot;
+}
+
+/**
+ * @brief  请求擦除 Bank2：此后的 ReadBegin 不再交出 B 区
+ * @retval 1: 没有读者持有 B 区，可以擦; 0: 读者未结束，稍后再试 (请求保持有效)
+ */
+static uint8_t bank_acquire(void) {
+    bank_busy = 1;
+    __sync_synchronize();
+    return read_hold ? 0 : 1;
+}
+
+/**
+ * @brief  启动 B 区下一个待擦除扇区的擦除 (已有擦除在进行或读者未结束时什么也不做)
+ * @retval 0: 已启动或稍后再试; -1: 启动失败
+ */
+static int8_t erase_kick(void) {
+    if (erasing) return 0;
+    /* 要擦的正是活动区：推理先退回出厂权重，B 区不再交给新的读者 */
+    if (stats.active == MODEL_SLOT_OTA) set_active(MODEL_SLOT_BUILTIN, 0);
+    if (!bank_acquire()) return 0;   /* 本次推理读完 B 区再擦 */
+
+    erase_sector = rx_erased;
+    if (flash->erase_start(MODEL_SLOT_OTA, rx_erased) != 0) {
+        bank_busy = 0;
+        return -1;
+    }
+    erasing = 1;
+    return 0;
+}
+
+/**
+ * @brief  向 B 区 offset 处写一个 Flash 字 (所在扇区必须已擦除)
+ */
+static int8_t program_word(uint32_t offset, const void *src) {
+    if (offset / flash->sector_size >= rx_erased) return -1;
+    memcpy(word, src, MODEL_FW_SIZE);
+    return flash->program(MODEL_SLOT_OTA, offset, (const uint8_t *)word);
+}
+
+static void session_abort(void) {
+    stats.receiving = 0;
+    tail_len = 0;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  选出活动区 (启动时调用一次，先于网络初始化)
+ * @param  net_sig: 当前固件网络代码的结构签名
+ * @param  builtin/builtin_size: 固件链接的出厂权重
+ * @retval 0: 成功; -1: 两个区都无效 (此时不接受更新，推理使用链接的权重)
+ * @note   签名 = CRC(网络结构签名 LE32 + 出厂权重 CRC LE32)，A 区从不被覆盖，出厂权重总能算出
+ */
+int8_t Model_Bank_Mount(const ModelFlashOps_t *ops, uint32_t net_sig, const uint8_t *builtin, uint32_t builtin_size) {
+    uint32_t key[2] = { net_sig, 0 };
+
+    memset(&stats, 0, sizeof(stats));
+    flash = ops;
+    builtin_w = builtin;
+    erasing = 0;
+    tail_len = 0;
+    if (builtin != NULL) key[1] = flash->crc(builtin, builtin_size);
+    signature = flash->crc((const uint8_t *)key, sizeof(key));
+
+    builtin_ok = (slot_check(MODEL_SLOT_BUILTIN) == 0 && slot_hdr(MODEL_SLOT_BUILTIN)->size == builtin_size) ? 1 : 0;
+    last_gen = 0;
+    if (slot_check(MODEL_SLOT_OTA) == 0) {
+        last_gen = slot_commit(MODEL_SLOT_OTA)->generation;
+        set_active(MODEL_SLOT_OTA, last_gen);
+    } else if (builtin_ok) {
+        set_active(MODEL_SLOT_BUILTIN, 0);
+    } else {
+        return -1;
+    }
+    stats.mounted = 1;
+    return 0;
+}
+
+/**
+ * @brief  本固件接受的 blob 签名 (Mount 之后有效，上报给下发方核对)
+ */
+uint32_t Model_Bank_Signature(void) {
+    return signature;
+}
+
+/**
+ * @brief  活动区权重地址
+ * @retval 未挂载时返回 NULL
+ */
+const uint8_t *Model_Bank_Weights(uint32_t *version) {
+    if (!stats.mounted) return NULL;
+    if (version != NULL) *version = stats.version;
+    return slot_data((uint8_t)stats.active);
+}
+
+/**
+ * @brief  开始 (或续传) 一次更新 (目标总是 B 区)
+ * @param  resume: 输出，发送方应从该字节偏移继续发送
+ * @retval 0: 可以接收; -1: 未挂载、头无效或签名不符
+ * @note   与未完成会话的头完全相同时续传，否则放弃旧会话、从 0 开始。
+ *         B 区是活动区时在第一次擦除前才退回出厂权重，会话在那之前放弃则 B 区仍然有效
+ */
+int8_t Model_Bank_Begin(const ModelBlobHdr_t *hdr, uint32_t *resume) {
+    if (!stats.mounted || (!builtin_ok && stats.active == MODEL_SLOT_OTA)) return -1;
+    if (!hdr_valid(hdr)) {
+        stats.rejected++;
+        return -1;
+    }
+    tail_len = 0;
+    if (stats.receiving && memcmp(hdr, &rx_hdr, sizeof(rx_hdr)) == 0) {
+        stats.resumes++;
+        *resume = stats.rx_done;
+        return 0;
+    }
+
+    rx_hdr = *hdr;
+    rx_erased = 0;
+    stats.receiving = 1;
+    stats.rx_version = hdr->version;
+    stats.rx_size = hdr->size;
+    stats.rx_done = 0;
+    *resume = 0;
+    return 0;
+}
+
+/**
+ * @brief  写入接下来的权重数据 (凑满 Flash 字即编程，最后一字以 0xFF 补齐)
+ * @param  used: 输出，本次消费的字节数；遇到未擦除的扇区时启动擦除并提前返回，
+ *         剩余数据待 Model_Bank_Poll 返回 0 后再写
+ * @retval 0: 继续; 1: 数据已收齐，可以 Finish; -1: 无会话或写入失败 (会话作废)
+ * @note   超出 blob 长度的数据被忽略 (计入 used)
+ */
+int8_t Model_Bank_Write(const uint8_t *data, uint32_t len, uint32_t *used) {
+    uint32_t total = len;
+
+    *used = 0;
+    if (!stats.receiving) return -1;
+
+    while (len > 0 && stats.rx_done < stats.rx_size) {
+        if ((MODEL_DATA_OFFSET + stats.rx_done) / flash->sector_size >= rx_erased) {
+            if (erase_kick() != 0) {
+                stats.write_errors++;
+                session_abort();
+                return -1;
+            }
+            break;
+        }
+        uint32_t room = stats.rx_size - stats.rx_done - tail_len;
+        uint32_t n = MODEL_FW_SIZE - tail_len;
+        if (n > len) n = len;
+        if (n > room) n = room;
+        memcpy(tail + tail_len, data, n);
+        tail_len += n;
+        data += n;
+        len -= n;
+
+        if (tail_len == MODEL_FW_SIZE || stats.rx_done + tail_len == stats.rx_size) {
+            memset(tail + tail_len, 0xFF, MODEL_FW_SIZE - tail_len);
+            if (program_word(MODEL_DATA_OFFSET + stats.rx_done, tail) != 0) {
+                stats.write_errors++;
+                session_abort();
+                return -1;
+            }
+            stats.rx_done += tail_len;
+            tail_len = 0;
+        }
+    }
+    if (stats.rx_done == stats.rx_size) {
+        *used = total;
+        return 1;
+    }
+    *used = total - len;
+    return 0;
+}
+
+/**
+ * @brief  推进进行中的扇区擦除 (写入方周期调用)
+ * @retval 1: 擦除中，暂不写入; 0: 空闲; -1: 擦除失败 (所属会话作废)
+ */
+int8_t Model_Bank_Poll(void) {
+    int8_t r;
+
+    if (!erasing) return 0;
+    r = flash->erase_poll();
+    if (r == 1) return 1;
+
+    if (r == 0) {
+        stats.erases++;
+        if (stats.receiving && erase_sector == rx_erased) rx_erased++;
+    } else {
+        stats.write_errors++;
+        session_abort();
+    }
+    erasing = 0;
+    __sync_synchronize();
+    bank_busy = 0;
+    return (r == 0) ? 0 : -1;
+}
+
+/**
+ * @brief  校验收齐的 blob 并原子提交 (先写头，最后写提交字)
+ * @retval 0: 已提交，B 区成为活动区 (AI 任务下一次 ReadBegin 时换绑);
+ *         -1: CRC 不符或写入失败 (会话作废，继续使用出厂权重)
+ */
+int8_t Model_Bank_Finish(void) {
+    ModelCommit_t commit;
+
+    if (!stats.receiving || stats.rx_done != stats.rx_size) return -1;
+    session_abort();
+
+    if (flash->crc(slot_data(MODEL_SLOT_OTA), rx_hdr.size) != rx_hdr.crc) {
+        stats.rejected++;
+        return -1;
+    }
+    memset(&commit, 0xFF, sizeof(commit));
+    commit.magic = MODEL_COMMIT_MAGIC;
+    commit.generation = last_gen + 1U;
+    if (program_word(0, &rx_hdr) != 0 || program_word(MODEL_FW_SIZE, &commit) != 0 ||
+        slot_check(MODEL_SLOT_OTA) != 0) {
+        stats.write_errors++;
+        return -1;
+    }
+
+    last_gen = commit.generation;
+    stats.updates++;
+    set_active(MODEL_SLOT_OTA, commit.generation);
+    return 0;
+}
+
+/**
+ * @brief  取本次推理要读的权重 (AI 任务每次推理前调用，之后必须 ReadEnd)
+ * @param  version: 输出，所取权重的版本 (出厂权重为 0)
+ * @retval 活动区权重；活动区是 B 区而 Bank2 正在擦除时返回 A 区出厂权重 (计入 fallback_reads)；
+ *         未挂载时返回链接的权重；没有可读的权重时返回 NULL
+ * @note   返回 B 区时持有读者标志，ReadEnd 之前不会启动 Bank2 的擦除
+ */
+const uint8_t *Model_Bank_ReadBegin(uint32_t *version) {
+    uint8_t slot;
+
+    if (version != NULL) *version = 0;
+    if (!stats.mounted) return builtin_w;
+
+    slot = (uint8_t)stats.active;
+    if (slot == MODEL_SLOT_OTA) {
+        read_hold = 1;
+        __sync_synchronize();
+        if (!bank_busy) {
+            if (version != NULL) *version = slot_hdr(slot)->version;
+            return slot_data(slot);
+        }
+        read_hold = 0;
+        stats.fallback_reads++;
+        if (!builtin_ok) return NULL;
+    }
+    return slot_data(MODEL_SLOT_BUILTIN);
+}
+
+void Model_Bank_ReadEnd(void) {
+    __sync_synchronize();
+    read_hold = 0;
+}
+
+/**
+ * @brief  其他模块 (证据日志) 擦除 Bank2 扇区前调用，直到返回 0 才可以擦
+ * @retval 0: 没有读者持有 B 区; -1: 读者未结束 (新的读者已改用出厂权重)，稍后重试
+ * @note   与 Model_Bank_Write 在同一任务 (Net) 中调用，擦完后必须 EraseEnd
+ */
+int8_t Model_Bank_EraseBegin(void) {
+    return bank_acquire() ? 0 : -1;
+}
+
+void Model_Bank_EraseEnd(void) {
+    __sync_synchronize();
+    if (!erasing) bank_busy = 0;
+}
+
+void Model_Bank_GetStats(ModelBankStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
@@ -0,0 +1,390 @@
+#include "Model_Ota.h"
+#include "Model_Bank.h"
+#include "Hw_Crc.h"
+#include "app_config.h"
+#include "main.h"
+#include "lwip/tcp.h"
+#include "lwip/tcpip.h"
+#include "vehicle_detector.h"
+#include "vehicle_detector_data.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 权重区                                   */
+/* ========================================== */
+/*
+ * 链接脚本把出厂头 (.model_a_hdr) 和生成代码的权重数组放在 MODEL_A 区 (Bank1 Sector4~7)，
+ * 与程序同 Bank，运行中从不擦写。远程更新只写 MODEL_B 区 (Bank2 Sector0~3)，擦写不挂起取指与中断；
+ * B 区与证据日志同在 Bank2，Bank2 擦除期间 AI 任务经 Model_Bank_ReadBegin 改用 A 区出厂权重推理，
+ * 不跳帧 (改用次数见 ModelBankStats_t.fallback_reads)。
+ * 扇区擦除 (约 1~2 s) 只启动不等待，Net 任务每个维护节拍查询一次完成标志。
+ */
+_Static_assert(MODEL_DATA_OFFSET + sizeof(s_vehicle_detector_weights_array_u64) <= MODEL_SLOT_SIZE,
+               "weights do not fit a model slot");
+_Static_assert(MODEL_OTA_RX_BUF >= TCP_WND, "receive ring must hold a full TCP window");
+
+typedef struct {
+    ModelBlobHdr_t hdr;
+    ModelCommit_t commit;
+} ModelSlotHead_t;
+
+__attribute__((section(".model_a_hdr"), used)) IVCIS_ALIGN_32
+static const ModelSlotHead_t builtin_head = {
+    .hdr = { MODEL_MAGIC, 0, sizeof(s_vehicle_detector_weights_array_u64), 0, 0, MODEL_F_BUILTIN, 0, 0 },
+    .commit = { MODEL_COMMIT_MAGIC, 0, { 0 } },
+};
+
+static const uint32_t slot_base[MODEL_SLOTS]   = { MODEL_SLOT_A_BASE, MODEL_SLOT_B_BASE };
+static const uint32_t slot_bank[MODEL_SLOTS]   = { MODEL_SLOT_A_BANK, MODEL_SLOT_B_BANK };
+static const uint32_t slot_sector[MODEL_SLOTS] = { MODEL_SLOT_A_SECTOR, MODEL_SLOT_B_SECTOR };
+
+_Static_assert(MODEL_SLOT_A_BANK != MODEL_SLOT_B_BANK, "erasing slot B must not stall reads of slot A");
+_Static_assert(MODEL_SLOT_B_BANK == EVID_FLASH_BANK, "Model_Bank_EraseBegin gates the bank shared with the evidence log");
+
+static uint8_t  erase_slot = 0;
+static uint32_t erase_sector = 0;
+static uint32_t erase_tick = 0;
+static uint32_t erase_ms_max = 0;    // 单扇区擦除最长耗时 (即本次更新中推理用出厂权重的最长连续时间)
+
+/* 启动一个扇区的擦除后立即返回 (HAL_FLASHEx_Erase 会忙等到擦除结束) */
+static int8_t hal_flash_erase_start(uint8_t slot, uint32_t sector) {
+    HAL_StatusTypeDef st;
+
+    if (slot != MODEL_SLOT_OTA) return -1;   /* A 区与程序同 Bank，禁止擦除 */
+    HAL_FLASH_Unlock();
+    st = FLASH_WaitForLastOperation(0, slot_bank[slot]);
+    if (st == HAL_OK) {
+        FLASH_Erase_Sector(slot_sector[slot] + sector, slot_bank[slot], FLASH_VOLTAGE_RANGE_3);
+    }
+    HAL_FLASH_Lock();   /* 已启动的擦除不受上锁影响 */
+    erase_slot = slot;
+    erase_sector = sector;
+    erase_tick = HAL_GetTick();
+    return (st == HAL_OK) ? 0 : -1;
+}
+
+static int8_t hal_flash_erase_poll(void) {
+    HAL_StatusTypeDef st = FLASH_WaitForLastOperation(0, MODEL_SLOT_B_BANK);
+    uint32_t ms;
+
+    if (st == HAL_TIMEOUT) return 1;
+    ms = HAL_GetTick() - erase_tick;
+    if (ms > erase_ms_max) erase_ms_max = ms;
+    HAL_FLASH_Unlock();
+#if MODEL_SLOT_B_BANK == FLASH_BANK_2
+    CLEAR_BIT(FLASH->CR2, FLASH_CR_SER | FLASH_CR_SNB);
+#else
+    CLEAR_BIT(FLASH->CR1, FLASH_CR_SER | FLASH_CR_SNB);
+#endif
+    HAL_FLASH_Lock();
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(slot_base[erase_slot] + erase_sector * FLASH_SECTOR_SIZE),
+                                 FLASH_SECTOR_SIZE);
+    return (st == HAL_OK) ? 0 : -1;
+}
+
+static int8_t hal_flash_program(uint8_t slot, uint32_t offset, const uint8_t *src32) {
+    HAL_StatusTypeDef st;
+
+    if (slot != MODEL_SLOT_OTA) return -1;
+    HAL_FLASH_Unlock();
+    st = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, slot_base[slot] + offset, (uint32_t)src32);
+    HAL_FLASH_Lock();
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(slot_base[slot] + offset), MODEL_FW_SIZE);
+    return (st == HAL_OK) ? 0 : -1;
+}
+
+/**
+ * @brief  硬件 CRC (CRC-32/MPEG-2)
+ * @note   挂载在 AI 任务中执行，与 Net 任务的证据日志/租约 CRC 经 Hw_Crc 的互斥量串行
+ */
+static uint32_t hal_crc(const uint8_t *p, uint32_t len) {
+    return Hw_Crc_Calc(p, len);
+}
+
+static const ModelFlashOps_t hal_flash_ops = {
+    .base = { (const uint8_t *)MODEL_SLOT_A_BASE, (const uint8_t *)MODEL_SLOT_B_BASE },
+    .slot_size = MODEL_SLOT_SIZE,
+    .sector_size = FLASH_SECTOR_SIZE,
+    .erase_start = hal_flash_erase_start,
+    .erase_poll = hal_flash_erase_poll,
+    .program = hal_flash_program,
+    .crc = hal_crc,
+};
+
+/**
+ * @brief  网络结构签名：CRC("<模型名>:<权重字节>:<输入字节>:<输出类别数>")
+ * @note   Model_Bank 再并入出厂权重 CRC：结构相同但重新生成 (量化参数变化) 的固件烧录后，
+ *         旧固件下发的权重随之失效
+ */
+static uint32_t model_signature(void) {
+    char sig[64];
+    int n = snprintf(sig, sizeof(sig), "%s:%lu:%lu:%lu", AI_VEHICLE_DETECTOR_MODEL_NAME,
+                     (uint32_t)AI_VEHICLE_DETECTOR_DATA_WEIGHTS_SIZE,
+                     (uint32_t)AI_VEHICLE_DETECTOR_IN_1_SIZE_BYTES, (uint32_t)AI_VEHICLE_DETECTOR_OUT_1_SIZE);
+    return hal_crc((const uint8_t *)sig, (uint32_t)n);
+}
+
+/* ========================================== */
+/* 2. 接收端状态                               */
+/* ========================================== */
+/*
+ * lwIP raw TCP API，回调运行在 tcpip 线程，只负责收头和把数据放进环形缓冲；
+ * 擦写 Flash 与校验在 Net 任务 (Model_Ota_Poll) 中进行。数据编程后才 tcp_recved，
+ * 缓冲不小于 TCP_WND，发送方被 TCP 窗口自然限速，不会溢出。
+ */
+typedef enum {
+    OTA_IDLE = 0,
+    OTA_HDR,          /* 已连接，接收 32B 头 */
+    OTA_BEGIN,        /* 头已收齐，等待 Net 任务回复续传偏移 */
+    OTA_DATA          /* 接收权重数据 */
+} OtaState_t;
+
+static struct tcp_pcb *listen_pcb = NULL;
+static struct tcp_pcb *client = NULL;
+static volatile OtaState_t state = OTA_IDLE;
+static uint8_t hdr_buf[sizeof(ModelBlobHdr_t)];
+static uint32_t hdr_len = 0;
+static uint32_t last_rx_tick = 0;
+static uint32_t session_tick = 0;  // 本次更新 (含续传) 的开始时刻
+static uint32_t session_fallbacks = 0; // 本次更新开始时的 fallback_reads
+
+static uint8_t rx_ring[MODEL_OTA_RX_BUF];
+static volatile uint32_t ring_wr = 0;   // 自由递增计数，tcpip 线程写
+static volatile uint32_t ring_rd = 0;   // Net 任务写
+
+/* ========================================== */
+/* 3. TCP 回调 (tcpip 线程)                    */
+/* ========================================== */
+
+static void ota_detach(void) {
+    if (client != NULL) {
+        tcp_arg(client, NULL);
+        tcp_recv(client, NULL);
+        tcp_err(client, NULL);
+        tcp_poll(client, NULL, 0);
+    }
+    client = NULL;
+    state = OTA_IDLE;
+}
+
+static void ota_close(void) {
+    struct tcp_pcb *pcb = client;
+
+    ota_detach();
+    if (pcb != NULL && tcp_close(pcb) != ERR_OK) {
+        tcp_abort(pcb);
+    }
+}
+
+static void ota_reply(const char *msg, uint8_t close) {
+    if (client == NULL) return;
+    tcp_write(client, msg, (u16_t)strlen(msg), TCP_WRITE_FLAG_COPY);
+    tcp_output(client);
+    if (close) ota_close();
+}
+
+static err_t ota_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err) {
+    uint32_t off = 0;
+
+    if (p == NULL) {
+        ota_close();
+        return ERR_OK;
+    }
+    last_rx_tick = HAL_GetTick();
+
+    if (state == OTA_HDR) {
+        off = sizeof(hdr_buf) - hdr_len;
+        if (off > p->tot_len) off = p->tot_len;
+        pbuf_copy_partial(p, hdr_buf + hdr_len, (u16_t)off, 0);
+        hdr_len += off;
+        tcp_recved(pcb, (u16_t)off);
+        if (hdr_len == sizeof(hdr_buf)) state = OTA_BEGIN;
+    }
+    if (off < p->tot_len) {
+        uint32_t n = p->tot_len - off;
+        uint32_t pos = ring_wr % MODEL_OTA_RX_BUF;
+        uint32_t first = MODEL_OTA_RX_BUF - pos;
+
+        /* 回复续传偏移前就发来数据属于协议错误 */
+        if (state != OTA_DATA || n > MODEL_OTA_RX_BUF - (ring_wr - ring_rd)) {
+            pbuf_free(p);
+            ota_detach();
+            tcp_abort(pcb);
+            return ERR_ABRT;
+        }
+        if (first > n) first = n;
+        pbuf_copy_partial(p, rx_ring + pos, (u16_t)first, (u16_t)off);
+        if (n > first) pbuf_copy_partial(p, rx_ring, (u16_t)(n - first), (u16_t)(off + first));
+        __DMB();
+        ring_wr += n;
+    }
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+static void ota_err(void *arg, err_t err) {
+    client = NULL;   /* pcb 已被 lwIP 释放 */
+    state = OTA_IDLE;
+}
+
+static err_t ota_poll(void *arg, struct tcp_pcb *pcb) {
+    if (HAL_GetTick() - last_rx_tick > MODEL_OTA_IDLE_MS) {
+        printf("[MODEL] OTA client idle, closing\r\n");
+        ota_close();
+    }
+    return ERR_OK;
+}
+
+static err_t ota_accept(void *arg, struct tcp_pcb *newpcb, err_t err) {
+    static const char busy[] = "ERR busy\n";
+
+    if (err != ERR_OK || newpcb == NULL) return ERR_VAL;
+    if (client != NULL) {
+        tcp_write(newpcb, busy, sizeof(busy) - 1, 0);
+        tcp_close(newpcb);
+        return ERR_OK;
+    }
+
+    client = newpcb;
+    hdr_len = 0;
+    last_rx_tick = HAL_GetTick();
+    state = OTA_HDR;
+    tcp_arg(newpcb, NULL);
+    tcp_recv(newpcb, ota_recv);
+    tcp_err(newpcb, ota_err);
+    tcp_poll(newpcb, ota_poll, 4);
+    return ERR_OK;
+}
+
+/* ========================================== */
+/* 4. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  选出活动权重区 (AI_Inference_Init 调用，先于网络初始化)
+ * @retval 活动区权重地址；两区都无效时返回 NULL (使用链接的权重，不接受更新)
+ */
+const uint8_t *Model_Ota_Mount(uint32_t *version) {
+    ModelBankStats_t st;
+
+    if (Model_Bank_Mount(&hal_flash_ops, model_signature(), (const uint8_t *)s_vehicle_detector_weights_array_u64,
+                         sizeof(s_vehicle_detector_weights_array_u64)) != 0) {
+        printf("[MODEL] no valid weight slot, using linked weights (updates disabled)\r\n");
+        return NULL;
+    }
+    Model_Bank_GetStats(&st);
+    printf("[MODEL] slot %c active: v%ld gen %ld%s, signature 0x%08lX\r\n", 'A' + (char)st.active, st.version,
+           st.generation, (st.generation == 0) ? " (built-in)" : "", Model_Bank_Signature());
+    return Model_Bank_Weights(version);
+}
+
+int8_t Model_Ota_Init(void) {
+    struct tcp_pcb *pcb;
+    int8_t ret = -1;
+
+    LOCK_TCPIP_CORE();
+    pcb = tcp_new();
+    if (pcb != NULL && tcp_bind(pcb, IP_ADDR_ANY, MODEL_OTA_PORT) == ERR_OK) {
+        listen_pcb = tcp_listen_with_backlog(pcb, 1);
+        if (listen_pcb != NULL) {
+            tcp_accept(listen_pcb, ota_accept);
+            ret = 0;
+        }
+    } else if (pcb != NULL) {
+        tcp_close(pcb);
+    }
+    UNLOCK_TCPIP_CORE();
+
+    if (ret == 0) {
+        printf("[MODEL] weight update on TCP port %d\r\n", MODEL_OTA_PORT);
+    }
+    return ret;
+}
+
+/**
+ * @brief  把已收到的数据写入非活动区，收齐后校验提交 (Net 任务调用)
+ * @note   环形缓冲里已收到的数据即使连接已断开也照常写入，续传点因此尽量靠后；
+ *         新连接的头在缓冲写空之后才处理。扇区擦除期间数据留在缓冲中，
+ *         tcp_recved 随之停止，发送方被 TCP 窗口挡住，擦完后继续
+ */
+void Model_Ota_Poll(void) {
+    uint32_t consumed = 0;
+    uint32_t resume = 0;
+    int8_t r = 0;
+    int8_t begun = 0;
+    int8_t erase;
+    char msg[32];
+    ModelBankStats_t st;
+
+    if (listen_pcb == NULL) return;
+
+    erase = Model_Bank_Poll();
+    if (erase < 0) r = -1;
+
+    /* 会话已结束或作废时丢弃剩余数据 */
+    Model_Bank_GetStats(&st);
+    while (ring_rd != ring_wr && erase == 0) {
+        uint32_t pos = ring_rd % MODEL_OTA_RX_BUF;
+        uint32_t n = ring_wr - ring_rd;
+        uint32_t used;
+        if (n > MODEL_OTA_RX_BUF - pos) n = MODEL_OTA_RX_BUF - pos;
+        used = n;
+        if (r == 0 && st.receiving) {
+            r = Model_Bank_Write(rx_ring + pos, n, &used);
+            if (r == 0 && used < n) {   /* 启动了扇区擦除，剩余数据下个节拍再写 */
+                ring_rd += used;
+                consumed += used;
+                break;
+            }
+        }
+        ring_rd += used;
+        consumed += used;
+    }
+    if (r == 1) r = (Model_Bank_Finish() == 0) ? 1 : -1;
+    Model_Bank_GetStats(&st);
+
+    LOCK_TCPIP_CORE();
+    if (state == OTA_DATA) {
+        if (consumed > 0) tcp_recved(client, (u16_t)consumed);
+        if (r == 1) {
+            snprintf(msg, sizeof(msg), "OK %lu\n", st.rx_version);
+            ota_reply(msg, 1);
+        } else if (r < 0) {
+            ota_reply("ERR verify\n", 1);
+        }
+    } else if (state == OTA_BEGIN && ring_rd == ring_wr) {
+        ModelBlobHdr_t hdr;
+        memcpy(&hdr, hdr_buf, sizeof(hdr));
+        if (Model_Bank_Begin(&hdr, &resume) == 0) {
+            snprintf(msg, sizeof(msg), "RESUME %lu\n", resume);
+            state = OTA_DATA;
+            ota_reply(msg, 0);
+            begun = 1;
+        } else {
+            ota_reply("ERR rejected\n", 1);
+            begun = -1;
+        }
+    }
+    UNLOCK_TCPIP_CORE();
+
+    if (begun == 1) {
+        if (resume == 0) {
+            session_tick = HAL_GetTick();
+            session_fallbacks = st.fallback_reads;
+            erase_ms_max = 0;
+        }
+        printf("[MODEL] receiving v%ld (%ld B) into slot B from offset %ld\r\n",
+               st.rx_version, st.rx_size, resume);
+    } else if (begun < 0) {
+        printf("[MODEL] update rejected (bad header or signature mismatch)\r\n");
+    }
+    if (r == 1) {
+        printf("[MODEL] v%ld verified and committed in %ld ms (%ld resumes), active from the next inference\r\n",
+               st.rx_version, HAL_GetTick() - session_tick, st.resumes);
+        printf("[MODEL] sector erase max %ld ms, %ld inferences fell back to the built-in weights while erasing\r\n",
+               erase_ms_max, st.fallback_reads - session_fallbacks);
+    } else if (r < 0) {
+        printf("[MODEL] update failed: rejected=%ld write errors=%ld\r\n", st.rejected, st.write_errors);
+    }
+}
@@ -0,0 +1,164 @@
+#include "Motion_Detect.h"
+#include "app_config.h"
+
+/* ========================================== */
+/* 1. 背景模型与运动块                          */
+/* ========================================== */
+#define MOTION_GRID_W  (CAM_RES_WIDTH / MOTION_CELL)
+#define MOTION_GRID_H  (CAM_RES_HEIGHT / MOTION_CELL)
+
+_Static_assert(MOTION_CELL == JPEG_STRIP_LINES, "one motion grid row per DCMI strip");
+
+/* 运动块：按行合并相邻的运动格游程 (格坐标，含端点) */
+typedef struct {
+    int16_t  x0, x1, y0, y1;
+    uint16_t cells;
+} MotionBlob_t;
+
+static uint16_t bg[MOTION_GRID_H][MOTION_GRID_W];   // 背景亮度 (Q8)
+static uint32_t frames = 0;                          // 已学习的帧数 (预热期内只更新背景)
+static MotionBlob_t blobs[MOTION_MAX_BLOBS];
+static uint8_t  n_blobs = 0;
+static uint16_t cells = 0;                           // 本帧运动格数
+static uint16_t last_cells = 0;
+
+/* ========================================== */
+/* 2. 条带处理 (延后工作任务中调用)            */
+/* ========================================== */
+
+/* RGB565 (大端) 近似亮度：0.30R + 0.59G + 0.11B */
+static inline uint32_t luma565(const uint8_t *s) {
+    uint16_t px = (uint16_t)((s[0] << 8) | s[1]);
+    return (((px >> 8) & 0xF8) * 77U + ((px >> 3) & 0xFC) * 150U + ((uint8_t)(px << 3)) * 29U) >> 8;
+}
+
+static void blob_absorb(MotionBlob_t *dst, const MotionBlob_t *src) {
+    if (src->x0 < dst->x0) dst->x0 = src->x0;
+    if (src->x1 > dst->x1) dst->x1 = src->x1;
+    if (src->y0 < dst->y0) dst->y0 = src->y0;
+    if (src->y1 > dst->y1) dst->y1 = src->y1;
+    dst->cells += src->cells;
+}
+
+/**
+ * @brief  把第 row 行的运动游程 [x0, x1] 并入与之 8 邻接的块，连接两个块时合并之
+ * @note   块数已满时并入水平距离最近的块
+ */
+static void blob_add_run(int16_t row, int16_t x0, int16_t x1) {
+    MotionBlob_t run = { x0, x1, row, row, (uint16_t)(x1 - x0 + 1) };
+    int8_t hit = -1, nearest = -1;
+    int16_t best = INT16_MAX;
+
+    for (uint8_t i = 0; i < n_blobs; i++) {
+        MotionBlob_t *b = &blobs[i];
+        if (b->y1 >= row - 1 && b->x0 <= x1 + 1 && b->x1 >= x0 - 1) {
+            if (hit < 0) {
+                hit = (int8_t)i;
+                blob_absorb(b, &run);
+            } else {
+                blob_absorb(&blobs[hit], b);           /* 游程连通了两个块 */
+                blobs[i--] = blobs[--n_blobs];
+            }
+            continue;
+        }
+        int16_t dist = (b->x0 > x1) ? b->x0 - x1 : (x0 > b->x1 ? x0 - b->x1 : 0);
+        if (dist < best) {
+            best = dist;
+            nearest = (int8_t)i;
+        }
+    }
+    if (hit >= 0) return;
+    if (n_blobs < MOTION_MAX_BLOBS) blobs[n_blobs++] = run;
+    else blob_absorb(&blobs[nearest], &run);
+}
+
+/**
+ * @brief  处理一个条带：每格在中间行抽 4 个像素求平均，与背景比较，运动格按行并入运动块
+ * @param  strip_idx: 条带在帧内的序号 (0 为帧首)
+ * @note   每条带 50 格 x 4 像素，开销约为缩略图抽样的 2/3
+ */
+void Motion_AddStrip(const uint8_t *strip, uint16_t strip_idx) {
+    const uint8_t *line = strip + (MOTION_CELL / 2) * CAM_RES_WIDTH * 2;
+    uint16_t *row = bg[strip_idx];
+    int16_t run_start = -1;
+
+    if (strip_idx == 0) {
+        cells = 0;
+        n_blobs = 0;
+    }
+    if (strip_idx >= MOTION_GRID_H) return;
+
+    for (uint16_t cx = 0; cx <= MOTION_GRID_W; cx++) {
+        uint8_t active = 0;
+
+        if (cx < MOTION_GRID_W) {
+            const uint8_t *s = line + (cx * MOTION_CELL + MOTION_CELL / 8) * 2;   /* 格内第 2/6/10/14 列 */
+            uint32_t y = luma565(s) + luma565(s + MOTION_CELL / 4 * 2) +
+                         luma565(s + MOTION_CELL / 2 * 2) + luma565(s + MOTION_CELL * 3 / 4 * 2);
+            int32_t cur = (int32_t)(y << 6);          // 4 点平均，Q8
+            int32_t d = cur - row[cx];
+
+            if (frames < MOTION_WARMUP_FRAMES) {
+                row[cx] = (uint16_t)(row[cx] + d / 4);    // 预热：快速建立背景
+            } else if (d > (MOTION_THRESH << 8) || d < -(MOTION_THRESH << 8)) {
+                active = 1;
+                cells++;
+                row[cx] = (uint16_t)(row[cx] + d / 64);   // 前景处慢速吸收，停住的车辆最终并入背景
+            } else {
+                row[cx] = (uint16_t)(row[cx] + d / 16);
+            }
+        }
+        if (active && run_start < 0) {
+            run_start = (int16_t)cx;
+        } else if (!active && run_start >= 0) {
+            blob_add_run((int16_t)strip_idx, run_start, (int16_t)(cx - 1));
+            run_start = -1;
+        }
+    }
+}
+
+/**
+ * @brief  帧末调用，给出各运动区域 (像素坐标，按运动格数从多到少)
+ * @param  max: boxes 容量
+ * @retval 区域数 (运动格数 < MOTION_MIN_CELLS 的块视为噪声丢弃)；预热期内为 0
+ */
+uint8_t Motion_EndFrame(VisionRect_t *boxes, uint8_t max) {
+    uint8_t n = 0;
+
+    if (frames < MOTION_WARMUP_FRAMES) frames++;
+    last_cells = cells;
+
+    /* 外接框相交的块合并 (游程合并只看相邻行，U 形目标可能被拆开) */
+    for (uint8_t i = 0; i < n_blobs; i++) {
+        for (uint8_t j = i + 1; j < n_blobs; j++) {
+            if (blobs[i].x0 <= blobs[j].x1 && blobs[j].x0 <= blobs[i].x1 &&
+                blobs[i].y0 <= blobs[j].y1 && blobs[j].y0 <= blobs[i].y1) {
+                blob_absorb(&blobs[i], &blobs[j]);
+                blobs[j] = blobs[--n_blobs];
+                j = i;   /* 框变大了，重新检查 */
+            }
+        }
+    }
+
+    /* 按运动格数从多到少输出 (块数很少，直接选择排序) */
+    while (n < max) {
+        int8_t best = -1;
+        for (uint8_t i = 0; i < n_blobs; i++) {
+            if (blobs[i].cells >= MOTION_MIN_CELLS && (best < 0 || blobs[i].cells > blobs[best].cells)) {
+                best = (int8_t)i;
+            }
+        }
+        if (best < 0) break;
+        boxes[n].x = (int16_t)(blobs[best].x0 * MOTION_CELL);
+        boxes[n].y = (int16_t)(blobs[best].y0 * MOTION_CELL);
+        boxes[n].w = (uint16_t)((blobs[best].x1 - blobs[best].x0 + 1) * MOTION_CELL);
+        boxes[n].h = (uint16_t)((blobs[best].y1 - blobs[best].y0 + 1) * MOTION_CELL);
+        blobs[best].cells = 0;   /* 已输出 */
+        n++;
+    }
+    return n;
+}
+
+uint16_t Motion_LastCells(void) {
+    return last_cells;
+}
@@ -0,0 +1,146 @@
+#include "Net_Auth.h"
+#include "app_config.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. SHA-256 (FIPS 180-4)                     */
+/* ========================================== */
+/*
+ * 控制报文只有几十到一百多字节、频率很低，软件实现即可 (约 10 us/块)，
+ * 不启用 HASH 外设，也不占用与证据日志/租约共享的硬件 CRC。
+ */
+typedef struct {
+    uint32_t h[8];
+    uint64_t len;             /* 已输入的字节数 */
+    uint8_t  buf[64];
+    uint32_t fill;
+} Sha256_t;
+
+static const uint32_t K[64] = {
+    0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+    0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+    0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+    0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+    0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+    0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+    0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+    0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL,
+};
+
+static inline uint32_t ror(uint32_t x, uint32_t n) {
+    return (x >> n) | (x << (32U - n));
+}
+
+static void sha256_block(Sha256_t *s, const uint8_t *p) {
+    uint32_t w[64], a, b, c, d, e, f, g, h, t1, t2;
+
+    for (uint32_t i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)p[4 * i] << 24) | ((uint32_t)p[4 * i + 1] << 16) |
+               ((uint32_t)p[4 * i + 2] << 8) | (uint32_t)p[4 * i + 3];
+    }
+    for (uint32_t i = 16; i < 64; i++) {
+        uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    a = s->h[0]; b = s->h[1]; c = s->h[2]; d = s->h[3];
+    e = s->h[4]; f = s->h[5]; g = s->h[6]; h = s->h[7];
+    for (uint32_t i = 0; i < 64; i++) {
+        t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+        t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    s->h[0] += a; s->h[1] += b; s->h[2] += c; s->h[3] += d;
+    s->h[4] += e; s->h[5] += f; s->h[6] += g; s->h[7] += h;
+}
+
+static void sha256_init(Sha256_t *s) {
+    static const uint32_t iv[8] = {
+        0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+        0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL,
+    };
+    memcpy(s->h, iv, sizeof(iv));
+    s->len = 0;
+    s->fill = 0;
+}
+
+static void sha256_update(Sha256_t *s, const uint8_t *p, uint32_t len) {
+    s->len += len;
+    while (len > 0) {
+        uint32_t n = 64U - s->fill;
+        if (n > len) n = len;
+        memcpy(s->buf + s->fill, p, n);
+        s->fill += n;
+        p += n;
+        len -= n;
+        if (s->fill == 64U) {
+            sha256_block(s, s->buf);
+            s->fill = 0;
+        }
+    }
+}
+
+static void sha256_final(Sha256_t *s, uint8_t out[32]) {
+    uint64_t bits = s->len * 8U;
+
+    s->buf[s->fill++] = 0x80;
+    if (s->fill > 56U) {
+        memset(s->buf + s->fill, 0, 64U - s->fill);
+        sha256_block(s, s->buf);
+        s->fill = 0;
+    }
+    memset(s->buf + s->fill, 0, 56U - s->fill);
+    for (uint32_t i = 0; i < 8; i++) s->buf[56 + i] = (uint8_t)(bits >> (56U - 8U * i));
+    sha256_block(s, s->buf);
+    for (uint32_t i = 0; i < 8; i++) {
+        out[4 * i] = (uint8_t)(s->h[i] >> 24);
+        out[4 * i + 1] = (uint8_t)(s->h[i] >> 16);
+        out[4 * i + 2] = (uint8_t)(s->h[i] >> 8);
+        out[4 * i + 3] = (uint8_t)s->h[i];
+    }
+}
+
+/* ========================================== */
+/* 2. HMAC (RFC 2104)                          */
+/* ========================================== */
+
+/**
+ * @brief  计算 msg 的 HMAC-SHA256 标签 (密钥 NET_AUTH_KEY)
+ */
+void Net_Auth_Tag(const uint8_t *msg, uint32_t len, uint8_t tag[NET_AUTH_TAG_LEN]) {
+    static const char key[] = NET_AUTH_KEY;
+    uint8_t pad[64];
+    uint8_t inner[32];
+    Sha256_t s;
+
+    _Static_assert(sizeof(key) - 1U <= sizeof(pad), "NET_AUTH_KEY longer than the SHA-256 block");
+
+    memset(pad, 0, sizeof(pad));
+    memcpy(pad, key, sizeof(key) - 1U);
+    for (uint32_t i = 0; i < sizeof(pad); i++) pad[i] ^= 0x36;
+    sha256_init(&s);
+    sha256_update(&s, pad, sizeof(pad));
+    sha256_update(&s, msg, len);
+    sha256_final(&s, inner);
+
+    for (uint32_t i = 0; i < sizeof(pad); i++) pad[i] ^= 0x36 ^ 0x5c;
+    sha256_init(&s);
+    sha256_update(&s, pad, sizeof(pad));
+    sha256_update(&s, inner, sizeof(inner));
+    sha256_final(&s, tag);
+}
+
+/**
+ * @brief  校验报文标签 (比较耗时与内容无关)
+ * @retval 0: 通过; -1: 不符
+ */
+int8_t Net_Auth_Verify(const uint8_t *msg, uint32_t len, const uint8_t *tag) {
+    uint8_t expect[NET_AUTH_TAG_LEN];
+    uint8_t diff = 0;
+
+    Net_Auth_Tag(msg, len, expect);
+    for (uint32_t i = 0; i < NET_AUTH_TAG_LEN; i++) diff |= (uint8_t)(expect[i] ^ tag[i]);
+    return (diff == 0) ? 0 : -1;
+}
@@ -1,9 +1,21 @@
 #include "Net_Client.h"
+#include "Net_Store.h"
+#include "Evidence_Log.h"
+#include "Net_Lease.h"
+#include "Net_Auth.h"
+#include "Boot_Timing.h"
+#include "Policy_Engine.h"
+#include "Log.h"
 #include "app_config.h"
+#include "cmsis_os.h"
 #include "lwip/udp.h"
 #include "lwip/pbuf.h"
 #include "lwip/etharp.h"
 #include "lwip/netif.h"
+#include "lwip/dhcp.h"
+#include "lwip/prot/dhcp.h"
+#include "lwip/tcpip.h"
+#include "lwip/init.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -12,27 +24,164 @@ extern ETH_HandleTypeDef heth;
 
 NetCtrl_t g_net_ctrl = {0};
 
+#define NET_MAX_UDP_PAYLOAD   1400
+#define NET_MAX_CONSEC_FAIL   20   /* 连续失败上限，避免路由不可达时死循环 */
+
+static NetLease_t net_lease = {0};   // 当前租约/目标的内存副本，变化时写回备份 SRAM
+
+static const char * const addr_src_name[] = { "none", "dhcp-cached", "dhcp", "static" };
+
+static uint32_t ev_resume_seq = 0;       // 证据日志补发断点：记录序号
+static uint32_t ev_resume_off = 0;       // 该记录已发出的字节数
+
+static NetHandoffStats_t handoff = {0};   // 当前统计窗口
+static uint32_t handoff_tick = 0;         // 窗口起点
+#if NET_HANDOFF_BASELINE
+#define NET_HANDOFF_TAG " (polled baseline)"   // 编译期拼进格式串 (LOG_I 二进制模式不支持 %s)
+#else
+#define NET_HANDOFF_TAG ""
+#endif
+static uint32_t evt_dropped = 0;          // 向 Q_Net_Handle 投递失败的事件数 (累计)
+
+/* tcpip 线程收到的订阅包，由 Net 任务认证后生效 (与策略表的处理方式相同) */
+static uint8_t sub_buf[NET_SUB_LEN];
+static ip_addr_t sub_src;
+static volatile uint8_t sub_pending = 0;
+static uint32_t sub_rejected = 0;         // 认证失败或计数回退的订阅包
+
+/**
+ * @brief  RAM 缓存池满时，被挤出的最旧记录转存到 Flash 证据日志
+ */
+static void net_spill_to_flash(const NetRecord_t *rec) {
+    if (Evidence_Log_Append((EvidRecType_t)rec->type, rec->pData, rec->len, rec->frame_id) != 0) {
+        printf("[NET] Evidence spill failed, frame %ld lost\r\n", rec->frame_id);
+    }
+}
+
+/**
+ * @brief  控制包回调 (tcpip 线程)：只转存，认证与生效都由 Net 任务完成
+ * @note   以 "POL1" 开头、长度为 POLICY_MSG_LEN 的包是策略热加载；"SUB1" 订阅包见 Net_Client.h；
+ *         其余包丢弃。订阅包认证之前不改 dest_addr，未认证的主机无法把记录引到自己那里
+ */
+static void net_udp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port) {
+    uint8_t table[POLICY_MSG_LEN];
+    uint32_t magic = 0;
+
+    pbuf_copy_partial(p, &magic, sizeof(magic), 0);
+    if (magic == POLICY_MAGIC && p->tot_len == sizeof(table) &&
+        pbuf_copy_partial(p, table, sizeof(table), 0) == sizeof(table)) {
+        if (Policy_Submit(table, sizeof(table)) != 0) {
+            printf("[NET] Policy update ignored (previous one pending)\r\n");
+        }
+    } else if (magic == NET_SUB_MAGIC && p->tot_len == NET_SUB_LEN && !sub_pending) {
+        pbuf_copy_partial(p, sub_buf, NET_SUB_LEN, 0);
+        ip_addr_copy(sub_src, *addr);
+        __sync_synchronize();
+        sub_pending = 1;
+    }
+    pbuf_free(p);
+}
+
+/**
+ * @brief  把 DHCP 客户端置为 INIT-REBOOT (RFC 2131 4.3.2) 并指定请求的地址 (调用方持 tcpip 核心锁)
+ * @retval 0: 成功; -1: 当前 lwIP 版本不支持，调用方走完整 DISCOVER
+ * @note   lwIP 没有以已知地址启动 INIT-REBOOT 的公开接口 (dhcp_reboot 为 static)，
+ *         这里直接改 struct dhcp 的 offered_ip_addr 与 state，依赖 2.1.x 的以下行为：
+ *         dhcp_network_changed 对 REBOOTING 状态调用 dhcp_reboot，以 offered_ip_addr 发 REQUEST，
+ *         NAK 或重试耗尽后回到 dhcp_discover。升级 lwIP 时需对照 dhcp.c 复核后再放开版本号。
+ */
+static int8_t net_dhcp_force_reboot_state(struct netif *netif, uint32_t ip) {
+#if (LWIP_VERSION_MAJOR == 2) && (LWIP_VERSION_MINOR == 1)
+    struct dhcp *dhcp = netif_dhcp_data(netif);
+
+    if (dhcp == NULL || dhcp->state == DHCP_STATE_OFF) return -1;
+    ip4_addr_set_u32(&dhcp->offered_ip_addr, ip);
+    dhcp->state = DHCP_STATE_REBOOTING;
+    return 0;
+#else
+#warning "net_dhcp_force_reboot_state: unverified lwIP version, cached DHCP lease disabled"
+    (void)netif;
+    (void)ip;
+    return -1;
+#endif
+}
+
+/**
+ * @brief  用缓存租约走 INIT-REBOOT：直接 REQUEST 原地址，省去 DISCOVER/OFFER 往返
+ * @note   服务器 NAK 或无应答时 lwIP 会自行退回完整 DISCOVER 流程
+ * @retval 0: 已切换到 INIT-REBOOT; -1: 仍走 DISCOVER
+ */
+static int8_t net_dhcp_reboot(struct netif *netif) {
+    int8_t ret;
+
+    LOCK_TCPIP_CORE();
+    ret = net_dhcp_force_reboot_state(netif, net_lease.ip);
+    /* 链路尚未建立时由 netif_set_link_up 触发 dhcp_network_changed */
+    if (ret == 0 && netif_is_link_up(netif)) {
+        dhcp_network_changed(netif);
+    }
+    UNLOCK_TCPIP_CORE();
+    return ret;
+}
+
 int8_t Net_Client_Init(void) {
+    struct netif *netif = netif_default;
+
+    uint32_t t0 = HAL_GetTick();
+
+    Net_Store_Init();
+    if (Evidence_Log_Mount(Evidence_Flash_Ops()) == 0) {
+        EvidStats_t ev;
+        Evidence_Log_GetStats(&ev);
+        printf("[NET] Evidence log mounted in %ld ms (seq %ld, acked %ld, torn %ld)\r\n",
+               HAL_GetTick() - t0, ev.next_seq, ev.acked_seq, ev.torn_records);
+        Net_Store_SetEvictHook(net_spill_to_flash);
+    } else {
+        printf("[NET] Evidence log mount failed, offline records limited to RAM\r\n");
+    }
+
     g_net_ctrl.upcb = udp_new();
     if (g_net_ctrl.upcb == NULL) {
         g_net_ctrl.state = NET_ERROR;
         return -1;
     }
-    IP4_ADDR(&g_net_ctrl.dest_addr, DEST_IP_ADDR0, DEST_IP_ADDR1, DEST_IP_ADDR2, DEST_IP_ADDR3);
+    ip_addr_set_zero(&g_net_ctrl.dest_addr);
     udp_bind(g_net_ctrl.upcb, IP_ADDR_ANY, UDP_LOCAL_PORT);
-    
-    /* 强制发起 ARP 请求，确保知道目标 MAC */
-    struct netif *netif = netif_default;
-    if (netif != NULL) {
-        etharp_request(netif, &g_net_ctrl.dest_addr);
-        printf("[NET] ARP request sent to %d.%d.%d.%d\r\n",
-               DEST_IP_ADDR0, DEST_IP_ADDR1, DEST_IP_ADDR2, DEST_IP_ADDR3);
+    udp_recv(g_net_ctrl.upcb, net_udp_recv, NULL);
+
+    /* 复位前的租约仍在备份 SRAM 中：立即请求原地址并沿用原目标 */
+    Net_Lease_Init();
+    if (netif != NULL && Net_Lease_Load(&net_lease) == 0) {
+        g_net_ctrl.lease_cached = 1;
+        ip4_addr_set_u32(ip_2_ip4(&g_net_ctrl.dest_addr), net_lease.dest_ip);
+        printf("[NET] Cached lease %s, %s\r\n", ip4addr_ntoa((const ip4_addr_t *)&net_lease.ip),
+               (net_dhcp_reboot(netif) == 0) ? "INIT-REBOOT" : "DISCOVER");
+    } else {
+        memset(&net_lease, 0, sizeof(net_lease));
     }
-    
-    g_net_ctrl.state = NET_READY;
+
+    g_net_ctrl.link_up = (netif != NULL && netif_is_link_up(netif)) ? 1 : 0;
+    if (g_net_ctrl.link_up) {
+        Boot_Mark(BOOT_LINK_UP);
+    }
+    g_net_ctrl.addr_wait_tick = HAL_GetTick();
+    /* 链路与地址都就绪后由 Poll 切换到 NET_READY，在此之前的帧进入断网缓存 */
+    g_net_ctrl.state = NET_WAIT_LINK;
     return 0;
 }
 
+/**
+ * @brief  链路状态变化通知 (lwip.c 的 link 回调中调用)
+ * @note   运行在 EthLink 线程，只更新标志，状态迁移由 Net 任务在 Poll 中完成
+ */
+void Net_Client_LinkChanged(uint8_t up) {
+    g_net_ctrl.link_up = up;
+    if (up) {
+        Boot_Mark(BOOT_LINK_UP);
+    }
+    printf("[NET] Link %s\r\n", up ? "UP" : "DOWN");
+}
+
 /**
  * @brief  诊断函数：严格基于官方库结构体成员进行硬件自检
  */
@@ -52,7 +201,24 @@ void Net_Client_Diagnostic(void) {
     printf("State: 0x%lX (0x40=STARTED)\r\n", current_state);
     printf("TX_Base: 0x%lX | RX_Base: 0x%lX\r\n", run_tx_base, run_rx_base);
     printf("TX_Idx: %ld | RX_Idx: %ld\r\n", tx_idx, rx_idx);
-    printf("TX_Frames: %ld | Net_State: %d\r\n", g_net_ctrl.tx_frame_count, (int)g_net_ctrl.state);
+    printf("TX_Frames: %ld | Net_State: %d | Evt_Dropped: %ld | Sub_Rejected: %ld\r\n",
+           g_net_ctrl.tx_frame_count, (int)g_net_ctrl.state, evt_dropped, sub_rejected);
+    if (netif_default != NULL) {
+        printf("IP: %s (%s)", ip4addr_ntoa(netif_ip4_addr(netif_default)), addr_src_name[g_net_ctrl.addr_src]);
+        printf(" -> %s%s\r\n", ipaddr_ntoa(&g_net_ctrl.dest_addr), g_net_ctrl.arp_static ? " [static ARP]" : "");
+    }
+
+    NetStoreStats_t st;
+    Net_Store_GetStats(&st);
+    printf("Store: %ld rec, %ld/%ld B (hw %ld) | dropped_oldest=%ld drained=%ld partial=%ld drain_ms=%ld\r\n",
+           st.records, st.used_bytes, st.capacity, st.high_water,
+           st.dropped_oldest, st.drained, st.partial, st.drain_ms_last);
+
+    EvidStats_t ev;
+    Evidence_Log_GetStats(&ev);
+    printf("Evidence: seq %ld acked %ld | +%ld up %ld lost %ld err %ld | erase %ld~%ld\r\n",
+           ev.next_seq, ev.acked_seq, ev.appended, ev.uploaded,
+           ev.lost_unsent, ev.write_errors, ev.erase_min, ev.erase_max);
 
     /* 4. [New] 硬件寄存器直接诊断 (解决地址漂移) */
     volatile uint32_t hw_tx_base = heth.Instance->DMACTDLAR;
@@ -74,36 +240,42 @@ void Net_Client_Diagnostic(void) {
     }
 }
 
-void Net_Client_SendImage(uint8_t *pData, uint32_t len, uint32_t frame_id) {
-    printf("[NET] SendImage: pData=0x%lX, len=%ld\r\n", (uint32_t)pData, len);
-    if (g_net_ctrl.state != NET_READY || pData == NULL || len == 0) {
-        printf("[NET] SKIP: state not ready or invalid params\r\n");
-        return;
-    }
-
+/**
+ * @brief  UDP 分片零拷贝发送 (PBUF_ROM 直接引用源缓冲区)
+ * @param  sent: 输出已发出的字节数 (整片计)，中途失败时调用方据此只缓存/续发剩余部分
+ * @retval 0: 全部发出; -1: 中途失败
+ */
+static int8_t net_send_chunks(const uint8_t *pData, uint32_t len, uint16_t port, uint32_t frame_id, uint32_t *sent) {
     struct pbuf *ptr_pbuf;
     uint32_t bytes_left = len;
     uint32_t current_offset = 0;
     uint32_t chunk_size;
-    const uint32_t max_udp_payload = 1400;
-    uint32_t sent_ok = 0, sent_fail = 0;
+    uint32_t sent_ok = 0, sent_fail = 0, consec_fail = 0;
     err_t err;
 
-    g_net_ctrl.state = NET_SENDING;
     SCB_CleanDCache_by_Addr((uint32_t*)pData, len);
 
     while (bytes_left > 0) {
-        chunk_size = (bytes_left > max_udp_payload) ? max_udp_payload : bytes_left;
+        chunk_size = (bytes_left > NET_MAX_UDP_PAYLOAD) ? NET_MAX_UDP_PAYLOAD : bytes_left;
         ptr_pbuf = pbuf_alloc(PBUF_TRANSPORT, chunk_size, PBUF_ROM);
         if (ptr_pbuf != NULL) {
             ptr_pbuf->payload = (void *)(pData + current_offset);
-            err = udp_sendto(g_net_ctrl.upcb, ptr_pbuf, &g_net_ctrl.dest_addr, UDP_REMOTE_PORT);
+            /* dest_addr 由订阅处理在持核心锁时改写，与 pcb 一样只在锁内使用 */
+            LOCK_TCPIP_CORE();
+            err = udp_sendto(g_net_ctrl.upcb, ptr_pbuf, &g_net_ctrl.dest_addr, port);
+            UNLOCK_TCPIP_CORE();
             if (err == ERR_OK) {
                 bytes_left -= chunk_size;
                 current_offset += chunk_size;
                 sent_ok++;
+                consec_fail = 0;
             } else {
                 sent_fail++;
+                g_net_ctrl.last_error_code = (uint32_t)(-err);
+                if (++consec_fail >= NET_MAX_CONSEC_FAIL) {
+                    pbuf_free(ptr_pbuf);
+                    break;
+                }
             }
             pbuf_free(ptr_pbuf);
             
@@ -116,7 +288,360 @@ void Net_Client_SendImage(uint8_t *pData, uint32_t len, uint32_t frame_id) {
             break;
         }
     }
-    printf("[NET] Frame %ld: %ld OK, %ld FAIL\r\n", frame_id, sent_ok, sent_fail);
-    g_net_ctrl.tx_frame_count++;
+    LOG_I("[NET] Frame %ld: %ld OK, %ld FAIL\r\n", frame_id, sent_ok, sent_fail);
+    *sent = current_offset;
+    return (bytes_left == 0) ? 0 : -1;
+}
+
+/**
+ * @brief  把记录从 sent 字节起拷入断网缓存，由 Poll 补发
+ */
+static void net_store(NetRecType_t type, const uint8_t *pData, uint32_t len, uint32_t sent, uint32_t frame_id) {
+    if (Net_Store_Push(type, pData + sent, len - sent, sent, frame_id) == 0) {
+        LOG_I("[NET] Frame %ld queued offline from byte %ld (%ld pending)\r\n", frame_id, sent, Net_Store_Count());
+    } else {
+        LOG_W("[NET] DROP: frame %ld too large for store (%ld bytes)\r\n", frame_id, len);
+    }
+}
+
+/**
+ * @brief  实时发送；链路不可用或发送失败时转入断网缓存
+ * @note   中途失败时已发出的分片不再缓存，只缓存剩余部分，避免接收端收到重复分片
+ */
+static void net_send_or_store(NetRecType_t type, const uint8_t *pData, uint32_t len, uint32_t frame_id) {
+    uint16_t port = (type == NET_REC_JPEG) ? UDP_REMOTE_PORT : UDP_RESULT_PORT;
+    uint32_t sent = 0;
+
+    if (g_net_ctrl.state == NET_READY && g_net_ctrl.link_up) {
+        g_net_ctrl.state = NET_SENDING;
+        int8_t ret = net_send_chunks(pData, len, port, frame_id, &sent);
+        g_net_ctrl.state = NET_READY;
+        if (ret == 0) {
+            if (type == NET_REC_JPEG) {
+                g_net_ctrl.tx_frame_count++;
+                Boot_Mark(BOOT_FIRST_TX);
+                Boot_Timing_Report(addr_src_name[g_net_ctrl.addr_src]);
+            }
+            return;
+        }
+    }
+
+    net_store(type, pData, len, sent, frame_id);
+}
+
+void Net_Client_SendImage(uint8_t *pData, uint32_t len, uint32_t frame_id) {
+    LOG_I("[NET] SendImage: pData=0x%lX, len=%ld\r\n", (uint32_t)pData, len);
+    if (g_net_ctrl.state == NET_ERROR || g_net_ctrl.state == NET_IDLE || pData == NULL || len == 0) {
+        LOG_W("[NET] SKIP: net not initialised or invalid params\r\n");
+        return;
+    }
+    net_send_or_store(NET_REC_JPEG, pData, len, frame_id);
+}
+
+/**
+ * @brief  不实时发送，直接拷入断网缓存 (源缓冲区须尽快归还时使用，如 AI 正在收回的借用槽)
+ */
+void Net_Client_StoreImage(const uint8_t *pData, uint32_t len, uint32_t frame_id) {
+    if (g_net_ctrl.state == NET_ERROR || g_net_ctrl.state == NET_IDLE || pData == NULL || len == 0) {
+        return;
+    }
+    net_store(NET_REC_JPEG, pData, len, 0, frame_id);
+}
+
+void Net_Client_SendResult(const uint8_t *pData, uint32_t len, uint32_t frame_id) {
+    if (g_net_ctrl.state == NET_ERROR || g_net_ctrl.state == NET_IDLE || pData == NULL || len == 0) {
+        return;
+    }
+    net_send_or_store(NET_REC_RESULT, pData, len, frame_id);
+}
+
+/**
+ * @brief  发送一条遥测记录 (单个数据报，发往 UDP_RESULT_PORT)；只发实时值，链路不可用时直接丢弃
+ * @retval 0: 已发出; -1: 未发出
+ */
+int8_t Net_Client_SendTelemetry(const uint8_t *pData, uint32_t len) {
+    struct pbuf *p;
+    err_t err;
+
+    if (g_net_ctrl.state != NET_READY || !g_net_ctrl.link_up || pData == NULL || len > NET_MAX_UDP_PAYLOAD) {
+        return -1;
+    }
+    SCB_CleanDCache_by_Addr((uint32_t *)pData, (int32_t)len);
+    p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)len, PBUF_ROM);
+    if (p == NULL) return -1;
+    p->payload = (void *)pData;
+    LOCK_TCPIP_CORE();
+    err = udp_sendto(g_net_ctrl.upcb, p, &g_net_ctrl.dest_addr, UDP_RESULT_PORT);
+    UNLOCK_TCPIP_CORE();
+    pbuf_free(p);
+    return (err == ERR_OK) ? 0 : -1;
+}
+
+/**
+ * @brief  拿到地址后的一次性处理：预置缓存的下一跳 MAC、向已订阅的目标发起 ARP
+ */
+static void net_on_addr_ready(struct netif *netif, NetAddrSrc_t src) {
+    const ip4_addr_t *ip = netif_ip4_addr(netif);
+
+    g_net_ctrl.addr_src = src;
+    Boot_Mark(BOOT_IP_READY);
+
+    LOCK_TCPIP_CORE();
+    if (net_lease.arp_valid && src != NET_ADDR_STATIC) {
+        ip4_addr_t arp_ip;
+        ip4_addr_set_u32(&arp_ip, net_lease.arp_ip);
+        if (etharp_add_static_entry(&arp_ip, (struct eth_addr *)net_lease.arp_mac) == ERR_OK) {
+            g_net_ctrl.arp_static = 1;
+            g_net_ctrl.arp_static_tick = HAL_GetTick();
+            g_net_ctrl.dest_mac_saved = 1;
+        }
+    }
+    if (!g_net_ctrl.arp_static && !ip_addr_isany(&g_net_ctrl.dest_addr) &&
+        !ip4_addr_isbroadcast(ip_2_ip4(&g_net_ctrl.dest_addr), netif)) {
+        etharp_request(netif, ip_2_ip4(&g_net_ctrl.dest_addr));
+    }
+    UNLOCK_TCPIP_CORE();
+
+    printf("[NET] IP %s (%s), dest %s%s\r\n", ip4addr_ntoa(ip), addr_src_name[src],
+           ip_addr_isany(&g_net_ctrl.dest_addr) ? "none (store only until a subscriber)" :
+           ipaddr_ntoa(&g_net_ctrl.dest_addr), g_net_ctrl.arp_static ? ", cached MAC" : "");
+}
+
+/**
+ * @brief  记下当前目标的下一跳 MAC (ARP 表中已有时)，下次复位直接复用
+ */
+static void net_learn_next_hop(struct netif *netif) {
+    const ip4_addr_t *dest = ip_2_ip4(&g_net_ctrl.dest_addr);
+    ip4_addr_t hop;
+    struct eth_addr *eth_ret = NULL;
+    const ip4_addr_t *ip_ret = NULL;
+    ssize_t idx;
+
+    if (ip4_addr_isbroadcast(dest, netif)) {
+        g_net_ctrl.dest_mac_saved = 1;
+        return;
+    }
+    if (ip4_addr_netcmp(dest, netif_ip4_addr(netif), netif_ip4_netmask(netif))) {
+        ip4_addr_copy(hop, *dest);
+    } else {
+        ip4_addr_copy(hop, *netif_ip4_gw(netif));
+    }
+
+    LOCK_TCPIP_CORE();
+    idx = etharp_find_addr(netif, &hop, &eth_ret, &ip_ret);
+    if (idx >= 0) {
+        net_lease.arp_ip = ip4_addr_get_u32(&hop);
+        memcpy(net_lease.arp_mac, eth_ret->addr, sizeof(net_lease.arp_mac));
+        net_lease.arp_valid = 1;
+    }
+    UNLOCK_TCPIP_CORE();
+
+    if (idx >= 0) {
+        Net_Lease_Save(&net_lease);
+        g_net_ctrl.dest_mac_saved = 1;
+    }
+}
+
+/**
+ * @brief  认证待处理的订阅包，通过后切换上报目标并记入租约缓存 (Net 任务)
+ */
+static void net_sub_poll(struct netif *netif) {
+    uint8_t msg[NET_SUB_LEN];
+    ip_addr_t src;
+    uint32_t counter, ip;
+
+    if (!sub_pending) return;
+    memcpy(msg, sub_buf, sizeof(msg));
+    ip_addr_copy(src, sub_src);
+    __sync_synchronize();
+    sub_pending = 0;
+
+    memcpy(&counter, msg + 4, sizeof(counter));
+    memcpy(&ip, msg + 8, sizeof(ip));
+    if (Net_Auth_Verify(msg, NET_SUB_LEN - NET_AUTH_TAG_LEN, msg + NET_SUB_LEN - NET_AUTH_TAG_LEN) != 0 ||
+        counter <= net_lease.sub_counter) {
+        sub_rejected++;
+        printf("[NET] Subscribe from %s rejected (bad tag or replayed counter %ld)\r\n", ipaddr_ntoa(&src), counter);
+        return;
+    }
+    if (ip == 0) ip = ip4_addr_get_u32(ip_2_ip4(&src));
+
+    LOCK_TCPIP_CORE();
+    ip4_addr_set_u32(ip_2_ip4(&g_net_ctrl.dest_addr), ip);
+    if (!ip4_addr_isbroadcast(ip_2_ip4(&g_net_ctrl.dest_addr), netif)) {
+        etharp_request(netif, ip_2_ip4(&g_net_ctrl.dest_addr));
+    }
+    UNLOCK_TCPIP_CORE();
+
+    g_net_ctrl.dest_mac_saved = 0;
+    net_lease.dest_ip = ip;
+    net_lease.sub_counter = counter;
+    Net_Lease_Save(&net_lease);
+    printf("[NET] New subscriber %s\r\n", ipaddr_ntoa(&g_net_ctrl.dest_addr));
+}
+
+/**
+ * @brief  地址获取/租约缓存/静态 ARP 维护 (Net 任务上下文)
+ */
+static void net_addr_poll(void) {
+    struct netif *netif = netif_default;
+
+    if (netif == NULL) return;
+
+    if (g_net_ctrl.addr_src == NET_ADDR_NONE) {
+        if (!g_net_ctrl.link_up) {
+            g_net_ctrl.addr_wait_tick = HAL_GetTick();
+            return;
+        }
+        if (dhcp_supplied_address(netif)) {
+            uint8_t reused = g_net_ctrl.lease_cached &&
+                             ip4_addr_get_u32(netif_ip4_addr(netif)) == net_lease.ip;
+            if (!reused) {
+                net_lease.arp_valid = 0; /* 换了网段，缓存的下一跳不再可信 */
+            }
+            net_on_addr_ready(netif, reused ? NET_ADDR_DHCP_CACHED : NET_ADDR_DHCP);
+        } else if (HAL_GetTick() - g_net_ctrl.addr_wait_tick > NET_DHCP_FALLBACK_MS) {
+            /* 无 DHCP 服务器 (如直连调试)：停止 DHCP，回退到编译期静态地址 */
+            ip4_addr_t ip, mask, gw;
+            IP4_ADDR(&ip, LOCAL_IP_ADDR0, LOCAL_IP_ADDR1, LOCAL_IP_ADDR2, LOCAL_IP_ADDR3);
+            IP4_ADDR(&mask, 255, 255, 255, 0);
+            IP4_ADDR(&gw, LOCAL_IP_ADDR0, LOCAL_IP_ADDR1, LOCAL_IP_ADDR2, 1);
+            LOCK_TCPIP_CORE();
+            dhcp_stop(netif);
+            netif_set_addr(netif, &ip, &mask, &gw);
+            UNLOCK_TCPIP_CORE();
+            printf("[NET] DHCP timeout, fallback to static address\r\n");
+            net_on_addr_ready(netif, NET_ADDR_STATIC);
+        }
+        return;
+    }
+
+    /* DHCP 绑定/续约后地址变化时刷新缓存 */
+    if (g_net_ctrl.addr_src != NET_ADDR_STATIC && dhcp_supplied_address(netif) &&
+        ip4_addr_get_u32(netif_ip4_addr(netif)) != net_lease.ip) {
+        net_lease.ip = ip4_addr_get_u32(netif_ip4_addr(netif));
+        net_lease.netmask = ip4_addr_get_u32(netif_ip4_netmask(netif));
+        net_lease.gw = ip4_addr_get_u32(netif_ip4_gw(netif));
+        Net_Lease_Save(&net_lease);
+    }
+
+    /* 静态表项不会被 ARP 应答刷新，保留一段时间后删除并重新解析，防止对端换卡后一直发错 */
+    if (g_net_ctrl.arp_static && HAL_GetTick() - g_net_ctrl.arp_static_tick > NET_ARP_STATIC_HOLD_MS) {
+        ip4_addr_t arp_ip;
+        ip4_addr_set_u32(&arp_ip, net_lease.arp_ip);
+        LOCK_TCPIP_CORE();
+        etharp_remove_static_entry(&arp_ip);
+        etharp_request(netif, &arp_ip);
+        UNLOCK_TCPIP_CORE();
+        g_net_ctrl.arp_static = 0;
+        g_net_ctrl.dest_mac_saved = 0;
+    }
+
+    /* 订阅包改变了目标：记入缓存并重新学习下一跳 */
+    net_sub_poll(netif);
+    if (!g_net_ctrl.dest_mac_saved && !g_net_ctrl.arp_static && g_net_ctrl.tx_frame_count > 0) {
+        net_learn_next_hop(netif);
+    }
+}
+
+/**
+ * @brief  Net 任务周期调用：同步链路状态，并在实时流量之后按节拍补发缓存
+ * @note   每次最多补发一条，两条之间至少间隔 NET_SF_DRAIN_INTERVAL_MS
+ */
+void Net_Client_Poll(void) {
+    NetRecord_t rec;
+    uint32_t sent = 0;
+    uint8_t subscribed;
+
+    if (g_net_ctrl.state == NET_ERROR || g_net_ctrl.state == NET_IDLE) return;
+
+    net_addr_poll();
+    Policy_Poll();
+    /* 没有订阅者时只存不发：记录留在断网缓存/证据日志，订阅后按恢复流程补发 */
+    subscribed = !ip_addr_isany(&g_net_ctrl.dest_addr);
+    Policy_SetOnline(g_net_ctrl.link_up && g_net_ctrl.addr_src != NET_ADDR_NONE && subscribed);
+    if (!g_net_ctrl.link_up || g_net_ctrl.addr_src == NET_ADDR_NONE || !subscribed) {
+        g_net_ctrl.state = NET_WAIT_LINK;
+        return;
+    }
+    if (g_net_ctrl.state == NET_WAIT_LINK) {
+        g_net_ctrl.state = NET_READY;
+        if (Net_Store_Count() > 0) {
+            LOG_I("[NET] Link restored, draining %ld stored records\r\n", Net_Store_Count());
+            Net_Store_MarkDrainStart();
+        }
+    }
+    if (g_net_ctrl.state != NET_READY) return;
+    if (HAL_GetTick() - g_net_ctrl.last_drain_tick < NET_SF_DRAIN_INTERVAL_MS) return;
+
+    if (Net_Store_Peek(&rec) == 0) {
+        g_net_ctrl.last_drain_tick = HAL_GetTick();
+        g_net_ctrl.state = NET_SENDING;
+        int8_t ret = net_send_chunks(rec.pData, rec.len,
+                                     (rec.type == NET_REC_JPEG) ? UDP_REMOTE_PORT : UDP_RESULT_PORT,
+                                     rec.frame_id, &sent);
+        g_net_ctrl.state = NET_READY;
+        if (ret != 0) {
+            Net_Store_Advance(sent); /* 保留在队首，下个节拍从断点续发 */
+            return;
+        }
+
+        if (rec.type == NET_REC_JPEG) g_net_ctrl.tx_frame_count++;
+        Net_Store_Pop();
+        if (Net_Store_Count() == 0) {
+            Net_Store_MarkDrainDone();
+            NetStoreStats_t st;
+            Net_Store_GetStats(&st);
+            LOG_I("[NET] Store drained in %ld ms\r\n", st.drain_ms_last);
+        }
+        return;
+    }
+
+    /* RAM 缓存已清空，再上传 Flash 证据日志中的积压 (负载直接引用 Flash 映射地址) */
+    EvidRecord_t ev;
+    if (Evidence_Log_PeekUnsent(&ev) != 0) return;
+
+    if (ev.seq != ev_resume_seq || ev_resume_off >= ev.len) {
+        ev_resume_seq = ev.seq;
+        ev_resume_off = 0;
+    }
+    g_net_ctrl.last_drain_tick = HAL_GetTick();
+    g_net_ctrl.state = NET_SENDING;
+    int8_t ret = net_send_chunks(ev.pData + ev_resume_off, ev.len - ev_resume_off,
+                                 (ev.type == EVID_REC_JPEG) ? UDP_REMOTE_PORT : UDP_RESULT_PORT,
+                                 ev.frame_id, &sent);
     g_net_ctrl.state = NET_READY;
+    if (ret == 0) {
+        Evidence_Log_MarkSent(ev.seq);
+        ev_resume_off = 0;
+    } else {
+        ev_resume_off += sent; /* 断点只记在内存，复位后整条重发 */
+    }
+}
+
+/**
+ * @brief  记录一帧 JPEG 的交接延迟 (Net 任务在开始发送前调用)，每 NET_REPORT_INTERVAL_MS 打印一次
+ * @param  stamp: 完成中断中记录的 DWT->CYCCNT
+ */
+void Net_Client_NoteHandoff(uint32_t stamp) {
+    uint32_t us = (DWT->CYCCNT - stamp) / (SystemCoreClock / 1000000U);
+
+    if (handoff.frames == 0 || us < handoff.min_us) handoff.min_us = us;
+    if (us > handoff.max_us) handoff.max_us = us;
+    handoff.sum_us += us;
+    handoff.frames++;
+
+    if (HAL_GetTick() - handoff_tick >= NET_REPORT_INTERVAL_MS) {
+        LOG_I("[NET] JPEG handoff" NET_HANDOFF_TAG ": %ld frames, min %ld / avg %ld / max %ld us, evt dropped %ld\r\n",
+              handoff.frames, handoff.min_us, (uint32_t)(handoff.sum_us / handoff.frames), handoff.max_us, evt_dropped);
+        memset(&handoff, 0, sizeof(handoff));
+        handoff_tick = HAL_GetTick();
+    }
+}
+
+/**
+ * @brief  事件投递失败计数 (JPEG 完成中断/AI 任务调用)
+ */
+void Net_Client_NoteEvtDrop(void) {
+    __atomic_fetch_add(&evt_dropped, 1U, __ATOMIC_RELAXED);
 }
@@ -0,0 +1,51 @@
+#include "Net_Lease.h"
+#include "Hw_Crc.h"
+#include "app_config.h"
+#include <string.h>
+
+#define LEASE_MAGIC      0x4C454153UL  /* "LEAS" */
+#define LEASE_CRC_LEN    (sizeof(NetLease_t) - sizeof(uint32_t))
+
+/* 备份 SRAM 起始处存放租约；该区域默认可缓存，写后必须 Clean 才能跨复位保留 */
+static NetLease_t * const bkp_lease = (NetLease_t *)D3_BKPSRAM_BASE;
+
+/**
+ * @brief  打开备份 SRAM 时钟与写访问
+ */
+void Net_Lease_Init(void) {
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+}
+
+/**
+ * @brief  读取缓存的租约
+ * @retval 0: 有效; -1: 无缓存或校验失败 (冷启动/掉电)
+ */
+int8_t Net_Lease_Load(NetLease_t *lease) {
+    if (lease == NULL) return -1;
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *)bkp_lease, sizeof(NetLease_t));
+    memcpy(lease, bkp_lease, sizeof(NetLease_t));
+    if (lease->magic != LEASE_MAGIC ||
+        lease->crc != Hw_Crc_Calc(lease, LEASE_CRC_LEN)) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  写入租约 (补全 magic 与 CRC)
+ */
+void Net_Lease_Save(NetLease_t *lease) {
+    if (lease == NULL) return;
+
+    lease->magic = LEASE_MAGIC;
+    lease->crc = Hw_Crc_Calc(lease, LEASE_CRC_LEN);
+    memcpy(bkp_lease, lease, sizeof(NetLease_t));
+    SCB_CleanDCache_by_Addr((uint32_t *)bkp_lease, sizeof(NetLease_t));
+}
+
+void Net_Lease_Clear(void) {
+    bkp_lease->magic = 0;
+    SCB_CleanDCache_by_Addr((uint32_t *)bkp_lease, sizeof(NetLease_t));
+}
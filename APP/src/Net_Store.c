@@ -0,0 +1,212 @@
+#include "Net_Store.h"
+#include "app_config.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. 缓存池布局                               */
+/* ========================================== */
+/*
+ * 单生产者/单消费者字节环：所有接口只在 Net 任务上下文调用，无需加锁。
+ * 每条记录 = 32 字节记录头 + 负载 (按 32 字节补齐)，负载起始地址与
+ * Cache 行对齐，补发时可直接 SCB_CleanDCache 后交给 ETH DMA 零拷贝发送。
+ * 记录不跨越池尾：尾部剩余空间不足时整体回绕到 0，wrap_at 记录回绕点。
+ * 补发中途失败时只推进队首记录的 sent，下次从断点续发，接收端不会收到重复分片。
+ */
+#define REC_HDR_SIZE    32U
+#define REC_ALIGN(x)    (((x) + 31U) & ~31U)
+#define NO_WRAP         0xFFFFFFFFU
+
+typedef struct {
+    uint16_t type;
+    uint16_t reserved;
+    uint32_t len;       /* 缓存的负载长度 */
+    uint32_t frame_id;
+    uint32_t tick;
+    uint32_t offset;    /* 负载首字节在原记录中的偏移 */
+    uint32_t sent;      /* 负载中已补发的字节数 */
+} RecHdr_t;
+
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t sf_pool[NET_SF_POOL_SIZE];
+
+static uint32_t rd_off = 0;      // 最旧记录偏移
+static uint32_t wr_off = 0;      // 下一条写入偏移
+static uint32_t wrap_at = NO_WRAP; // 写指针回绕前的有效数据末端
+static uint32_t drain_start_tick = 0;
+static NetStoreStats_t stats = {0};
+static NetStoreEvictHook_t evict_hook = NULL;
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static inline RecHdr_t *hdr_at(uint32_t off) {
+    return (RecHdr_t *)&sf_pool[off];
+}
+
+/**
+ * @brief  丢弃队首记录 (读指针前移，必要时跟随回绕)
+ */
+static void drop_head(void) {
+    RecHdr_t *h = hdr_at(rd_off);
+    uint32_t rec_size = REC_HDR_SIZE + REC_ALIGN(h->len);
+
+    rd_off += rec_size;
+    stats.used_bytes -= rec_size;
+    stats.records--;
+
+    if (rd_off == wrap_at) {
+        stats.used_bytes -= NET_SF_POOL_SIZE - wrap_at;
+        rd_off = 0;
+        wrap_at = NO_WRAP;
+    }
+    if (stats.records == 0) {
+        rd_off = wr_off = 0;
+        wrap_at = NO_WRAP;
+        stats.used_bytes = 0;
+    }
+}
+
+/**
+ * @brief  为 need 字节寻找一段连续空间
+ * @retval 写入偏移；空间不足返回 NO_WRAP
+ */
+static uint32_t reserve(uint32_t need) {
+    if (stats.records == 0) {
+        return 0;
+    }
+    if (wr_off > rd_off) {
+        if (NET_SF_POOL_SIZE - wr_off >= need) {
+            return wr_off;
+        }
+        if (rd_off >= need) {
+            /* 尾部放不下，回绕到池首 */
+            wrap_at = wr_off;
+            stats.used_bytes += NET_SF_POOL_SIZE - wr_off;
+            wr_off = 0;
+            return 0;
+        }
+        return NO_WRAP;
+    }
+    /* 写指针已回绕 (wr_off <= rd_off)，可用区间为 [wr_off, rd_off) */
+    if (rd_off - wr_off >= need) {
+        return wr_off;
+    }
+    return NO_WRAP;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+void Net_Store_Init(void) {
+    rd_off = wr_off = 0;
+    wrap_at = NO_WRAP;
+    memset(&stats, 0, sizeof(stats));
+    stats.capacity = NET_SF_POOL_SIZE;
+}
+
+/**
+ * @brief  拷贝一条记录入缓存；池满时挤出最旧记录 (drop-oldest)，挤出前先交给 evict_hook
+ * @param  offset: pData 在原记录中的偏移，非 0 表示前面部分已实时发出
+ * @retval 0: 成功; -1: 参数无效或单条超过池容量
+ */
+int8_t Net_Store_Push(NetRecType_t type, const uint8_t *pData, uint32_t len, uint32_t offset, uint32_t frame_id) {
+    uint32_t need = REC_HDR_SIZE + REC_ALIGN(len);
+    uint32_t off;
+
+    if (pData == NULL || len == 0) return -1;
+    if (need > NET_SF_POOL_SIZE) {
+        stats.rejected++;
+        return -1;
+    }
+
+    while ((off = reserve(need)) == NO_WRAP) {
+        if (evict_hook != NULL) {
+            NetRecord_t victim;
+            Net_Store_Peek(&victim);
+            evict_hook(&victim);
+        }
+        drop_head();
+        stats.dropped_oldest++;
+    }
+
+    RecHdr_t *h = hdr_at(off);
+    h->type = (uint16_t)type;
+    h->reserved = 0;
+    h->len = len;
+    h->frame_id = frame_id;
+    h->tick = HAL_GetTick();
+    h->offset = offset;
+    h->sent = 0;
+    memcpy(&sf_pool[off + REC_HDR_SIZE], pData, len);
+
+    wr_off = off + need;
+    stats.used_bytes += need;
+    stats.records++;
+    stats.pushed++;
+    if (offset > 0) {
+        stats.partial++;
+    }
+    if (stats.used_bytes > stats.high_water) {
+        stats.high_water = stats.used_bytes;
+    }
+    return 0;
+}
+
+/**
+ * @brief  查看最旧记录 (不出队)，负载指针在 Pop 之前一直有效
+ * @retval 0: 有记录; -1: 缓存为空
+ */
+int8_t Net_Store_Peek(NetRecord_t *rec) {
+    if (stats.records == 0 || rec == NULL) return -1;
+
+    RecHdr_t *h = hdr_at(rd_off);
+    rec->type = (NetRecType_t)h->type;
+    rec->frame_id = h->frame_id;
+    rec->tick = h->tick;
+    rec->offset = h->offset + h->sent;
+    rec->len = h->len - h->sent;
+    rec->pData = &sf_pool[rd_off + REC_HDR_SIZE + h->sent];
+    return 0;
+}
+
+/**
+ * @brief  最旧记录补发了前 n 字节后中断，记下断点 (仍留在队首)
+ */
+void Net_Store_Advance(uint32_t n) {
+    if (stats.records == 0) return;
+
+    RecHdr_t *h = hdr_at(rd_off);
+    h->sent = (n < h->len - h->sent) ? h->sent + n : h->len;
+}
+
+/**
+ * @brief  最旧记录已补发成功，出队
+ */
+void Net_Store_Pop(void) {
+    if (stats.records == 0) return;
+    drop_head();
+    stats.drained++;
+}
+
+uint32_t Net_Store_Count(void) {
+    return stats.records;
+}
+
+void Net_Store_MarkDrainStart(void) {
+    drain_start_tick = HAL_GetTick();
+}
+
+void Net_Store_MarkDrainDone(void) {
+    stats.drain_ms_last = HAL_GetTick() - drain_start_tick;
+}
+
+void Net_Store_GetStats(NetStoreStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
+
+void Net_Store_SetEvictHook(NetStoreEvictHook_t hook) {
+    evict_hook = hook;
+}
@@ -0,0 +1,226 @@
+#include "Policy_Engine.h"
+#include "Net_Lease.h"
+#include "Net_Auth.h"
+#include "app_config.h"
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 默认规则表与存储                          */
+/* ========================================== */
+/*
+ * 类别顺序须与模型训练时的标签顺序一致；换模型后用 Tools/policy_push.py 下发新表即可，
+ * 无需重新烧录 (报文带 HMAC 标签，版本号须递增)。默认值即 PRD 第 4 节的默认策略：摩托车拦截、皮卡按货车、阈值 0.85、断网降级通行。
+ */
+static const PolicyTable_t policy_default = {
+    POLICY_MAGIC, 0, AI_NUM_CLASSES, 0, 85,
+    8,      /* 摩托车 */
+    3,      /* 皮卡 */
+    0x11,   /* 皮卡按客车时计为 客1 */
+    {
+        { POLICY_ACT_PASS,  0x11, POLICY_ALARM_NONE,     0 },  /*  0 小客车     客1 */
+        { POLICY_ACT_PASS,  0x11, POLICY_ALARM_NONE,     0 },  /*  1 面包车     客1 */
+        { POLICY_ACT_PASS,  0x13, POLICY_ALARM_NONE,     0 },  /*  2 大客车     客3 */
+        { POLICY_ACT_PASS,  0x21, POLICY_ALARM_NONE,     0 },  /*  3 皮卡       货1 */
+        { POLICY_ACT_PASS,  0x22, POLICY_ALARM_NONE,     0 },  /*  4 厢式货车   货2 */
+        { POLICY_ACT_PASS,  0x21, POLICY_ALARM_NONE,     0 },  /*  5 轻型货车   货1 */
+        { POLICY_ACT_PASS,  0x24, POLICY_ALARM_NONE,     0 },  /*  6 重型货车   货4 */
+        { POLICY_ACT_PASS,  0x26, POLICY_ALARM_NONE,     0 },  /*  7 半挂列车   货6 */
+        { POLICY_ACT_BLOCK, 0,    POLICY_ALARM_MOTORCYCLE, 0 }, /* 8 摩托车 */
+        { POLICY_ACT_BLOCK, 0,    POLICY_ALARM_NONMOTOR, 0 },  /*  9 自行车 */
+        { POLICY_ACT_BLOCK, 0,    POLICY_ALARM_NONMOTOR, 0 },  /* 10 电动车 */
+        { POLICY_ACT_BLOCK, 0,    POLICY_ALARM_AGRI,     0 },  /* 11 农用三轮车 */
+        { POLICY_ACT_BLOCK, 0,    POLICY_ALARM_AGRI,     0 },  /* 12 拖拉机 */
+        { POLICY_ACT_BLOCK, 0,    POLICY_ALARM_PERSON,   0 },  /* 13 行人 */
+        { POLICY_ACT_NONE,  0,    POLICY_ALARM_NONE,     0 },  /* 14 背景 (无目标) */
+    },
+    0
+};
+
+/* 热加载双缓冲：新表写入非活动的一份后切换指针，判定中途不会读到半张表 */
+static PolicyTable_t tables[2];
+static uint8_t next_table = 0;
+static const PolicyTable_t *volatile active = &policy_default;
+
+/* tcpip 线程收到的待加载表，由 Net 任务校验并生效 (与订阅包的处理方式相同) */
+static uint8_t pending_buf[POLICY_MSG_LEN];
+_Static_assert(POLICY_MSG_LEN == sizeof(PolicyTable_t) + NET_AUTH_TAG_LEN, "policy tag length mismatch");
+static volatile uint8_t pending = 0;
+
+static volatile uint8_t online = 0;
+static PolicyStats_t stats = {0};
+
+/* 备份 SRAM：租约之后存放当前规则表，软复位/看门狗复位后沿用热加载的表 */
+#define POLICY_BKP_OFFSET   0x100U
+_Static_assert(sizeof(NetLease_t) <= POLICY_BKP_OFFSET, "policy table overlaps the lease in backup SRAM");
+#define POLICY_BKP_ADDR     (D3_BKPSRAM_BASE + POLICY_BKP_OFFSET)
+static PolicyTable_t * const bkp_policy = (PolicyTable_t *)POLICY_BKP_ADDR;
+
+/* ========================================== */
+/* 2. 校验                                     */
+/* ========================================== */
+
+/* CRC-32 (IEEE 802.3，与 Python zlib.crc32 相同)；表很小，逐位计算即可，不占用硬件 CRC */
+static uint32_t policy_crc32(const uint8_t *p, uint32_t len) {
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    while (len--) {
+        crc ^= *p++;
+        for (uint8_t k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+
+static int8_t policy_validate(const PolicyTable_t *t) {
+    if (t->magic != POLICY_MAGIC || t->n_classes != AI_NUM_CLASSES) return -1;
+    if (t->conf_pct < 50 || t->conf_pct > 99) return -1;
+    if (t->moto_class >= AI_NUM_CLASSES || t->pickup_class >= AI_NUM_CLASSES) return -1;
+    for (uint8_t i = 0; i < AI_NUM_CLASSES; i++) {
+        if (t->rules[i].action > POLICY_ACT_BLOCK) return -1;
+    }
+    if (t->crc != policy_crc32((const uint8_t *)t, offsetof(PolicyTable_t, crc))) return -1;
+    return 0;
+}
+
+/* 新表生效：写入非活动缓冲后切换 (Net 任务/初始化时调用) */
+static void policy_apply(const PolicyTable_t *t) {
+    PolicyTable_t *dst = &tables[next_table];
+
+    memcpy(dst, t, sizeof(PolicyTable_t));
+    active = dst;
+    next_table ^= 1;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  从备份 SRAM 恢复上次热加载的规则表，没有则使用默认表
+ */
+void Policy_Init(void) {
+    PolicyTable_t t;
+
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+    SCB_InvalidateDCache_by_Addr((uint32_t *)POLICY_BKP_ADDR, sizeof(PolicyTable_t));
+    memcpy(&t, bkp_policy, sizeof(t));
+    if (policy_validate(&t) == 0) {
+        policy_apply(&t);
+        printf("[POLICY] Restored rule table v%d from backup SRAM\r\n", t.version);
+    } else {
+        printf("[POLICY] Using default rule table\r\n");
+    }
+}
+
+/**
+ * @brief  对一个 (融合后的) 识别结果做本地判定
+ * @param  conf: 该类别的置信度 (0~1)
+ * @note   只读当前表，无锁，几十个周期内完成；AI 任务每条结果调用
+ */
+void Policy_Decide(uint8_t class_id, float conf, PolicyDecision_t *out) {
+    const PolicyTable_t *t = active;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles;
+    PolicyRule_t r;
+
+    if (class_id >= AI_NUM_CLASSES) class_id = AI_NUM_CLASSES - 1;
+    r = t->rules[class_id];
+    if (class_id == t->moto_class) {
+        r.action = (t->flags & POLICY_F_MOTO_ALLOW) ? POLICY_ACT_PASS : POLICY_ACT_BLOCK;
+        r.alarm = (r.action == POLICY_ACT_BLOCK) ? POLICY_ALARM_MOTORCYCLE : POLICY_ALARM_NONE;
+    }
+    if (class_id == t->pickup_class && (t->flags & POLICY_F_PICKUP_CAR)) {
+        r.bill = t->pickup_car_bill;
+    }
+
+    out->version = t->version;
+    out->bill = r.bill;
+    if (conf * 100.0f >= (float)t->conf_pct) {
+        out->action = r.action;
+        out->alarm = r.alarm;
+        out->why = POLICY_WHY_RULE;
+        stats.local++;
+    } else if (online) {
+        out->action = POLICY_ACT_ESCALATE;   /* 存疑：不在本地拦截，防止误拦 */
+        out->alarm = POLICY_ALARM_NONE;
+        out->why = POLICY_WHY_LOW_CONF;
+        stats.escalated++;
+    } else {
+        out->action = (t->flags & POLICY_F_OFFLINE_LOCK) ? POLICY_ACT_BLOCK : POLICY_ACT_PASS;
+        out->alarm = POLICY_ALARM_NONE;
+        out->why = POLICY_WHY_OFFLINE;
+        stats.offline++;
+    }
+
+    cycles = DWT->CYCCNT - start;
+    if (cycles > stats.max_cycles) stats.max_cycles = cycles;
+}
+
+/**
+ * @brief  云端是否可达 (Net 任务按链路/地址状态更新)
+ */
+void Policy_SetOnline(uint8_t up) {
+    online = up;
+}
+
+/**
+ * @brief  提交一张待加载的规则表 (tcpip 线程收到 "POL1" 包时调用)
+ * @param  data: 规则表 + HMAC 标签，共 POLICY_MSG_LEN 字节
+ * @retval 0: 已接收，由 Policy_Poll 认证、校验后生效; -1: 长度不符或上一张尚未处理
+ */
+int8_t Policy_Submit(const uint8_t *data, uint32_t len) {
+    if (len != POLICY_MSG_LEN || pending) return -1;
+    memcpy(pending_buf, data, len);
+    pending = 1;
+    return 0;
+}
+
+/**
+ * @brief  校验并应用待加载的规则表，成功后写入备份 SRAM (Net 任务周期调用)
+ */
+void Policy_Poll(void) {
+    PolicyTable_t t;
+
+    if (!pending) return;
+    if (Net_Auth_Verify(pending_buf, sizeof(t), pending_buf + sizeof(t)) != 0) {
+        pending = 0;
+        stats.rejected++;
+        printf("[POLICY] Rule table rejected (bad HMAC tag)\r\n");
+        return;
+    }
+    memcpy(&t, pending_buf, sizeof(t));
+    pending = 0;
+
+    /* 签名的旧表可被抓包重放：只接受版本更高的表 */
+    if (t.version <= active->version) {
+        stats.rejected++;
+        printf("[POLICY] Rule table v%d rejected (active is v%d)\r\n", t.version, active->version);
+        return;
+    }
+    if (policy_validate(&t) != 0) {
+        stats.rejected++;
+        printf("[POLICY] Rule table rejected (bad magic/range/CRC)\r\n");
+        return;
+    }
+    policy_apply(&t);
+    memcpy(bkp_policy, &t, sizeof(t));
+    SCB_CleanDCache_by_Addr((uint32_t *)POLICY_BKP_ADDR, sizeof(PolicyTable_t));
+    stats.reloads++;
+    printf("[POLICY] Rule table v%d loaded: conf %d%%, moto %s, pickup %s, offline %s\r\n",
+           t.version, t.conf_pct, (t.flags & POLICY_F_MOTO_ALLOW) ? "allow" : "block",
+           (t.flags & POLICY_F_PICKUP_CAR) ? "car" : "truck", (t.flags & POLICY_F_OFFLINE_LOCK) ? "lock" : "degrade");
+}
+
+const PolicyTable_t *Policy_Active(void) {
+    return active;
+}
+
+void Policy_GetStats(PolicyStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
@@ -0,0 +1,267 @@
+#include "Rtp_Jpeg.h"
+#include "Net_Client.h"
+#include "app_config.h"
+#include "cmsis_os.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "lwip/tcpip.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 协议常量                                 */
+/* ========================================== */
+/*
+ * RFC 2435 负载：[RTP 头 12B][JPEG 头 8B][量化表头 4B + 表 (仅首包)][扫描数据]
+ * - 硬件编码器使用 JPEG 标准 Huffman 表，接收端可按 RFC 重建完整文件头，
+ *   因此只需传输扫描数据；Q=255 表示量化表随首包带内发送。
+ * - 每个 RTP 包是两段 pbuf 链：PBUF_RAM 头 + PBUF_REF 直接引用编码输出缓冲区，
+ *   扫描数据零拷贝 (ETH 发送为同步完成，udp_sendto 返回后即可释放)。
+ */
+#define RTP_HDR_SIZE        12U
+#define RTP_JPEG_HDR_SIZE   8U
+#define RTP_QT_HDR_SIZE     4U
+#define RTP_QT_SIZE         64U
+#define RTP_PT_JPEG         26U
+#define RTP_JPEG_Q_DYNAMIC  255U
+#define RTP_CLOCK_KHZ       90U    /* 视频 RTP 时钟 90 kHz */
+#define RTP_YIELD_EVERY     10U    /* 与 net_send_chunks 相同的让出节拍 */
+
+static struct udp_pcb *rtp_pcb = NULL;
+static uint16_t rtp_seq = 0;
+static uint32_t last_sr_tick = 0;
+static RtpJpegStats_t stats = {0};
+
+/* ========================================== */
+/* 2. 内部工具                                 */
+/* ========================================== */
+
+static inline void put_be16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static inline void put_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint16_t get_be16(const uint8_t *p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static err_t rtp_sendto(struct pbuf *p, uint16_t port) {
+    err_t err;
+
+    LOCK_TCPIP_CORE();
+    err = udp_sendto(rtp_pcb, p, &g_net_ctrl.dest_addr, port);
+    UNLOCK_TCPIP_CORE();
+    return err;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+int8_t Rtp_Jpeg_Init(void) {
+    rtp_pcb = udp_new();
+    if (rtp_pcb == NULL) return -1;
+    udp_bind(rtp_pcb, IP_ADDR_ANY, RTP_PORT);
+    rtp_seq = (uint16_t)HAL_GetTick();
+    memset(&stats, 0, sizeof(stats));
+    return 0;
+}
+
+/**
+ * @brief  解析硬件编码器输出的 JFIF，提取 RFC 2435 所需字段
+ * @retval 0: 成功; -1: 格式不受支持 (非 8bit 基线/存在 DRI/尺寸超出 2040)
+ */
+int8_t Rtp_Jpeg_Parse(const uint8_t *jpg, uint32_t len, RtpJpegInfo_t *info) {
+    uint32_t pos = 2;
+
+    if (jpg == NULL || info == NULL || len < 4 || jpg[0] != 0xFF || jpg[1] != 0xD8) return -1;
+    memset(info, 0, sizeof(*info));
+
+    while (pos + 4 <= len) {
+        if (jpg[pos] != 0xFF) return -1;
+        uint8_t marker = jpg[pos + 1];
+        if (marker == 0xFF) { pos++; continue; }  /* 填充字节 */
+
+        uint32_t seg_len = get_be16(&jpg[pos + 2]);
+        const uint8_t *seg = &jpg[pos + 4];
+        if (seg_len < 2 || pos + 2 + seg_len > len) return -1;
+        uint32_t body = seg_len - 2;
+
+        switch (marker) {
+        case 0xDB:  /* DQT：一个段内可能含多张表 */
+            for (uint32_t i = 0; i + 1 + RTP_QT_SIZE <= body; i += 1 + RTP_QT_SIZE) {
+                uint8_t id = seg[i] & 0x0F;
+                if ((seg[i] >> 4) != 0 || id > 1) return -1;  /* 只支持 8bit 表 0/1 */
+                info->qt[id] = &seg[i + 1];
+                if (id + 1 > info->qt_count) info->qt_count = id + 1;
+            }
+            break;
+        case 0xC0: { /* SOF0 基线 */
+            if (body < 15 || seg[0] != 8 || seg[5] != 3) return -1;
+            uint16_t h = get_be16(&seg[1]);
+            uint16_t w = get_be16(&seg[3]);
+            if (w == 0 || h == 0 || w > 2040 || h > 2040) return -1;
+            if (seg[10] != 0x11 || seg[13] != 0x11) return -1;  /* 色度分量不做二次采样 */
+            if (seg[7] == 0x21) info->type = 0;
+            else if (seg[7] == 0x22) info->type = 1;
+            else return -1;
+            info->width8 = (uint8_t)((w + 7) / 8);
+            info->height8 = (uint8_t)((h + 7) / 8);
+            break;
+        }
+        case 0xDD:  /* DRI 需要 type 64+ 的重启标记头，本编码器不会产生 */
+            return -1;
+        case 0xDA:  /* SOS：其后即为熵编码数据 */
+            info->scan = &jpg[pos + 2 + seg_len];
+            info->scan_len = len - (pos + 2 + seg_len);
+            if (info->scan_len >= 2 && info->scan[info->scan_len - 2] == 0xFF &&
+                info->scan[info->scan_len - 1] == 0xD9) {
+                info->scan_len -= 2;
+            }
+            return (info->width8 != 0 && info->qt[0] != NULL && info->scan_len > 0) ? 0 : -1;
+        default:
+            break;
+        }
+        pos += 2 + seg_len;
+    }
+    return -1;
+}
+
+/**
+ * @brief  按 RFC 2435 分包发送一帧 (Net 任务上下文)
+ * @param  capture_tick: 采集时刻 (HAL_GetTick)，换算为 90 kHz RTP 时间戳
+ * @retval 0: 整帧发出; -1: 网络未就绪/解析失败/发送失败 (接收端会丢弃残帧)
+ */
+int8_t Rtp_Jpeg_SendFrame(const uint8_t *jpg, uint32_t len, uint32_t capture_tick) {
+    RtpJpegInfo_t info;
+    uint32_t ts = capture_tick * RTP_CLOCK_KHZ;
+    uint32_t off = 0;
+
+    if (rtp_pcb == NULL || g_net_ctrl.state != NET_READY || !g_net_ctrl.link_up) return -1;
+    if (Rtp_Jpeg_Parse(jpg, len, &info) != 0) {
+        stats.parse_errors++;
+        return -1;
+    }
+
+    while (off < info.scan_len) {
+        uint8_t first = (off == 0);
+        uint32_t qt_bytes = first ? (RTP_QT_HDR_SIZE + 2 * RTP_QT_SIZE) : 0;
+        uint32_t hdr_len = RTP_HDR_SIZE + RTP_JPEG_HDR_SIZE + qt_bytes;
+        uint32_t chunk = info.scan_len - off;
+        if (chunk > RTP_MAX_PAYLOAD - qt_bytes) chunk = RTP_MAX_PAYLOAD - qt_bytes;
+        uint8_t last = (off + chunk == info.scan_len);
+
+        struct pbuf *ph = pbuf_alloc(PBUF_TRANSPORT, (u16_t)hdr_len, PBUF_RAM);
+        struct pbuf *pd = pbuf_alloc(PBUF_RAW, (u16_t)chunk, PBUF_REF);
+        if (ph == NULL || pd == NULL) {
+            if (ph != NULL) pbuf_free(ph);
+            if (pd != NULL) pbuf_free(pd);
+            stats.send_errors++;
+            return -1;
+        }
+        pd->payload = (void *)(info.scan + off);
+
+        uint8_t *b = (uint8_t *)ph->payload;
+        b[0] = 0x80;                                    /* V=2 */
+        b[1] = (uint8_t)((last ? 0x80 : 0x00) | RTP_PT_JPEG); /* 帧末包置 marker */
+        put_be16(&b[2], rtp_seq);
+        put_be32(&b[4], ts);
+        put_be32(&b[8], RTP_SSRC);
+        b[12] = 0;                                      /* type-specific */
+        b[13] = (uint8_t)(off >> 16);                   /* 24bit fragment offset */
+        b[14] = (uint8_t)(off >> 8);
+        b[15] = (uint8_t)off;
+        b[16] = info.type;
+        b[17] = RTP_JPEG_Q_DYNAMIC;
+        b[18] = info.width8;
+        b[19] = info.height8;
+        if (first) {
+            b[20] = 0;                                  /* MBZ */
+            b[21] = 0;                                  /* 8bit 精度 */
+            put_be16(&b[22], 2 * RTP_QT_SIZE);
+            memcpy(&b[24], info.qt[0], RTP_QT_SIZE);
+            /* 只有一张表时亮度/色度共用 */
+            memcpy(&b[24 + RTP_QT_SIZE], (info.qt[1] != NULL) ? info.qt[1] : info.qt[0], RTP_QT_SIZE);
+        }
+        pbuf_cat(ph, pd);
+
+        err_t err = rtp_sendto(ph, RTP_PORT);
+        pbuf_free(ph);
+        if (err != ERR_OK) {
+            stats.send_errors++;
+            g_net_ctrl.last_error_code = (uint32_t)(-err);
+            return -1;
+        }
+
+        rtp_seq++;
+        stats.packets++;
+        stats.octets += hdr_len - RTP_HDR_SIZE + chunk;
+        off += chunk;
+        if (stats.packets % RTP_YIELD_EVERY == 0) {
+            osDelay(1);
+        }
+    }
+
+    stats.frames++;
+    return 0;
+}
+
+/**
+ * @brief  周期发送 RTCP SR + SDES(CNAME)，供接收端做时钟同步与丢包统计
+ * @note   板上无 RTC，NTP 时间戳取上电时长
+ */
+void Rtp_Jpeg_Poll(void) {
+    static const char cname[] = "ivcis-edge";
+    uint8_t pkt[64];
+    uint32_t now = HAL_GetTick();
+    uint32_t sdes_len;
+
+    if (rtp_pcb == NULL || stats.frames == 0 || g_net_ctrl.state != NET_READY) return;
+    if (now - last_sr_tick < RTCP_SR_INTERVAL_MS) return;
+    last_sr_tick = now;
+
+    /* SR：长度 28 字节 = 7 个 32bit 字，length 字段填 6 */
+    pkt[0] = 0x80;
+    pkt[1] = 200;
+    put_be16(&pkt[2], 6);
+    put_be32(&pkt[4], RTP_SSRC);
+    put_be32(&pkt[8], now / 1000U);
+    put_be32(&pkt[12], (uint32_t)(((uint64_t)(now % 1000U) << 32) / 1000U));
+    put_be32(&pkt[16], now * RTP_CLOCK_KHZ);
+    put_be32(&pkt[20], stats.packets);
+    put_be32(&pkt[24], stats.octets);
+
+    /* SDES：SSRC + CNAME 项 + END，补齐到 4 字节 */
+    sdes_len = 4 + 2 + (sizeof(cname) - 1) + 1;
+    sdes_len = (sdes_len + 3U) & ~3U;
+    memset(&pkt[28], 0, 4 + sdes_len);
+    pkt[28] = 0x81;
+    pkt[29] = 202;
+    put_be16(&pkt[30], (uint16_t)(sdes_len / 4));
+    put_be32(&pkt[32], RTP_SSRC);
+    pkt[36] = 1;                                        /* CNAME */
+    pkt[37] = (uint8_t)(sizeof(cname) - 1);
+    memcpy(&pkt[38], cname, sizeof(cname) - 1);
+
+    uint32_t total = 28 + 4 + sdes_len;
+    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)total, PBUF_RAM);
+    if (p == NULL) return;
+    memcpy(p->payload, pkt, total);
+    if (rtp_sendto(p, RTP_PORT + 1) == ERR_OK) {
+        stats.sr_sent++;
+    }
+    pbuf_free(p);
+}
+
+void Rtp_Jpeg_GetStats(RtpJpegStats_t *out) {
+    if (out != NULL) {
+        *out = stats;
+    }
+}
@@ -0,0 +1,126 @@
+#include "Sys_Stats.h"
+#include "Net_Client.h"
+#include "app_config.h"
+#include "main.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/* 480 MHz 下 CYCCNT 约 8.9 s 回绕，留出 Net 任务被推迟的余量 */
+_Static_assert(SYS_STATS_INTERVAL_MS <= 5000, "run-time stats window must stay below the CYCCNT wrap");
+
+#define STATS_IDLE_NAME  "IDLE"   /* tasks.c 中 configIDLE_TASK_NAME 的默认值 */
+
+static TaskStatus_t task_status[TELEM_MAX_TASKS];
+static UBaseType_t prev_num[TELEM_MAX_TASKS];   // 上次快照各任务的 xTaskNumber
+static uint32_t prev_rt[TELEM_MAX_TASKS];       // 上次快照各任务的累计运行周期
+static uint32_t prev_n = 0;
+static uint32_t prev_total = 0;
+static uint32_t last_tick = 0;
+static uint8_t  overflow_warned = 0;
+IVCIS_ALIGN_32 static TelemRecord_t telem = {0};   // PBUF_ROM 直接引用，发送前清 D-Cache
+
+/* ========================================== */
+/* 2. 快照                                     */
+/* ========================================== */
+
+/* 上次快照中该任务的累计运行周期；本窗口内新建的任务从 0 开始累计 */
+static uint32_t stats_prev_runtime(UBaseType_t num) {
+    for (uint32_t i = 0; i < prev_n; i++) {
+        if (prev_num[i] == num) return prev_rt[i];
+    }
+    return 0;
+}
+
+/**
+ * @brief  取一次任务快照，与上次求差填入 telem
+ * @retval 0: 成功; -1: 任务数超过 TELEM_MAX_TASKS
+ */
+static int8_t stats_sample(void) {
+    uint32_t total;
+    uint32_t window;
+    UBaseType_t n = uxTaskGetSystemState(task_status, TELEM_MAX_TASKS, &total);
+
+    if (n == 0) {
+        if (!overflow_warned) {
+            printf("[STATS] more than %d tasks, raise TELEM_MAX_TASKS\r\n", TELEM_MAX_TASKS);
+            overflow_warned = 1;
+        }
+        return -1;
+    }
+
+    window = total - prev_total;
+    telem.magic = TELEM_MAGIC;
+    telem.seq++;
+    telem.tick = HAL_GetTick();
+    telem.window_us = window / (SystemCoreClock / 1000000U);
+    telem.cpu_busy_permille = 1000;
+    telem.n_tasks = (uint8_t)n;
+    telem.heap_free = (uint32_t)xPortGetFreeHeapSize();
+    telem.heap_min_free = (uint32_t)xPortGetMinimumEverFreeHeapSize();
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t *ts = &task_status[i];
+        TelemTask_t *t = &telem.tasks[i];
+        uint32_t dt = ts->ulRunTimeCounter - stats_prev_runtime(ts->xTaskNumber);
+        uint32_t permille = (window > 0) ? (uint32_t)((uint64_t)dt * 1000U / window) : 0;
+
+        if (permille > 1000U) permille = 1000U;
+        strncpy(t->name, ts->pcTaskName, TELEM_NAME_LEN);
+        t->cpu_permille = (uint16_t)permille;
+        t->stack_free = ts->usStackHighWaterMark;
+        t->priority = (uint8_t)ts->uxCurrentPriority;
+        t->state = (uint8_t)ts->eCurrentState;
+        if (strcmp(ts->pcTaskName, STATS_IDLE_NAME) == 0) {
+            telem.cpu_busy_permille = (uint16_t)(1000U - permille);
+        }
+    }
+    /* 求完所有差之后再覆盖基准 */
+    for (UBaseType_t i = 0; i < n; i++) {
+        prev_num[i] = task_status[i].xTaskNumber;
+        prev_rt[i] = task_status[i].ulRunTimeCounter;
+    }
+    prev_n = n;
+    prev_total = total;
+    return 0;
+}
+
+/* ========================================== */
+/* 3. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  建立第一次快照的基准 (Net 任务启动时调用)
+ */
+void Sys_Stats_Init(void) {
+    (void)stats_sample();
+    telem.seq = 0;
+    last_tick = HAL_GetTick();
+}
+
+/**
+ * @brief  每 SYS_STATS_INTERVAL_MS 生成一条遥测记录并发出 (Net 任务维护节拍中调用)
+ * @note   uxTaskGetSystemState 在挂起调度器期间遍历任务列表并扫描各任务栈水位，
+ *         十来个任务约数十 us，按 2 s 周期可以忽略
+ */
+void Sys_Stats_Poll(void) {
+    uint32_t now = HAL_GetTick();
+
+    if (now - last_tick < SYS_STATS_INTERVAL_MS) return;
+    last_tick = now;
+    if (stats_sample() != 0) return;
+    (void)Net_Client_SendTelemetry((const uint8_t *)&telem,
+                                   offsetof(TelemRecord_t, tasks) + telem.n_tasks * sizeof(TelemTask_t));
+}
+
+/**
+ * @brief  最近一次快照 (仅 Net 任务上下文读取一致)
+ */
+const TelemRecord_t *Sys_Stats_GetLast(void) {
+    return &telem;
+}
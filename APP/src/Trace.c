@@ -0,0 +1,205 @@
+#include "Trace.h"
+#include "Net_Client.h"
+#include "Sys_Stats.h"
+#include "Log.h"
+#include "main.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "lwip/tcpip.h"
+#include <string.h>
+#include <stdio.h>
+
+#if TRACE_ENABLE
+
+/* ========================================== */
+/* 1. 状态                                     */
+/* ========================================== */
+/*
+ * 生产者 (中断、调度器、任务) 在关中断下取号、写入并推进 wr，单核上 wr 之前的事件一定已写完；
+ * Net 任务只读 [rd, wr) 并推进 rd。关中断期间只有一次 DWT 读与 8 字节写入。
+ */
+#define TRACE_MASK        (TRACE_BUF_EVENTS - 1U)
+#define TRACE_PKT_MAX     ((1400U - sizeof(TracePktHdr_t)) / sizeof(TraceEvent_t))
+#define TRACE_MAX_TASKS   16
+#define TRACE_MAX_PKTS    16        /* 每个维护节拍最多发出的包数，积压时分几个节拍追上 */
+
+_Static_assert((TRACE_BUF_EVENTS & TRACE_MASK) == 0, "TRACE_BUF_EVENTS must be a power of 2");
+_Static_assert(sizeof(TraceEvent_t) == 8, "trace event layout is shared with the host tool");
+
+static TraceEvent_t ring[TRACE_BUF_EVENTS];
+static volatile uint32_t wr = 0;
+static volatile uint32_t rd = 0;
+static volatile uint32_t dropped = 0;
+static struct udp_pcb *trace_pcb = NULL;
+static uint32_t pkt_seq = 0;
+static uint32_t flush_tick = 0;
+static uint32_t meta_tick = 0;
+static TaskStatus_t task_status[TRACE_MAX_TASKS];
+static uint32_t send_cyc = 0;       // 本报告窗口内 Trace_Poll 花费的周期
+static uint32_t report_tick = 0;
+static uint32_t report_wr = 0;
+static uint32_t report_dropped = 0;
+
+/* ========================================== */
+/* 2. 记录                                     */
+/* ========================================== */
+
+/**
+ * @brief  记录一条事件 (任意上下文)；缓冲满时丢弃并计数
+ */
+void Trace_Event(uint8_t type, uint8_t id, uint16_t arg) {
+    uint32_t primask = __get_PRIMASK();
+    uint32_t w;
+    TraceEvent_t *e;
+
+    __disable_irq();
+    w = wr;
+    if (w - rd >= TRACE_BUF_EVENTS) {
+        dropped++;
+    } else {
+        e = &ring[w & TRACE_MASK];
+        e->ts = DWT->CYCCNT;
+        e->type = type;
+        e->id = id;
+        e->arg = arg;
+        wr = w + 1U;
+    }
+    __set_PRIMASK(primask);
+}
+
+/* ========================================== */
+/* 3. 发送 (Net 任务)                          */
+/* ========================================== */
+
+static struct pbuf *trace_pkt_alloc(uint16_t kind, uint16_t count, uint32_t body_len) {
+    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)(sizeof(TracePktHdr_t) + body_len), PBUF_RAM);
+    TracePktHdr_t hdr;
+
+    if (p == NULL) return NULL;
+    hdr.magic = TRACE_MAGIC;
+    hdr.seq = pkt_seq++;
+    hdr.cpu_hz = SystemCoreClock;
+    hdr.dropped = dropped;
+    hdr.kind = kind;
+    hdr.count = count;
+    pbuf_take(p, &hdr, sizeof(hdr));
+    return p;
+}
+
+static err_t trace_sendto(struct pbuf *p) {
+    err_t err;
+
+    LOCK_TCPIP_CORE();
+    err = udp_sendto(trace_pcb, p, &g_net_ctrl.dest_addr, TRACE_PORT);
+    UNLOCK_TCPIP_CORE();
+    pbuf_free(p);
+    return err;
+}
+
+/* 任务号 -> 任务名表，上位机据此给各任务轨道命名 */
+static void trace_send_tasks(void) {
+    UBaseType_t n = uxTaskGetSystemState(task_status, TRACE_MAX_TASKS, NULL);
+    TraceTaskName_t t;
+    struct pbuf *p;
+
+    if (n == 0) return;
+    p = trace_pkt_alloc(TRACE_PKT_TASKS, (uint16_t)n, n * sizeof(TraceTaskName_t));
+    if (p == NULL) return;
+    for (UBaseType_t i = 0; i < n; i++) {
+        memset(&t, 0, sizeof(t));
+        t.num = (uint16_t)task_status[i].xTaskNumber;
+        strncpy(t.name, task_status[i].pcTaskName, sizeof(t.name) - 1U);
+        pbuf_take_at(p, &t, sizeof(t), (u16_t)(sizeof(TracePktHdr_t) + i * sizeof(t)));
+    }
+    (void)trace_sendto(p);
+}
+
+/* 发出 [rd, rd + n)，环形缓冲回绕时分两段拷贝 */
+static int8_t trace_send_events(uint32_t n) {
+    uint32_t off = rd & TRACE_MASK;
+    uint32_t first = (off + n > TRACE_BUF_EVENTS) ? TRACE_BUF_EVENTS - off : n;
+    struct pbuf *p = trace_pkt_alloc(TRACE_PKT_EVENTS, (uint16_t)n, n * sizeof(TraceEvent_t));
+
+    if (p == NULL) return -1;
+    pbuf_take_at(p, &ring[off], (u16_t)(first * sizeof(TraceEvent_t)), sizeof(TracePktHdr_t));
+    if (first < n) {
+        pbuf_take_at(p, &ring[0], (u16_t)((n - first) * sizeof(TraceEvent_t)),
+                     (u16_t)(sizeof(TracePktHdr_t) + first * sizeof(TraceEvent_t)));
+    }
+    rd += n;   /* 已拷出，发送失败也不重发 */
+    return (trace_sendto(p) == ERR_OK) ? 0 : -1;
+}
+
+/* ========================================== */
+/* 4. 对外接口                                 */
+/* ========================================== */
+
+int8_t Trace_Init(void) {
+    LOCK_TCPIP_CORE();
+    trace_pcb = udp_new();
+    UNLOCK_TCPIP_CORE();
+    if (trace_pcb == NULL) return -1;
+    flush_tick = meta_tick = report_tick = HAL_GetTick();
+    report_wr = wr;
+    report_dropped = dropped;
+    printf("[TRACE] streaming to subscriber port %d (%d event buffer)\r\n", TRACE_PORT, TRACE_BUF_EVENTS);
+    return 0;
+}
+
+/*
+ * 开销自报：每 NET_REPORT_INTERVAL_MS 打印事件率、发送占用与同期 Sys_Stats 的 CPU 忙碌率。
+ * 记录本身的开销分散在各中断/任务中，无法单独计时；按 TRACE_ENABLE 0/1 各跑一次同一场景，
+ * 比较两次的 busy (运行时统计把中断时间计入当时运行的任务，空闲率之差即为总开销)。
+ */
+static void trace_report(uint32_t now) {
+    uint32_t ms = now - report_tick;
+    uint32_t events = wr - report_wr;
+    uint32_t send_ppm;
+
+    if (ms < NET_REPORT_INTERVAL_MS) return;
+    send_ppm = (uint32_t)((uint64_t)send_cyc * 1000U / ((uint64_t)ms * (SystemCoreClock / 1000000U)));
+    LOG_I("[TRACE] %ld ev/s, dropped %ld, send %ld.%02ld%% CPU, system busy %d.%d%%\r\n",
+          events * 1000U / ms, dropped - report_dropped, send_ppm / 10000U, (send_ppm / 100U) % 100U,
+          Sys_Stats_GetLast()->cpu_busy_permille / 10, Sys_Stats_GetLast()->cpu_busy_permille % 10);
+    report_tick = now;
+    report_wr = wr;
+    report_dropped = dropped;
+    send_cyc = 0;
+}
+
+/**
+ * @brief  把缓冲中的事件成批发出 (Net 任务维护节拍中调用)
+ * @note   凑满一包或滞留超过 TRACE_FLUSH_MS 才发，链路未就绪时事件留在缓冲中，满了再丢
+ */
+static void trace_flush(uint32_t now) {
+    if (trace_pcb == NULL || g_net_ctrl.state != NET_READY || !g_net_ctrl.link_up) return;
+
+    if (now - meta_tick >= TRACE_META_INTERVAL_MS) {
+        meta_tick = now;
+        trace_send_tasks();
+    }
+    for (uint32_t i = 0; i < TRACE_MAX_PKTS; i++) {
+        uint32_t n = wr - rd;
+
+        if (n == 0) {
+            flush_tick = now;   /* 滞留时间从缓冲由空变非空时算起 */
+            break;
+        }
+        if (n < TRACE_PKT_MAX && now - flush_tick < TRACE_FLUSH_MS) break;
+        if (trace_send_events((n > TRACE_PKT_MAX) ? TRACE_PKT_MAX : n) != 0) break;
+        flush_tick = now;
+    }
+}
+
+void Trace_Poll(void) {
+    uint32_t now = HAL_GetTick();
+    uint32_t t0 = DWT->CYCCNT;
+
+    trace_flush(now);
+    send_cyc += DWT->CYCCNT - t0;
+    trace_report(now);
+}
+
+#endif
@@ -1,8 +1,18 @@
 #include "Vision_Pipeline.h"
+#include "Vision_Roi.h"
+#include "Motion_Detect.h"
+#include "Crop_Sched.h"
+#include "Vision_Track.h"
+#include "Wake_Filter.h"
+#include "Mem_Overlay.h"
+#include "Defer_Work.h"
+#include "Log.h"
+#include "Trace.h"
 #include "app_config.h"
 #include "shared_types.h"
 #include "Net_Client.h"
 #include "main.h"
+#include "cmsis_os.h"
 #include "ov5640.h"
 #include "sccb.h"
 #include <string.h>
@@ -18,10 +28,105 @@ uint32_t half_transfer_count = 0;
 uint32_t full_transfer_count = 0;
 
 static uint16_t jpeg_strips_fed = 0;   // 已喂入 JPEG 核心的条带数
+static uint16_t dcmi_strip = 0;        // DMA 刚写完的条带在帧内的序号 (中断维护)
+uint32_t strip_late = 0;               // 延后处理完成前 DMA 已开始覆盖该条带的次数
 static uint32_t jpeg_total_out_size = 0; // 当前帧压缩后的总大小
 
 D2_SRAM_SECTION IVCIS_ALIGN_32 uint8_t DCMI_Strip_Buf[2][STRIP_BUFFER_SIZE];
-D2_SRAM_SECTION IVCIS_ALIGN_32 uint8_t JPEG_Out_Buf[JPEG_OUT_BUFFER_SIZE]; // 改为 D2 以便 ETH DMA 访问
+D2_SRAM_SECTION IVCIS_ALIGN_32 uint8_t JPEG_Out_Buf[JPEG_OUT_SLOTS][JPEG_OUT_BUFFER_SIZE]; // 改为 D2 以便 ETH DMA 访问
+
+/*
+ * 除 JPEG_Out_Buf 的固定槽外，AI 空闲时还可向 Mem_Overlay 借激活区中的一块作为额外的槽
+ * (JPEG_LEND_SLOT)。固定槽都被引用时才用借来的槽；AI 请求收回后借来的槽不再用于编码，
+ * 引用归零且不在编码时归还。借来的槽位于可缓存的 AXI SRAM，编码完成后先 invalidate。
+ * 借来的槽只交给完成事件 (Net 任务)，不给预览：预览按观看者的 TCP 节奏持有帧，
+ * 最长可达 HTTP_STALL_MS，远超 AI_LEND_RECLAIM_MS。Net 任务取到事件时若已在收回，
+ * 把帧拷入断网缓存后立即释放 (Vision_Frame_Yielding)，否则只在一次发送期间持有。
+ * 是否启用见 app_config.h 的 JPEG_LEND_SLOTS。
+ */
+#define JPEG_LEND_SLOT   JPEG_OUT_SLOTS
+
+static VisionFrame_t jpeg_frames[JPEG_OUT_SLOTS + JPEG_LEND_SLOTS];
+static volatile int8_t enc_slot = -1;    // 正在编码的槽 (-1: 编码器空闲)
+static volatile int8_t latest_slot = -1; // 最新完成的槽
+static OverlayLease_t jpeg_lease = 0;    // 借来的槽的凭证 (0: 未持有)
+static uint8_t preview_refs[JPEG_OUT_SLOTS]; // 各固定槽中预览持有的引用数 (含在 refs 内)
+uint32_t jpeg_skipped_busy = 0;          // 所有槽都被引用/编码器忙而跳过的次数
+uint32_t jpeg_lent_frames = 0;           // 编码进借来的槽的帧数
+
+#define VISION_STRIPS_PER_FRAME (CAM_RES_HEIGHT / JPEG_STRIP_LINES)
+
+/*
+ * AI 输入缩略图直接写进模型输入张量 (位于激活区内，由 Vision_Thumb_SetTarget 指定)：
+ * AI 空闲时条带处理直接写输入张量；推理占用激活区期间写入备用缓冲，
+ * 下一次 Acquire 时再拷入输入张量，采集与推理仍可重叠。
+ * 一帧有多个裁切时，第 2 张起写入额外缓冲，由 Vision_Thumb_LoadCrop 依次拷入输入张量。
+ */
+#define THUMB_TARGET  0                    // 模型输入张量 (+ AI_Thumb_Extra)
+#define THUMB_SPARE   1                    // 备用缓冲
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t AI_Thumb_Spare[AI_MAX_CROPS][AI_THUMB_SIZE];
+#if AI_MAX_CROPS > 1
+D1_AXI_SECTION IVCIS_ALIGN_32 static uint8_t AI_Thumb_Extra[AI_MAX_CROPS - 1][AI_THUMB_SIZE];
+#endif
+static uint8_t *thumb_target = NULL;       // 模型输入张量地址 (NULL: AI 未就绪，不生成)
+static const uint8_t *thumb_lut = NULL;    // 像素值 -> 输入量化值
+static uint16_t thumb_strip = 0;           // 期望处理的下一个条带序号 (不符说明丢过条带)
+static volatile int8_t thumb_fill = -1;    // 条带处理正在写入的缓冲 (-1: 本帧跳过)
+static volatile int8_t thumb_ready = -1;   // 已完成待取的缓冲
+static volatile uint8_t thumb_busy = 0;    // 推理正在使用激活区
+static volatile uint8_t thumb_spare_lock = 0; // 备用缓冲正被 AI 任务使用
+static uint32_t thumb_frame_id[2];
+static uint32_t thumb_tick[2];
+static uint8_t thumb_n[2];                 // 各缓冲组的裁切数
+static VisionRect_t thumb_roi[2][AI_MAX_CROPS]; // 各裁切实际采样的正方形
+static uint8_t thumb_gray[2][WAKE_PIXELS];  // 唤醒级联第一级用的整帧 32x32 灰度图
+static uint8_t thumb_acquired_gray[WAKE_PIXELS];
+static uint8_t thumb_slot[2][AI_MAX_CROPS];  // 各裁切所属轨迹槽 (TRACK_NONE: 不属于轨迹)
+static uint16_t thumb_track[2][AI_MAX_CROPS]; // 规划时的轨迹号，推理期间轨迹被回收则不投票
+static int8_t thumb_acquired = -1;         // AI 任务当前持有的缓冲组
+static uint8_t thumb_acquired_n = 0;
+static VisionRect_t thumb_acquired_roi[AI_MAX_CROPS];
+static uint8_t thumb_acquired_slot[AI_MAX_CROPS];
+static uint16_t thumb_acquired_track[AI_MAX_CROPS];
+uint32_t thumb_overwritten = 0;            // AI 未及时取走而被新帧覆盖的次数
+
+/*
+ * 裁切区域：帧首按 (外部指定 > 运动框 > 默认中心裁切) 选定并生成抽样表，整帧不变。
+ * 运动框来自上一帧，外扩 AI_ROI_MARGIN_PCT 覆盖一帧内的位移；多个运动框由 Crop_Sched
+ * 排序合并后取前 crop_limit 个 (AI 任务按实测耗时与帧预算调整)。
+ */
+_Static_assert(ROI_OUT_SIZE == AI_THUMB_WIDTH && ROI_OUT_SIZE == AI_THUMB_HEIGHT, "ROI sampler output must match thumbnail");
+_Static_assert(AI_MAX_CROPS >= 1 && AI_MAX_CROPS <= CROP_MAX_CANDS, "AI_MAX_CROPS out of range");
+static const VisionRect_t roi_default = { AI_THUMB_CROP_X, 0, CAM_RES_HEIGHT, CAM_RES_HEIGHT };
+static const CropSchedCfg_t crop_cfg = {
+    CAM_RES_WIDTH, CAM_RES_HEIGHT, AI_ROI_MARGIN_PCT, AI_ROI_MIN_SIDE,
+    AI_CROP_MERGE_IOU_PCT * 256 / 100, AI_CROP_NOVELTY_GAIN
+};
+static CropSchedHist_t crop_hist;
+static VisionRoiMap_t thumb_map[AI_MAX_CROPS];
+static volatile uint8_t crop_limit = AI_MAX_CROPS;
+static VisionRect_t roi_forced;            // Vision_Thumb_SetRoi 指定的区域
+static volatile uint8_t roi_forced_valid = 0;
+static VisionRect_t motion_boxes[MOTION_MAX_BLOBS]; // 最近一次检测到的运动框 (按大小排序)
+static uint8_t motion_slot[MOTION_MAX_BLOBS];      // 各运动框关联的轨迹槽
+static uint8_t motion_n = 0;
+static uint16_t motion_age = 0xFFFF;       // 距离上次检测到运动的帧数
+uint32_t thumb_roi_frames = 0;             // 使用运动 ROI 生成的缩略图帧数
+uint32_t thumb_track_skips = 0;            // 运动目标均已判定而跳过推理的帧数
+
+/*
+ * 轨迹：帧末 (工作任务) 关联运动框，AI 任务推理后经 Vision_Thumb_Vote 投票，两者之间关中断互斥
+ * (工作任务优先级最高，关中断即排除了它)。
+ * 已判定的轨迹不再进入裁切候选；画面中的运动目标全部判定时本帧不生成缩略图。
+ */
+static Tracker_t tracker;
+static const TrackCfg_t track_cfg = {
+    AI_TRACK_IOU_PCT * 256 / 100, AI_TRACK_DIST, AI_TRACK_MAX_MISS, AI_TRACK_MIN_VOTES,
+    AI_TRACK_ALPHA, AI_TRACK_CONF
+};
+
+extern osSemaphoreId_t Sem_AI_Handle;
+extern osMessageQueueId_t Q_Net_Handle;
 
 /* ========================================== */
 /* 2. JPEG 异步回调逻辑 (实现全帧流式压缩)      */
@@ -31,72 +136,616 @@ D2_SRAM_SECTION IVCIS_ALIGN_32 uint8_t JPEG_Out_Buf[JPEG_OUT_BUFFER_SIZE]; // 
  * @brief  JPEG 输入回调：核心请求下一个条带
  */
 void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbEncodedData) {
+    uint32_t t0 = DEFER_ISR_ENTER();
+
     // 800x480 共需 30 个条带 (480 / 16 = 30)
-    if (jpeg_strips_fed < 30) {
+    if (jpeg_strips_fed < VISION_STRIPS_PER_FRAME) {
         uint8_t *p_next_strip = DCMI_Strip_Buf[jpeg_strips_fed % 2];
         // 确保硬件看到的是内存中最新的像素
         SCB_CleanDCache_by_Addr((uint32_t*)p_next_strip, STRIP_BUFFER_SIZE);
         HAL_JPEG_ConfigInputBuffer(hjpeg, p_next_strip, STRIP_BUFFER_SIZE);
         jpeg_strips_fed++;
     }
+    Defer_IsrExit(DEFER_ISR_JPEG_IN, t0);
 }
 
 /**
  * @brief  JPEG 输出回调：核心产生了一段压缩数据
  */
 void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength) {
-     jpeg_total_out_size += OutDataLength;
+    uint32_t t0 = DEFER_ISR_ENTER();
+
+    jpeg_total_out_size += OutDataLength;
+    Defer_IsrExit(DEFER_ISR_JPEG_OUT, t0);
+}
+
+/* 完成日志 (工作任务)：printf 经串口阻塞发送，不能留在中断里 */
+static void jpeg_log_encoded(uint32_t frame_id, uint32_t size) {
+    LOG_I("[JPEG] Frame %ld encoded, size=%ld bytes\r\n", frame_id, size);
 }
 
 /**
- * @brief  JPEG 完成回调：设置标志位通知任务发送
- * @note   不要在中断中直接调用 LwIP 发送函数，会导致 ETH 锁死
+ * @brief  JPEG 完成回调：把帧 (带一个引用) 投递到 Net 任务的事件队列
+ * @note   不要在中断中直接调用 LwIP 发送函数，会导致 ETH 锁死；
+ *         事件持有的引用保证 Net 任务取到之前该槽不会被下一次编码覆盖，连续完成的帧逐一排队
  */
-volatile uint8_t jpeg_encode_complete = 0; // 编码完成标志
-uint32_t last_jpeg_actual_size = 0;
-
 void HAL_JPEG_EncodeCpltCallback(JPEG_HandleTypeDef *hjpeg) {
-    last_jpeg_actual_size = jpeg_total_out_size;
-    jpeg_encode_complete = 1; // 仅设置标志，由任务读取后发送
-    printf("[JPEG] Frame %ld encoded, size=%ld bytes\r\n", full_transfer_count, jpeg_total_out_size);
+    uint32_t t0 = DEFER_ISR_ENTER();
+    VisionFrame_t *f = &jpeg_frames[enc_slot];
+    NetEvent_t ev;
+
+    f->len = jpeg_total_out_size;   /* frame_id 已在启动编码时写入 */
+    if (enc_slot >= JPEG_OUT_SLOTS) {
+        /* MDMA 直接写入内存，丢弃可缓存区中的旧行后 CPU (lwIP 校验和等) 才能读到新数据 */
+        SCB_InvalidateDCache_by_Addr((uint32_t *)f->data, JPEG_OUT_BUFFER_SIZE);
+        jpeg_lent_frames++;
+    }
+    latest_slot = enc_slot;
+    enc_slot = -1;
+    TRACE_END(TRACE_STAGE_ENCODE, f->frame_id);
+
+    ev.type = NET_EVT_JPEG;
+    ev.frame = f;
+    ev.stamp = DWT->CYCCNT;
+    f->refs++;
+    if (osMessageQueuePut(Q_Net_Handle, &ev, 0, 0) != osOK) {
+        f->refs--;
+        Net_Client_NoteEvtDrop();
+    }
+    Defer_Post(jpeg_log_encoded, f->frame_id, f->len);
+    Defer_IsrExit(DEFER_ISR_JPEG_DONE, t0);
+}
+
+void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg) {
+    if (enc_slot >= 0) {
+        TRACE_END(TRACE_STAGE_ENCODE, jpeg_frames[enc_slot].frame_id);
+    }
+    enc_slot = -1; // 放弃本帧，下一个编码节拍重新开始
+}
+
+/* ========================================== */
+/* 3. 帧共享 (引用计数)                         */
+/* ========================================== */
+
+#if JPEG_LEND_SLOTS
+/**
+ * @brief  固定槽中最新的已完成帧 (借来的槽归还时接替最新帧)
+ * @retval 槽号; -1: 没有
+ */
+static int8_t newest_fixed_slot(void) {
+    int8_t best = -1;
+
+    for (int8_t i = 0; i < JPEG_OUT_SLOTS; i++) {
+        if (i == enc_slot || jpeg_frames[i].len == 0) continue;
+        if (best < 0 || (int32_t)(jpeg_frames[i].frame_id - jpeg_frames[best].frame_id) > 0) best = i;
+    }
+    return best;
+}
+
+/**
+ * @brief  收回请求 (AI 任务) 或最后一个引用释放时调用：借来的槽空闲就归还
+ */
+static void jpeg_lend_yield(void) {
+    OverlayLease_t lease = 0;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (jpeg_lease != 0 && enc_slot != JPEG_LEND_SLOT && jpeg_frames[JPEG_LEND_SLOT].refs == 0) {
+        lease = jpeg_lease;
+        jpeg_lease = 0;
+        jpeg_frames[JPEG_LEND_SLOT].data = NULL;
+        jpeg_frames[JPEG_LEND_SLOT].len = 0;
+        if (latest_slot == JPEG_LEND_SLOT) latest_slot = newest_fixed_slot();
+    }
+    __set_PRIMASK(primask);
+    if (lease != 0) Mem_Overlay_Release(lease);  /* 调试模式下整块毒化，不在关中断内做 */
+}
+
+/**
+ * @brief  借来的槽能否用于下一次编码 (尚未持有时向 Mem_Overlay 借)
+ * @note   在工作任务中关中断调用
+ */
+static uint8_t jpeg_lend_take(void) {
+    VisionFrame_t *f = &jpeg_frames[JPEG_LEND_SLOT];
+
+    if (f->refs != 0 || Mem_Overlay_Reclaiming()) return 0;
+    if (jpeg_lease == 0) {
+        jpeg_lease = Mem_Overlay_Acquire(JPEG_OUT_BUFFER_SIZE, jpeg_lend_yield);
+        if (jpeg_lease == 0) return 0;
+        f->data = Mem_Overlay_Ptr(jpeg_lease);
+        f->len = 0;
+    }
+    if (latest_slot == JPEG_LEND_SLOT) latest_slot = -1;
+    return 1;
+}
+#endif
+
+/**
+ * @brief  为下一次编码挑选输出槽：优先选未被引用且不是最新帧的槽，
+ *         保证新加入的消费者总能拿到最近一帧。
+ *         预览最多占住 JPEG_OUT_SLOTS - 1 个固定槽，其余固定槽的引用只来自完成事件 (一次发送期间)，
+ *         卡住的观看者不会让证据帧因无槽可用而跳过
+ * @retval 槽号；全部被引用时返回 -1 (本次跳过编码)
+ * @note   在工作任务中关中断调用 (与 JPEG 完成中断互斥)
+ */
+static int8_t pick_encode_slot(void) {
+    int8_t fallback = -1;
+
+    for (int8_t i = 0; i < JPEG_OUT_SLOTS; i++) {
+        if (jpeg_frames[i].refs != 0) continue;
+        if (i != latest_slot) return i;
+        fallback = i;
+    }
+#if JPEG_LEND_SLOTS
+    /* 固定槽都被引用或只剩最新帧：先试借来的槽，保住最新帧 */
+    if (jpeg_lend_take()) return JPEG_LEND_SLOT;
+#endif
+    if (fallback >= 0) {
+        latest_slot = -1; /* 最新帧即将被覆盖，撤下 */
+    }
+    return fallback;
+}
+
+/**
+ * @brief  预览已占住的固定槽中最新的一帧 (新的预览只能共享这些槽)
+ * @param  pinned: 输出，预览已占住的槽数
+ * @retval 槽号; -1: 没有
+ */
+static int8_t newest_preview_slot(uint8_t *pinned) {
+    int8_t best = -1;
+
+    *pinned = 0;
+    for (int8_t i = 0; i < JPEG_OUT_SLOTS; i++) {
+        if (preview_refs[i] == 0) continue;
+        (*pinned)++;
+        if (best < 0 || (int32_t)(jpeg_frames[i].frame_id - jpeg_frames[best].frame_id) > 0) best = i;
+    }
+    return best;
+}
+
+/**
+ * @brief  取得最新一帧的引用 (预览，tcpip 线程调用)，用完必须 Vision_Frame_ReleasePreview
+ * @retval 无可用帧时返回 NULL
+ * @note   最新帧在借来的槽中时返回固定槽中最新的一帧：预览持有时间不受 AI 收回期限约束。
+ *         预览已占住 JPEG_OUT_SLOTS - 1 个槽时只共享其中最新的一帧 (观看者已发过则等待)，
+ *         至少留一个固定槽给编码器与证据上传
+ */
+VisionFrame_t *Vision_Frame_AcquirePreview(void) {
+    VisionFrame_t *f = NULL;
+    uint32_t primask = __get_PRIMASK();
+    uint8_t pinned;
+    int8_t slot;
+    int8_t shared;
+
+    __disable_irq();  /* 与工作任务中的选槽、JPEG 完成中断互斥 */
+    slot = latest_slot;
+#if JPEG_LEND_SLOTS
+    if (slot == JPEG_LEND_SLOT) slot = newest_fixed_slot();
+#endif
+    shared = newest_preview_slot(&pinned);
+    if (slot >= 0 && preview_refs[slot] == 0 && pinned >= JPEG_OUT_SLOTS - 1) slot = shared;
+    if (slot >= 0) {
+        f = &jpeg_frames[slot];
+        f->refs++;
+        preview_refs[slot]++;
+    }
+    __set_PRIMASK(primask);
+    return f;
+}
+
+/**
+ * @brief  释放 Vision_Frame_AcquirePreview 取得的引用
+ */
+void Vision_Frame_ReleasePreview(VisionFrame_t *frame) {
+    uint32_t primask = __get_PRIMASK();
+    uint32_t slot;
+
+    if (frame == NULL) return;
+    slot = (uint32_t)(frame - jpeg_frames);
+    __disable_irq();
+    if (slot < JPEG_OUT_SLOTS && preview_refs[slot] > 0) preview_refs[slot]--;
+    __set_PRIMASK(primask);
+    Vision_Frame_Release(frame);
+}
+
+/**
+ * @brief  帧是否在 AI 正在收回的借来的槽中 (持有者应尽快释放，不再开始耗时的使用)
+ */
+uint8_t Vision_Frame_Yielding(const VisionFrame_t *frame) {
+#if JPEG_LEND_SLOTS
+    return (frame == &jpeg_frames[JPEG_LEND_SLOT] && Mem_Overlay_Reclaiming()) ? 1 : 0;
+#else
+    (void)frame;
+    return 0;
+#endif
+}
+
+void Vision_Frame_Release(VisionFrame_t *frame) {
+    uint32_t primask = __get_PRIMASK();
+
+    if (frame == NULL) return;
+    __disable_irq();
+    if (frame->refs > 0) frame->refs--;
+    __set_PRIMASK(primask);
+#if JPEG_LEND_SLOTS
+    if (frame == &jpeg_frames[JPEG_LEND_SLOT] && frame->refs == 0 && Mem_Overlay_Reclaiming()) {
+        jpeg_lend_yield();
+    }
+#endif
 }
 
 /* ========================================== */
-/* 3. 中断回调逻辑 (DCMI 采集节拍)             */
+/* 4. AI 缩略图 (条带到达时增量生成)            */
 /* ========================================== */
 
+/* 缓冲组 set 中第 idx 张裁切的存放位置 */
+static uint8_t *thumb_buf(int8_t set, uint8_t idx) {
+    if (set == THUMB_SPARE) return AI_Thumb_Spare[idx];
+#if AI_MAX_CROPS > 1
+    if (idx > 0) return AI_Thumb_Extra[idx - 1];
+#endif
+    return thumb_target;
+}
+
+/**
+ * @brief  帧首选定本帧各裁切区域并生成抽样表
+ * @param  sq: 输出，各裁切正方形
+ * @param  slot/track: 输出，各裁切所属的轨迹槽与轨迹号
+ * @retval 裁切数；0 表示运动目标均已判定，本帧无需推理
+ */
+static uint8_t thumb_plan_frame(VisionRect_t *sq, uint8_t *slot, uint16_t *track) {
+    VisionRect_t cand[MOTION_MAX_BLOBS];
+    uint8_t cand_slot[MOTION_MAX_BLOBS];
+    uint8_t src[AI_MAX_CROPS];
+    uint8_t n_cand = 0;
+    uint8_t n = 0;
+
+    if (roi_forced_valid) {
+        Vision_Roi_Fit(&roi_forced, CAM_RES_WIDTH, CAM_RES_HEIGHT, 0, AI_THUMB_WIDTH, &sq[0]);
+        slot[0] = TRACK_NONE;
+        track[0] = 0;
+        n = 1;
+    } else if (AI_ROI_ENABLE && motion_age <= AI_ROI_HOLD_FRAMES) {
+        for (uint8_t i = 0; i < motion_n; i++) {
+            if (!Track_NeedsInference(&tracker, motion_slot[i])) continue;
+            cand[n_cand] = motion_boxes[i];
+            cand_slot[n_cand++] = motion_slot[i];
+        }
+        if (n_cand == 0 && motion_n > 0) {
+            thumb_track_skips++;
+            return 0;
+        }
+        n = Crop_Sched_Plan(&crop_cfg, &crop_hist, cand, n_cand, sq, src, crop_limit);
+        for (uint8_t i = 0; i < n; i++) {
+            slot[i] = cand_slot[src[i]];
+            track[i] = (slot[i] < TRACK_MAX) ? tracker.t[slot[i]].id : 0;
+        }
+        if (n > 0) thumb_roi_frames++;
+    }
+    if (n == 0) {
+        sq[0] = roi_default;
+        slot[0] = TRACK_NONE;
+        track[0] = 0;
+        n = 1;
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        VisionRoiMap_t *m = &thumb_map[i];
+        if (sq[i].x != m->sq.x || sq[i].y != m->sq.y || sq[i].w != m->sq.w || m->sq.w == 0) {
+            Vision_Roi_Map(&sq[i], CAM_RES_WIDTH, CAM_RES_HEIGHT, m);
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief  处理一个 RGB565 条带：更新运动检测，并把落在抽样表上的行缩放量化进各裁切
+ * @param  idx: 条带在帧内的序号 (由 DMA 中断计数)
+ * @note   工作任务中调用，每张裁切每条带只处理约 3 行 x 96 像素 (裁切越小行数越多，但每帧总量不变)。
+ *         与 JPEG 编码相同，假设 DMA 缓冲起点与帧首对齐
+ */
+static void thumb_add_strip(const uint8_t *strip, uint16_t idx) {
+    uint16_t y0 = idx * JPEG_STRIP_LINES;
+
+    if (idx != thumb_strip) {
+        /* 延后队列满丢过条带：本帧缩略图不完整，放弃，从下一个帧首重新开始 */
+        thumb_fill = -1;
+        thumb_strip = idx;
+    }
+    Motion_AddStrip(strip, thumb_strip);
+
+    if (thumb_strip == 0) {
+        /* 新帧：激活区空闲时直接写输入张量，否则写备用缓冲 */
+        if (thumb_target == NULL) thumb_fill = -1;
+        else if (!thumb_busy) thumb_fill = THUMB_TARGET;
+        else if (!thumb_spare_lock) thumb_fill = THUMB_SPARE;
+        else thumb_fill = -1;
+        if (thumb_fill >= 0) {
+            thumb_n[thumb_fill] = thumb_plan_frame(thumb_roi[thumb_fill], thumb_slot[thumb_fill],
+                                                   thumb_track[thumb_fill]);
+            if (thumb_n[thumb_fill] == 0) thumb_fill = -1;
+        }
+        if (thumb_fill >= 0 && thumb_ready == thumb_fill) {
+            thumb_ready = -1;   /* 覆盖尚未取走的旧帧 */
+            thumb_overwritten++;
+        }
+    }
+
+    if (thumb_fill >= 0) {
+        Wake_Gray_Strip(strip, y0, JPEG_STRIP_LINES, CAM_RES_WIDTH, CAM_RES_HEIGHT, thumb_gray[thumb_fill]);
+        for (uint8_t i = 0; i < thumb_n[thumb_fill]; i++) {
+            uint8_t *base = thumb_buf(thumb_fill, i);
+            if (thumb_strip == 0) {
+                Vision_Roi_FillBorder(&thumb_map[i], thumb_lut[AI_ROI_FILL], base);
+            }
+            Vision_Roi_Strip(&thumb_map[i], strip, y0, JPEG_STRIP_LINES, CAM_RES_WIDTH, thumb_lut, base);
+        }
+    }
+
+    if (++thumb_strip >= VISION_STRIPS_PER_FRAME) {
+        VisionRect_t boxes[MOTION_MAX_BLOBS];
+        uint8_t slots[MOTION_MAX_BLOBS];
+        uint8_t n = Motion_EndFrame(boxes, MOTION_MAX_BLOBS);
+
+        thumb_strip = 0;
+#if AI_TRACK_ENABLE
+        Track_Update(&tracker, &track_cfg, boxes, n, slots);
+#else
+        memset(slots, TRACK_NONE, sizeof(slots));
+#endif
+        if (n > 0) {
+            memcpy(motion_boxes, boxes, n * sizeof(VisionRect_t));
+            memcpy(motion_slot, slots, n);
+            motion_n = n;
+            motion_age = 0;
+        } else if (motion_age < 0xFFFF) {
+            motion_age++;
+        }
+        if (thumb_fill >= 0) {
+            thumb_frame_id[thumb_fill] = full_transfer_count;
+            thumb_tick[thumb_fill] = HAL_GetTick();
+            thumb_ready = thumb_fill;
+            thumb_fill = -1;
+            if (Sem_AI_Handle != NULL) {
+                osSemaphoreRelease(Sem_AI_Handle);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  指定缩略图写入位置 (模型输入张量) 与量化查找表，AI 初始化完成后调用
+ * @param  lut: 256 项，8bit 像素值 -> 模型输入量化值
+ */
+void Vision_Thumb_SetTarget(uint8_t *input, const uint8_t *lut) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    thumb_lut = lut;
+    thumb_target = input;
+    thumb_fill = -1;        /* 从下一个帧首开始生成 */
+    thumb_ready = -1;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  AI 任务取得最新一帧，保证其第 1 张裁切已位于模型输入张量中；用完调用 Vision_Thumb_Release
+ * @retval 输入张量地址；暂无新帧返回 NULL
+ * @note   返回后到 Release 之前条带处理不会再写输入张量与本帧的其余裁切，
+ *         其余裁切数见 Vision_Thumb_Crops，由 Vision_Thumb_LoadCrop 依次载入
+ */
+const uint8_t *Vision_Thumb_Acquire(uint32_t *frame_id, uint32_t *tick) {
+    int8_t src;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    src = thumb_ready;
+    if (src < 0) {
+        __set_PRIMASK(primask);
+        return NULL;
+    }
+    thumb_ready = -1;
+    thumb_busy = 1;
+    if (thumb_fill == THUMB_TARGET) thumb_fill = -1;  /* 放弃正在写入输入张量的半帧 */
+    if (src == THUMB_SPARE) thumb_spare_lock = 1;
+    if (frame_id != NULL) *frame_id = thumb_frame_id[src];
+    if (tick != NULL) *tick = thumb_tick[src];
+    thumb_acquired = src;
+    thumb_acquired_n = thumb_n[src];
+    memcpy(thumb_acquired_roi, thumb_roi[src], sizeof(thumb_acquired_roi));
+    memcpy(thumb_acquired_slot, thumb_slot[src], sizeof(thumb_acquired_slot));
+    memcpy(thumb_acquired_track, thumb_track[src], sizeof(thumb_acquired_track));
+    __set_PRIMASK(primask);
+
+    memcpy(thumb_acquired_gray, thumb_gray[src], WAKE_PIXELS);  /* 备用缓冲可能在 LoadCrop 后解锁 */
+
+    return Vision_Thumb_LoadCrop(0);
+}
+
+/**
+ * @brief  把当前帧第 idx 张裁切载入模型输入张量 (按 0,1,2... 顺序调用，0 已由 Acquire 载入)
+ * @retval 输入张量地址；idx 超出本帧裁切数返回 NULL
+ * @note   推理会覆盖输入张量，已推理过的裁切不能再次载入
+ */
+const uint8_t *Vision_Thumb_LoadCrop(uint8_t idx) {
+    if (thumb_acquired < 0 || idx >= thumb_acquired_n) return NULL;
+
+    if (thumb_acquired == THUMB_SPARE || idx > 0) {
+        memcpy(thumb_target, thumb_buf(thumb_acquired, idx), AI_THUMB_SIZE);
+    }
+    if (thumb_acquired == THUMB_SPARE && idx + 1 >= thumb_acquired_n) {
+        thumb_spare_lock = 0;   /* 备用缓冲已全部拷出，条带处理可以写下一帧 */
+    }
+    return thumb_target;
+}
+
+/**
+ * @brief  最近一次 Vision_Thumb_Acquire 取得的帧的整帧 32x32 灰度图 (唤醒级联第一级输入)
+ */
+const uint8_t *Vision_Thumb_Gray(void) {
+    return thumb_acquired_gray;
+}
+
+/**
+ * @brief  当前持有的帧的裁切数
+ */
+uint8_t Vision_Thumb_Crops(void) {
+    return (thumb_acquired < 0) ? 0 : thumb_acquired_n;
+}
+
+void Vision_Thumb_Release(void) {
+    thumb_acquired = -1;
+    thumb_spare_lock = 0;
+    thumb_busy = 0;
+}
+
+/**
+ * @brief  限制每帧生成的裁切数 (1 ~ AI_MAX_CROPS)，从下一帧生效
+ * @note   AI 任务按实测推理耗时与帧预算调整，预算内跑不完的裁切不必在条带处理中生成
+ */
+void Vision_Thumb_SetCropLimit(uint8_t limit) {
+    if (limit < 1) limit = 1;
+    if (limit > AI_MAX_CROPS) limit = AI_MAX_CROPS;
+    crop_limit = limit;
+}
+
+/**
+ * @brief  固定缩略图裁切区域 (像素坐标，会被扩成正方形)，从下一帧生效
+ * @param  roi: NULL 表示恢复自动 (运动 ROI / 默认中心裁切)
+ */
+void Vision_Thumb_SetRoi(const VisionRect_t *roi) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (roi != NULL) {
+        roi_forced = *roi;
+        roi_forced_valid = 1;
+    } else {
+        roi_forced_valid = 0;
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  最近一次 Vision_Thumb_Acquire 取得的帧中第 idx 张裁切实际采样的正方形 (可超出画面)
+ */
+void Vision_Thumb_GetRoi(uint8_t idx, VisionRect_t *roi) {
+    if (roi != NULL && idx < AI_MAX_CROPS) {
+        *roi = thumb_acquired_roi[idx];
+    }
+}
+
+/**
+ * @brief  把当前帧第 idx 张裁切的推理概率投给其所属轨迹 (AI 任务每次推理后调用)
+ * @param  out: 可为 NULL，输出投票后的轨迹快照 (轨迹号、融合类别/置信度、票数)
+ * @retval TRACK_STATE_xxx；裁切不属于轨迹时为 TRACK_STATE_NONE
+ */
+uint8_t Vision_Thumb_Vote(uint8_t idx, const float *probs, Track_t *out) {
+    uint8_t state;
+    uint32_t primask = __get_PRIMASK();
+
+    if (idx >= thumb_acquired_n) return TRACK_STATE_NONE;
+    __disable_irq();  /* 与帧末的轨迹关联互斥 */
+    state = Track_Vote(&tracker, &track_cfg, thumb_acquired_slot[idx], thumb_acquired_track[idx], probs);
+    if (out != NULL && state != TRACK_STATE_NONE) *out = tracker.t[thumb_acquired_slot[idx]];
+    __set_PRIMASK(primask);
+    return state;
+}
+
+/**
+ * @brief  轨迹统计快照 (新建/判定/投票次数)
+ */
+void Vision_Track_GetStats(uint32_t *created, uint32_t *decided, uint32_t *votes) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (created != NULL) *created = tracker.created;
+    if (decided != NULL) *decided = tracker.decided;
+    if (votes != NULL) *votes = tracker.votes;
+    __set_PRIMASK(primask);
+}
+
+/* ========================================== */
+/* 5. 中断回调逻辑 (DCMI 采集节拍，只投递)     */
+/* ========================================== */
+
+/**
+ * @brief  条带处理 (工作任务)
+ * @param  arg: 缓冲号 | (条带序号 << 8)
+ * @param  seq: 投递时已完成的条带总数，处理完 DMA 又写完一个条带说明这一半已开始被覆盖
+ */
+static void vision_strip_work(uint32_t arg, uint32_t seq) {
+    uint8_t buf = (uint8_t)(arg & 0xFFU);
+
+    TRACE_BEGIN(TRACE_STAGE_STRIP, arg >> 8);
+    SCB_InvalidateDCache_by_Addr((uint32_t*)DCMI_Strip_Buf[buf], STRIP_BUFFER_SIZE);
+    if (buf == 0) HAL_GPIO_TogglePin(LD1_GPIO_Port, LD1_Pin);
+    else HAL_GPIO_TogglePin(LD3_GPIO_Port, LD3_Pin);
+    thumb_add_strip(DCMI_Strip_Buf[buf], (uint16_t)(arg >> 8));
+    if (half_transfer_count + full_transfer_count != seq) strip_late++;
+    TRACE_END(TRACE_STAGE_STRIP, arg >> 8);
+}
+
+/**
+ * @brief  启动一帧 JPEG 编码 (工作任务)；编码参数在 Vision_Init 中只配置一次
+ */
+static void vision_encode_work(uint32_t unused_a, uint32_t unused_b) {
+    uint32_t primask = __get_PRIMASK();
+    int8_t slot;
+
+    __disable_irq();
+    slot = (enc_slot < 0) ? pick_encode_slot() : -1;
+    if (slot >= 0) {
+        enc_slot = slot;
+        if (slot < JPEG_OUT_SLOTS) jpeg_frames[slot].data = JPEG_Out_Buf[slot];
+        jpeg_frames[slot].tick = HAL_GetTick();
+        /* 帧号在启动时锁定：编码跨越后续 DMA 完成中断，完成时计数已前进 */
+        jpeg_frames[slot].frame_id = full_transfer_count;
+        jpeg_strips_fed = 1; // 第一次调用 HAL_JPEG_Encode_DMA 会自动消耗第0个条带
+        jpeg_total_out_size = 0;
+    } else {
+        jpeg_skipped_busy++;
+    }
+    __set_PRIMASK(primask);
+
+    if (slot >= 0) {
+        // 启动异步压缩接力
+        TRACE_BEGIN(TRACE_STAGE_ENCODE, jpeg_frames[slot].frame_id);
+        HAL_JPEG_Encode_DMA(&hjpeg, DCMI_Strip_Buf[0], STRIP_BUFFER_SIZE,
+                            jpeg_frames[slot].data, JPEG_OUT_BUFFER_SIZE);
+    }
+}
+
+/* 中断只计数并投递，条带处理与启动编码都在工作任务中进行 */
+static void vision_strip_done(uint8_t buf) {
+    uint32_t seq = half_transfer_count + full_transfer_count;
+
+    Defer_Post(vision_strip_work, buf | ((uint32_t)dcmi_strip << 8), seq);
+    if (++dcmi_strip >= VISION_STRIPS_PER_FRAME) dcmi_strip = 0;
+}
+
 void Vision_DMA_HalfTransfer_Callback(DMA_HandleTypeDef *hdma) {
-    SCB_InvalidateDCache_by_Addr((uint32_t*)DCMI_Strip_Buf[0], STRIP_BUFFER_SIZE);
+    uint32_t t0 = DEFER_ISR_ENTER();
+
     half_transfer_count++;
-    HAL_GPIO_TogglePin(LD1_GPIO_Port, LD1_Pin);
+    vision_strip_done(0);
+    Defer_IsrExit(DEFER_ISR_DMA_HALF, t0);
 }
 
 void Vision_DMA_FullTransfer_Callback(DMA_HandleTypeDef *hdma) {
-    SCB_InvalidateDCache_by_Addr((uint32_t*)DCMI_Strip_Buf[1], STRIP_BUFFER_SIZE);
+    uint32_t t0 = DEFER_ISR_ENTER();
+
     full_transfer_count++;
-    HAL_GPIO_TogglePin(LD3_GPIO_Port, LD3_Pin);
+    vision_strip_done(1);
 
     // 每 50 帧执行一次全帧压缩上报 (控制带宽占用)
     if (full_transfer_count % 50 == 0) {
-        JPEG_ConfTypeDef Conf;
-        jpeg_strips_fed = 1; // 第一次调用 HAL_JPEG_Encode_DMA 会自动消耗第0个条带
-        jpeg_total_out_size = 0;
-
-        Conf.ColorSpace = JPEG_YCBCR_COLORSPACE;
-        Conf.ChromaSubsampling = JPEG_420_SUBSAMPLING;
-        Conf.ImageHeight = 480;
-        Conf.ImageWidth = 800;
-        Conf.ImageQuality = 75;
-        HAL_JPEG_ConfigEncoding(&hjpeg, &Conf);
-
-        // 启动异步压缩接力
-        HAL_JPEG_Encode_DMA(&hjpeg, DCMI_Strip_Buf[0], STRIP_BUFFER_SIZE,
-                            JPEG_Out_Buf, JPEG_OUT_BUFFER_SIZE);
+        Defer_Post(vision_encode_work, 0, 0);
     }
+    Defer_IsrExit(DEFER_ISR_DMA_FULL, t0);
 }
 
 /* ========================================== */
-/* 4. 初始化逻辑                              */
+/* 6. 初始化逻辑                              */
 /* ========================================== */
 
 int8_t Vision_Init(void) {
@@ -118,6 +767,15 @@ int8_t Vision_Init(void) {
     hdcmi.Init.HSPolarity = DCMI_HSPOLARITY_LOW;
     HAL_DCMI_Init(&hdcmi);
 
+    /* 编码参数固定，只配置一次 (HAL 保留配置，生成量化/Huffman 表较耗时，不放在每帧启动编码时) */
+    JPEG_ConfTypeDef Conf;
+    Conf.ColorSpace = JPEG_YCBCR_COLORSPACE;
+    Conf.ChromaSubsampling = JPEG_420_SUBSAMPLING;
+    Conf.ImageHeight = 480;
+    Conf.ImageWidth = 800;
+    Conf.ImageQuality = 75;
+    HAL_JPEG_ConfigEncoding(&hjpeg, &Conf);
+
     uint32_t dma_len_words = (STRIP_BUFFER_SIZE * 2) / 4;
     HAL_DCMI_Start_DMA(&hdcmi, DCMI_MODE_CONTINUOUS, (uint32_t)DCMI_Strip_Buf, dma_len_words);
 
@@ -0,0 +1,125 @@
+#include "Vision_Roi.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. 裁切区域                                 */
+/* ========================================== */
+
+/* 单轴定位：放得下时尽量保持目标居中并推回画面内，放不下时居中 (两侧 letterbox) */
+static int16_t fit_axis(int32_t pos, uint32_t side, uint16_t limit) {
+    if (side >= limit) return (int16_t)(-(int32_t)(side - limit) / 2);
+    if (pos < 0) return 0;
+    if (pos + (int32_t)side > limit) return (int16_t)(limit - side);
+    return (int16_t)pos;
+}
+
+/**
+ * @brief  把运动框扩成采样用的正方形
+ * @param  margin_pct: 四周各外扩的比例 (相对长边)，给检测滞后一帧的目标留余量
+ * @param  min_side: 最小边长，小于输出尺寸时抽样会退化为重复像素，没有意义
+ * @note   边长上限为画面宽；超过画面高时上下 letterbox
+ */
+void Vision_Roi_Fit(const VisionRect_t *box, uint16_t frame_w, uint16_t frame_h,
+                    uint16_t margin_pct, uint16_t min_side, VisionRect_t *sq) {
+    uint32_t side = (box->w > box->h) ? box->w : box->h;
+
+    side += side * 2U * margin_pct / 100U;
+    if (side < min_side) side = min_side;
+    if (side > frame_w) side = frame_w;
+
+    sq->x = fit_axis(box->x + box->w / 2 - (int32_t)side / 2, side, frame_w);
+    sq->y = fit_axis(box->y + box->h / 2 - (int32_t)side / 2, side, frame_h);
+    sq->w = (uint16_t)side;
+    sq->h = (uint16_t)side;
+}
+
+/**
+ * @brief  两个矩形的交并比
+ * @retval 0~256 (Q8)
+ */
+uint16_t Vision_Roi_IoU(const VisionRect_t *a, const VisionRect_t *b) {
+    int32_t x0 = (a->x > b->x) ? a->x : b->x;
+    int32_t y0 = (a->y > b->y) ? a->y : b->y;
+    int32_t x1 = (a->x + a->w < b->x + b->w) ? a->x + a->w : b->x + b->w;
+    int32_t y1 = (a->y + a->h < b->y + b->h) ? a->y + a->h : b->y + b->h;
+    uint32_t inter, uni;
+
+    if (x1 <= x0 || y1 <= y0) return 0;
+    inter = (uint32_t)(x1 - x0) * (uint32_t)(y1 - y0);
+    uni = (uint32_t)a->w * a->h + (uint32_t)b->w * b->h - inter;
+    return (uint16_t)((inter << 8) / uni);
+}
+
+/* ========================================== */
+/* 2. 抽样表                                   */
+/* ========================================== */
+
+static void map_axis(int16_t pos, uint16_t side, uint16_t limit, uint16_t *src, uint8_t *first, uint8_t *end) {
+    *first = ROI_OUT_SIZE;
+    *end = 0;
+    for (uint16_t i = 0; i < ROI_OUT_SIZE; i++) {
+        int32_t s = pos + (int32_t)((2U * i + 1U) * side / (2U * ROI_OUT_SIZE));  /* 抽样格中心 */
+        if (s < 0 || s >= limit) {
+            src[i] = ROI_NONE;
+            continue;
+        }
+        src[i] = (uint16_t)s;
+        if (*first == ROI_OUT_SIZE) *first = (uint8_t)i;
+        *end = (uint8_t)(i + 1);
+    }
+    if (*first == ROI_OUT_SIZE) *first = 0;
+}
+
+/**
+ * @brief  为裁切正方形生成行/列抽样表 (帧首调用一次)
+ * @note   中心 480x480 正方形对应 5 倍抽样、取每格第 2 个像素，与原固定裁切完全一致
+ */
+void Vision_Roi_Map(const VisionRect_t *sq, uint16_t frame_w, uint16_t frame_h, VisionRoiMap_t *map) {
+    map->sq = *sq;
+    map_axis(sq->y, sq->h, frame_h, map->row_src, &map->row_first, &map->row_end);
+    map_axis(sq->x, sq->w, frame_w, map->col_src, &map->col_first, &map->col_end);
+}
+
+/**
+ * @brief  填充画面外的 letterbox 区域 (帧首调用，条带只写有效区域)
+ * @param  fill: 已量化的填充值
+ */
+void Vision_Roi_FillBorder(const VisionRoiMap_t *map, uint8_t fill, uint8_t *dst) {
+    const uint32_t row_bytes = ROI_OUT_SIZE * 3U;
+
+    for (uint16_t r = 0; r < ROI_OUT_SIZE; r++) {
+        uint8_t *row = dst + r * row_bytes;
+        if (r < map->row_first || r >= map->row_end) {
+            memset(row, fill, row_bytes);
+            continue;
+        }
+        memset(row, fill, map->col_first * 3U);
+        memset(row + map->col_end * 3U, fill, (ROI_OUT_SIZE - map->col_end) * 3U);
+    }
+}
+
+/**
+ * @brief  把一个 RGB565 条带中被抽中的行缩放并量化进缩略图
+ * @param  strip: 条带首地址 (OV5640 大端 RGB565)，覆盖源行 [y0, y0 + lines)
+ * @param  lut: 8bit 像素值 -> 模型输入量化值
+ * @note   条带处理 (延后工作任务) 中调用，每个输出像素一次查表，开销与固定裁切相同
+ */
+void Vision_Roi_Strip(const VisionRoiMap_t *map, const uint8_t *strip, uint16_t y0, uint16_t lines,
+                      uint16_t frame_w, const uint8_t *lut, uint8_t *dst) {
+    for (uint16_t r = map->row_first; r < map->row_end; r++) {
+        uint16_t sy = map->row_src[r];
+        if (sy < y0) continue;
+        if (sy >= y0 + lines) break;
+
+        const uint8_t *line = strip + (uint32_t)(sy - y0) * frame_w * 2U;
+        uint8_t *d = dst + ((uint32_t)r * ROI_OUT_SIZE + map->col_first) * 3U;
+        for (uint16_t c = map->col_first; c < map->col_end; c++) {
+            const uint8_t *s = line + map->col_src[c] * 2U;
+            uint16_t px = (uint16_t)((s[0] << 8) | s[1]);  /* OV5640 先发高字节 */
+            d[0] = lut[(px >> 8) & 0xF8];
+            d[1] = lut[(px >> 3) & 0xFC];
+            d[2] = lut[(uint8_t)(px << 3)];
+            d += 3;
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include "Vision_Track.h"
+#include <string.h>
+
+/* ========================================== */
+/* 1. 关联                                     */
+/* ========================================== */
+
+static uint16_t center_dist(const VisionRect_t *a, const VisionRect_t *b) {
+    int32_t dx = (a->x + a->w / 2) - (b->x + b->w / 2);
+    int32_t dy = (a->y + a->h / 2) - (b->y + b->h / 2);
+    uint32_t d = (uint32_t)((dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy));
+    return (d > 0xFFFF) ? 0xFFFF : (uint16_t)d;
+}
+
+void Track_Init(Tracker_t *trk) {
+    memset(trk, 0, sizeof(*trk));
+}
+
+/**
+ * @brief  把本帧运动框关联到轨迹 (帧末调用一次，无运动时 n = 0 也要调用以老化轨迹)
+ * @param  boxes: 运动框，按优先级排序 (大框先关联)
+ * @param  slot: 输出，各运动框对应的轨迹槽；轨迹已满时为 TRACK_NONE
+ * @note   贪心关联：先找 IoU 最大且不低于 iou_min 的轨迹，没有则找中心距离最近且不超过
+ *         dist_max 的轨迹 (快速移动的小目标相邻帧可能不重叠)，都没有则新建轨迹
+ */
+void Track_Update(Tracker_t *trk, const TrackCfg_t *cfg, const VisionRect_t *boxes, uint8_t n, uint8_t *slot) {
+    uint8_t matched[TRACK_MAX] = {0};
+
+    for (uint8_t i = 0; i < n; i++) {
+        int8_t best = -1;
+        uint16_t best_iou = 0;
+        uint16_t best_dist = 0xFFFF;
+
+        for (uint8_t j = 0; j < TRACK_MAX; j++) {
+            if (trk->t[j].id == 0 || matched[j]) continue;
+            uint16_t iou = Vision_Roi_IoU(&trk->t[j].box, &boxes[i]);
+            if (iou >= cfg->iou_min && iou > best_iou) {
+                best_iou = iou;
+                best = (int8_t)j;
+            }
+        }
+        if (best < 0) {
+            for (uint8_t j = 0; j < TRACK_MAX; j++) {
+                if (trk->t[j].id == 0 || matched[j]) continue;
+                uint16_t d = center_dist(&trk->t[j].box, &boxes[i]);
+                if (d <= cfg->dist_max && d < best_dist) {
+                    best_dist = d;
+                    best = (int8_t)j;
+                }
+            }
+        }
+        if (best < 0) {
+            for (uint8_t j = 0; j < TRACK_MAX; j++) {
+                if (trk->t[j].id != 0) continue;
+                memset(&trk->t[j], 0, sizeof(Track_t));
+                if (++trk->next_id == 0) trk->next_id = 1;
+                trk->t[j].id = trk->next_id;
+                trk->t[j].state = TRACK_STATE_ACTIVE;
+                trk->created++;
+                best = (int8_t)j;
+                break;
+            }
+        }
+        if (best < 0) {
+            slot[i] = TRACK_NONE;
+            continue;
+        }
+        matched[best] = 1;
+        trk->t[best].box = boxes[i];
+        trk->t[best].misses = 0;
+        slot[i] = (uint8_t)best;
+    }
+
+    /* 未关联的轨迹老化，超过 max_miss 帧视为目标已离开 */
+    for (uint8_t j = 0; j < TRACK_MAX; j++) {
+        if (trk->t[j].id == 0 || matched[j]) continue;
+        if (++trk->t[j].misses > cfg->max_miss) trk->t[j].id = 0;
+    }
+}
+
+/**
+ * @brief  该轨迹是否还需要推理
+ */
+uint8_t Track_NeedsInference(const Tracker_t *trk, uint8_t slot) {
+    if (slot >= TRACK_MAX) return 1;
+    return trk->t[slot].id == 0 || trk->t[slot].state != TRACK_STATE_DONE;
+}
+
+/* ========================================== */
+/* 2. 概率融合                                 */
+/* ========================================== */
+
+/**
+ * @brief  把一次推理的类别概率投给轨迹：acc += alpha x (probs - acc)，首票直接取 probs
+ * @param  id: 规划该裁切时的轨迹号，推理期间轨迹槽已被回收/复用时丢弃本票
+ * @retval TRACK_STATE_xxx；TRACK_STATE_DECIDED 表示本票使轨迹判定 (每条轨迹只出现一次)
+ */
+uint8_t Track_Vote(Tracker_t *trk, const TrackCfg_t *cfg, uint8_t slot, uint16_t id, const float *probs) {
+    Track_t *t;
+
+    if (slot >= TRACK_MAX || id == 0 || trk->t[slot].id != id) return TRACK_STATE_NONE;
+    t = &trk->t[slot];
+    if (t->state == TRACK_STATE_DONE) return TRACK_STATE_DONE;
+
+    t->best = 0;
+    for (uint8_t c = 0; c < TRACK_CLASSES; c++) {
+        t->acc[c] = (t->votes == 0) ? probs[c] : t->acc[c] + cfg->alpha * (probs[c] - t->acc[c]);
+        if (t->acc[c] > t->acc[t->best]) t->best = c;
+    }
+    t->score = t->acc[t->best];
+    t->votes++;
+    trk->votes++;
+
+    if (t->votes >= cfg->min_votes && t->score >= cfg->conf) {
+        t->state = TRACK_STATE_DONE;
+        trk->decided++;
+        return TRACK_STATE_DECIDED;
+    }
+    return TRACK_STATE_ACTIVE;
+}
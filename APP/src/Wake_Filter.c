@@ -0,0 +1,88 @@
+#include "Wake_Filter.h"
+
+/* ========================================== */
+/* 1. 灰度抽样 (延后工作任务中调用)            */
+/* ========================================== */
+
+/* 第 i 个抽样点在 [0, limit) 上的坐标 (抽样格中心) */
+static inline uint16_t wake_src(uint16_t i, uint16_t limit) {
+    return (uint16_t)((2U * i + 1U) * limit / (2U * WAKE_SIZE));
+}
+
+/**
+ * @brief  把一个 RGB565 条带中被抽中的行写入 32x32 灰度图
+ * @param  strip: 条带首地址 (OV5640 大端 RGB565)，覆盖源行 [y0, y0 + lines)
+ * @note   800x480 每条带最多 2 行 x 32 点，开销可忽略
+ */
+void Wake_Gray_Strip(const uint8_t *strip, uint16_t y0, uint16_t lines,
+                     uint16_t frame_w, uint16_t frame_h, uint8_t *gray) {
+    for (uint16_t r = (uint16_t)(y0 * WAKE_SIZE / frame_h); r < WAKE_SIZE; r++) {
+        uint16_t sy = wake_src(r, frame_h);
+        if (sy < y0) continue;
+        if (sy >= y0 + lines) break;
+
+        const uint8_t *line = strip + (uint32_t)(sy - y0) * frame_w * 2U;
+        for (uint16_t c = 0; c < WAKE_SIZE; c++) {
+            const uint8_t *s = line + wake_src(c, frame_w) * 2U;
+            uint16_t px = (uint16_t)((s[0] << 8) | s[1]);
+            gray[r * WAKE_SIZE + c] = (uint8_t)((((px >> 8) & 0xF8) * 77U + ((px >> 3) & 0xFC) * 150U +
+                                                 ((uint8_t)(px << 3)) * 29U) >> 8);
+        }
+    }
+}
+
+/* ========================================== */
+/* 2. 判定                                     */
+/* ========================================== */
+
+static inline uint16_t absdiff(int32_t a, int32_t b) {
+    return (uint16_t)((a > b) ? a - b : b - a);
+}
+
+/**
+ * @brief  计算一帧的变化点数并更新背景 (AI 任务调用)
+ * @param  scratch: WAKE_SCRATCH_BYTES 字节工作区 (可借用推理前空闲的激活区)
+ * @retval 变化点数；预热期内返回 0xFFFF (视为唤醒)
+ * @note   32x32 点各做一次梯度与两次比较，H7 上约 20~30 us
+ */
+uint16_t Wake_Score(const WakeCfg_t *cfg, WakeBg_t *bg, const uint8_t *gray, uint16_t *scratch) {
+    uint16_t points = 0;
+    uint8_t shift;
+
+    /* 梯度能量：前向差分，边缘行/列复制相邻值 */
+    for (uint16_t y = 0; y < WAKE_SIZE; y++) {
+        for (uint16_t x = 0; x < WAKE_SIZE; x++) {
+            const uint8_t *p = &gray[y * WAKE_SIZE + x];
+            uint16_t gx = (x + 1 < WAKE_SIZE) ? absdiff(p[1], p[0]) : absdiff(p[0], p[-1]);
+            uint16_t gy = (y + 1 < WAKE_SIZE) ? absdiff(p[WAKE_SIZE], p[0]) : absdiff(p[0], p[-WAKE_SIZE]);
+            scratch[y * WAKE_SIZE + x] = (uint16_t)(gx + gy);
+        }
+    }
+
+    if (bg->frames < cfg->warmup) {
+        for (uint16_t i = 0; i < WAKE_PIXELS; i++) {
+            bg->luma[i] = (bg->frames == 0) ? (uint16_t)(gray[i] << 8)
+                        : (uint16_t)(bg->luma[i] + (((int32_t)(gray[i] << 8) - bg->luma[i]) >> 2));
+            bg->edge[i] = (bg->frames == 0) ? (uint16_t)(scratch[i] << 6)
+                        : (uint16_t)(bg->edge[i] + (((int32_t)(scratch[i] << 6) - bg->edge[i]) >> 2));
+        }
+        bg->frames++;
+        return 0xFFFF;
+    }
+
+    for (uint16_t i = 0; i < WAKE_PIXELS; i++) {
+        if (absdiff(gray[i], bg->luma[i] >> 8) > cfg->luma_thresh ||
+            absdiff(scratch[i], bg->edge[i] >> 6) > cfg->edge_thresh) {
+            points++;
+        }
+    }
+
+    /* 有目标时背景几乎冻结，停住的车辆不会很快被学进背景 */
+    shift = (points >= cfg->min_points) ? (uint8_t)(cfg->bg_shift + 3) : cfg->bg_shift;
+    for (uint16_t i = 0; i < WAKE_PIXELS; i++) {
+        bg->luma[i] = (uint16_t)(bg->luma[i] + (((int32_t)(gray[i] << 8) - bg->luma[i]) >> shift));
+        bg->edge[i] = (uint16_t)(bg->edge[i] + (((int32_t)(scratch[i] << 6) - bg->edge[i]) >> shift));
+    }
+    bg->frames++;
+    return points;
+}
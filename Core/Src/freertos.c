@@ -25,12 +25,26 @@
 #include "lwip/ip_addr.h"   // 提供 ip4addr_ntoa
 #include "Vision_Pipeline.h" // 以后我们要在这里调用视觉接口
 #include "Net_Client.h"
+#include "Boot_Timing.h"
+#include "Rtp_Jpeg.h"
+#include "Http_Mjpeg.h"
+#include "AI_Inference.h"
+#include "Model_Ota.h"
+#include "AI_Validate.h"
+#include "Defer_Work.h"
+#include "Log.h"
+#include "Sys_Stats.h"
+#include "Trace.h"
+#include "Net_Store.h"
+#include "Hw_Crc.h"
 #include <string.h>
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
+typedef StaticTask_t osStaticThreadDef_t;
 /* USER CODE BEGIN PTD */
-
+typedef StaticQueue_t osStaticMessageQDef_t;
+typedef StaticSemaphore_t osStaticSemaphoreDef_t;
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
@@ -47,32 +61,75 @@
 /* USER CODE BEGIN Variables */
 // 引用 main.c 中定义的缓冲区用于调试检查
 osSemaphoreId_t Sem_AI_Handle;  // Camera -> AI 的信号
-osSemaphoreId_t Sem_Net_Handle; // AI -> Net 的信号
+osMessageQueueId_t Q_Net_Handle; // 中断/AI -> Net 的事件 (NetEvent_t)
 extern DMA_HandleTypeDef hdma_dcmi;
 extern DCMI_HandleTypeDef hdcmi;
 extern struct netif gnetif;
 extern ETH_HandleTypeDef heth;
 extern ETH_DMADescTypeDef DMATxDscrTab[];
+/* 日志发送任务：高于 AI/tcpip，只做拷贝与启动 DMA，不会长时间占用 CPU */
+osThreadId_t Task_LogHandle;
+RTOS_SECTION uint32_t Task_LogBuffer[512];
+RTOS_SECTION osStaticThreadDef_t Task_LogControlBlock;
+const osThreadAttr_t Task_Log_attributes = {
+  .name = "Task_Log",
+  .cb_mem = &Task_LogControlBlock,
+  .cb_size = sizeof(Task_LogControlBlock),
+  .stack_mem = &Task_LogBuffer[0],
+  .stack_size = sizeof(Task_LogBuffer),
+  .priority = (osPriority_t) osPriorityAboveNormal,
+};
+/* 信号量/队列同样静态创建 (控制块与队列存储在 .rtos_sec)，FreeRTOS 堆只剩 lwIP 内部对象使用 */
+RTOS_SECTION osStaticSemaphoreDef_t Sem_AI_ControlBlock;
+const osSemaphoreAttr_t Sem_AI_attributes = {
+  .name = "Sem_AI",
+  .cb_mem = &Sem_AI_ControlBlock,
+  .cb_size = sizeof(Sem_AI_ControlBlock),
+};
+RTOS_SECTION uint8_t Q_Net_Buffer[NET_EVT_QUEUE_LEN * sizeof(NetEvent_t)];
+RTOS_SECTION osStaticMessageQDef_t Q_Net_ControlBlock;
+const osMessageQueueAttr_t Q_Net_attributes = {
+  .name = "Q_Net",
+  .cb_mem = &Q_Net_ControlBlock,
+  .cb_size = sizeof(Q_Net_ControlBlock),
+  .mq_mem = &Q_Net_Buffer,
+  .mq_size = sizeof(Q_Net_Buffer),
+};
 /* USER CODE END Variables */
 /* Definitions for Task_Camera */
 osThreadId_t Task_CameraHandle;
+uint32_t Task_CameraBuffer[ 2048 ];
+osStaticThreadDef_t Task_CameraControlBlock;
 const osThreadAttr_t Task_Camera_attributes = {
   .name = "Task_Camera",
-  .stack_size = 2048 * 4,
+  .cb_mem = &Task_CameraControlBlock,
+  .cb_size = sizeof(Task_CameraControlBlock),
+  .stack_mem = &Task_CameraBuffer[0],
+  .stack_size = sizeof(Task_CameraBuffer),
   .priority = (osPriority_t) osPriorityHigh,
 };
 /* Definitions for Task_AI */
 osThreadId_t Task_AIHandle;
+uint32_t Task_AIBuffer[ 4096 ];
+osStaticThreadDef_t Task_AIControlBlock;
 const osThreadAttr_t Task_AI_attributes = {
   .name = "Task_AI",
-  .stack_size = 4096 * 4,
+  .cb_mem = &Task_AIControlBlock,
+  .cb_size = sizeof(Task_AIControlBlock),
+  .stack_mem = &Task_AIBuffer[0],
+  .stack_size = sizeof(Task_AIBuffer),
   .priority = (osPriority_t) osPriorityNormal,
 };
 /* Definitions for Task_Net */
 osThreadId_t Task_NetHandle;
+uint32_t Task_NetBuffer[ 2048 ];
+osStaticThreadDef_t Task_NetControlBlock;
 const osThreadAttr_t Task_Net_attributes = {
   .name = "Task_Net",
-  .stack_size = 2048 * 4,
+  .cb_mem = &Task_NetControlBlock,
+  .cb_size = sizeof(Task_NetControlBlock),
+  .stack_mem = &Task_NetBuffer[0],
+  .stack_size = sizeof(Task_NetBuffer),
   .priority = (osPriority_t) osPriorityLow,
 };
 
@@ -88,6 +145,26 @@ void StartNetTask(void *argument);
 extern void MX_LWIP_Init(void);
 void MX_FREERTOS_Init(void); /* (MISRA C 2004 rule 8.1) */
 
+/* Hook prototypes */
+void configureTimerForRunTimeStats(void);
+unsigned long getRunTimeCounterValue(void);
+
+/* USER CODE BEGIN 1 */
+/* Functions needed when configGENERATE_RUN_TIME_STATS is on */
+/* 运行时间统计时基：DWT 周期计数器 (CPU 主频)，读一次寄存器，任务切换时几乎无额外开销 */
+void configureTimerForRunTimeStats(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55;  /* M7 需先解锁 DWT */
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+unsigned long getRunTimeCounterValue(void)
+{
+  return DWT->CYCCNT;
+}
+/* USER CODE END 1 */
+
 /**
   * @brief  FreeRTOS initialization
   * @param  None
@@ -100,10 +177,12 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_MUTEX */
   /* add mutexes, ... */
+  Hw_Crc_Init();   // 硬件 CRC 在 AI/Net 任务间共用
   /* USER CODE END RTOS_MUTEX */
 
   /* USER CODE BEGIN RTOS_SEMAPHORES */
   /* add semaphores, ... */
+  Sem_AI_Handle = osSemaphoreNew(1, 0, &Sem_AI_attributes);   // 缩略图就绪 (DMA 中断释放)
   /* USER CODE END RTOS_SEMAPHORES */
 
   /* USER CODE BEGIN RTOS_TIMERS */
@@ -112,6 +191,7 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_QUEUES */
   /* add queues, ... */
+  Q_Net_Handle = osMessageQueueNew(NET_EVT_QUEUE_LEN, sizeof(NetEvent_t), &Q_Net_attributes); // JPEG 完成/推理结果就绪
   /* USER CODE END RTOS_QUEUES */
 
   /* Create the thread(s) */
@@ -126,6 +206,7 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+  Task_LogHandle = osThreadNew(Log_Task, NULL, &Task_Log_attributes);
   /* USER CODE END RTOS_THREADS */
 
   /* USER CODE BEGIN RTOS_EVENTS */
@@ -144,11 +225,37 @@ void MX_FREERTOS_Init(void) {
 void StartCameraTask(void *argument)
 {
   /* USER CODE BEGIN StartCameraTask */
+	  uint8_t blink = 0;
+	  uint32_t blink_tick = 0;
+
+	  Boot_Mark(BOOT_SCHED);
 	  printf("[SYS] Camera Task Started.\r\n");
+	  /* 本任务兼作中断延后工作任务，须在打开 DCMI 之前绑定 */
+	  Defer_Init();
+
+	  /* 初始化视觉流水线 (摄像头/DMA/JPEG)；HAL_Delay 已改为 osDelay，
+	     SCCB 配置期间 Net 任务可以并行完成 PHY 协商与 DHCP */
+	  HAL_GPIO_WritePin(LD1_GPIO_Port, LD1_Pin, GPIO_PIN_SET);
+	  if (Vision_Init() == 0) {
+	      printf("[SYS] Vision Pipeline: OK\r\n");
+	      Boot_Mark(BOOT_CAM_READY);
+	      blink = 4; /* 蓝灯闪烁表示视觉硬件就绪 (在下面的循环中进行，DCMI 已开始投递条带) */
+	  } else {
+	      printf("[SYS] Vision Pipeline: ERROR\r\n");
+	      HAL_GPIO_WritePin(LD3_GPIO_Port, LD3_Pin, GPIO_PIN_SET); // 红灯报错
+	  }
+	  HAL_GPIO_WritePin(LD1_GPIO_Port, LD1_Pin, GPIO_PIN_RESET);
   /* Infinite loop */
   for(;;)
   {
-    osDelay(100);
+    /* 执行中断投递的延后工作 (条带处理/启动编码/日志)，空闲时刷新状态灯与统计 */
+    Defer_Run(blink ? 100 : DEFER_REPORT_INTERVAL_MS);
+    if (blink > 0 && HAL_GetTick() - blink_tick >= 100) {
+      HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
+      blink_tick = HAL_GetTick();
+      blink--;
+    }
+    Defer_Report();
   }
   /* USER CODE END StartCameraTask */
 }
@@ -163,10 +270,29 @@ void StartCameraTask(void *argument)
 void StartAITask(void *argument)
 {
   /* USER CODE BEGIN StartAITask */
+	  uint32_t frame_id, tick;
+
+	  if (AI_Inference_Init() != 0) {
+	      printf("[SYS] AI Engine: ERROR\r\n");
+	      for(;;) osDelay(1000);
+	  }
 	  /* Infinite loop */
 	  for(;;)
 	  {
-	    osDelay(100);
+	    /* 等待 DMA 中断生成完一帧缩略图；推理期间下一帧缩略图写入另一块缓冲 */
+	    if (osSemaphoreAcquire(Sem_AI_Handle, AI_REPORT_INTERVAL_MS) == osOK) {
+	      const uint8_t *thumb = Vision_Thumb_Acquire(&frame_id, &tick);
+	      if (thumb != NULL) {
+	        /* 本帧各裁切在帧预算内依次推理，每张一条结果 */
+	        AI_Inference_RunFrame(thumb, frame_id, tick);
+	        Vision_Thumb_Release();
+	      }
+#if AI_VALIDATE_ENABLE
+	      /* 上位机下发的金标输入 (验证模式下信号量由 AI_Validate 释放) */
+	      AI_Validate_Poll();
+#endif
+	    }
+	    AI_Inference_Report();
 	  }
   /* USER CODE END StartAITask */
 }
@@ -183,25 +309,88 @@ void StartNetTask(void *argument)
   /* USER CODE BEGIN StartNetTask */
 	  MX_LWIP_Init();
 	  Net_Client_Init();
+	  Sys_Stats_Init();
+#if TRACE_ENABLE
+	  Trace_Init();
+#endif
+#if RTP_JPEG_ENABLE
+	  Rtp_Jpeg_Init();
+#endif
+#if HTTP_MJPEG_ENABLE
+	  Http_Mjpeg_Init();
+#endif
+#if MODEL_OTA_ENABLE
+	  Model_Ota_Init();
+#endif
+#if AI_VALIDATE_ENABLE
+	  AI_Validate_Init();
+#endif
+
+	  NetEvent_t ev;
+	  uint32_t next_poll = HAL_GetTick();
 
 	  for(;;)
 	  {
-	    /* 检查 JPEG 编码完成标志 (由中断回调设置) */
-	    if (jpeg_encode_complete) {
-	      jpeg_encode_complete = 0;
-	      
-	      /* [DEBUG] 只发送第一帧验证端到端链路 */
-	      static uint8_t first_frame_sent = 0;
-	      if (!first_frame_sent) {
-	        first_frame_sent = 1;
-	        printf("[SINGLE_FRAME] Sending first frame...\r\n");
-	        Net_Client_SendImage(JPEG_Out_Buf, last_jpeg_actual_size, full_transfer_count);
-	        printf("[SINGLE_FRAME] Done. Check Python receiver.\r\n");
-	      } else {
-	        printf("[DCMI_TEST] Frame %ld ready (not sent)\r\n", full_transfer_count);
+	    /* 阻塞等待事件 (JPEG 完成中断/推理结果)，最迟在下一个维护节拍醒来 */
+	    int32_t wait = (int32_t)(next_poll - HAL_GetTick());
+#if NET_HANDOFF_BASELINE
+	    /* 对比测量：事件只在维护节拍处取，等同改造前的 osDelay(10) 轮询，交接延迟打印即为改造前的数值 */
+	    if (osMessageQueueGetCount(Q_Net_Handle) == 0 && wait > 0) osDelay((uint32_t)wait);
+	    wait = 0;
+#endif
+	    if (osMessageQueueGet(Q_Net_Handle, &ev, NULL, (wait > 0) ? (uint32_t)wait : 0) == osOK) {
+	      TRACE_COUNTER(TRACE_CNT_NET_QUEUE, osMessageQueueGetCount(Q_Net_Handle));
+	      if (ev.type == NET_EVT_JPEG) {
+	        /* 事件已持有帧引用，期间编码器不会覆盖该输出槽 */
+	        VisionFrame_t *frame = (VisionFrame_t *)ev.frame;
+	        uint32_t frame_id = frame->frame_id;  /* 释放后该槽可能已被下一次编码改写 */
+	        Boot_Mark(BOOT_FIRST_JPEG);
+	        Net_Client_NoteHandoff(ev.stamp);
+	        TRACE_BEGIN(TRACE_STAGE_NET_JPEG, frame_id);
+	        if (Vision_Frame_Yielding(frame)) {
+	          /* AI 正在收回该帧所在的借用槽：拷入断网缓存后立即释放，由 Poll 补发 (不做 RTP 实时输出) */
+	          Net_Client_StoreImage(frame->data, frame->len, frame_id);
+	        } else {
+	          /* 链路断开时 SendImage 会把帧转入断网缓存，恢复后由 Poll 补发 */
+	          Net_Client_SendImage(frame->data, frame->len, frame_id);
+#if RTP_JPEG_ENABLE
+	          /* 同一帧再以 RTP/JPEG 输出给标准播放器 (仅实时，不进断网缓存) */
+	          Rtp_Jpeg_SendFrame(frame->data, frame->len, frame->tick);
+#endif
+	        }
+	        Vision_Frame_Release(frame);
+	        TRACE_END(TRACE_STAGE_NET_JPEG, frame_id);
+#if HTTP_MJPEG_ENABLE
+	        /* 浏览器预览：各观看者在 tcpip 线程中按自己的节奏取帧 */
+	        Http_Mjpeg_Publish();
+#endif
+	      } else if (ev.type == NET_EVT_RESULT) {
+	        /* 推理结果 (一帧可有多张裁切，取空队列) */
+	        AiResult_t result;
+	        TRACE_BEGIN(TRACE_STAGE_NET_RESULT, 0);
+	        while (AI_Inference_GetNext(&result) == 0) {
+	          Net_Client_SendResult((const uint8_t *)&result, sizeof(result), result.frame_id);
+	        }
+	        TRACE_END(TRACE_STAGE_NET_RESULT, 0);
 	      }
 	    }
-	    osDelay(10);
+	    if ((int32_t)(HAL_GetTick() - next_poll) < 0) continue;
+	    next_poll = HAL_GetTick() + NET_POLL_INTERVAL_MS;
+	    /* 实时帧之后再按节拍补发断网期间缓存的记录 */
+	    Net_Client_Poll();
+	    /* 任务 CPU 占用/栈/堆遥测 */
+	    Sys_Stats_Poll();
+#if TRACE_ENABLE
+	    TRACE_COUNTER(TRACE_CNT_NET_STORE, Net_Store_Count());
+	    Trace_Poll();
+#endif
+#if RTP_JPEG_ENABLE
+	    Rtp_Jpeg_Poll();
+#endif
+#if MODEL_OTA_ENABLE
+	    /* 模型权重更新：写非活动区，提交后由 AI 任务在两帧之间切换 */
+	    Model_Ota_Poll();
+#endif
 	  }
   /* USER CODE END StartNetTask */
 }
@@ -37,6 +37,8 @@
 #include "ov5640.h"
 #include "Vision_Pipeline.h"
 #include "Net_Client.h"
+#include "Boot_Timing.h"
+#include "Log.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -70,11 +72,11 @@ void MX_FREERTOS_Init(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-// 重定向 printf 到串口 3 (ST-Link 虚拟串口)
+// 重定向 printf 到串口 3 (ST-Link 虚拟串口)：只写入日志缓冲，由 Task_Log 经 DMA 发出
 #ifdef __GNUC__
 int _write(int file, char *ptr, int len)
 {
-  HAL_UART_Transmit(&huart3, (uint8_t *)ptr, len, 1000);
+  Log_Write(ptr, (uint32_t)len);
   return len;
 }
 #endif
@@ -128,21 +130,9 @@ int main(void)
   MX_CRC_Init();
   /* USER CODE BEGIN 2 */
   printf("\r\n/* --- IVCIS System Startup --- */\r\n");
+  Boot_Mark(BOOT_MAIN);
 
-  /* 1. 初始化视觉流水线 (摄像头/DMA/JPEG) */
-  HAL_GPIO_WritePin(LD1_GPIO_Port, LD1_Pin, GPIO_PIN_SET);
-  if (Vision_Init() == 0) {
-      printf("[SYS] Vision Pipeline: OK\r\n");
-      /* 蓝灯闪烁表示视觉硬件就绪 */
-      for(int i=0; i<4; i++) {
-          HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
-          HAL_Delay(100);
-      }
-  } else {
-      printf("[SYS] Vision Pipeline: ERROR\r\n");
-      HAL_GPIO_WritePin(LD3_GPIO_Port, LD3_Pin, GPIO_PIN_SET); // 红灯报错
-  }
-  HAL_GPIO_WritePin(LD1_GPIO_Port, LD1_Pin, GPIO_PIN_RESET);
+  /* 视觉流水线初始化移到 Camera 任务中，与 Net 任务的 PHY 协商/DHCP 并行进行 */
 
   /* USER CODE END 2 */
 
@@ -225,6 +215,29 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  覆盖 HAL 的弱定义：调度器运行后改用 osDelay 让出 CPU，
+  *         使摄像头初始化中的长延时不再阻塞网络初始化
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  if (osKernelGetState() == osKernelRunning && __get_IPSR() == 0U)
+  {
+    osDelay((Delay < HAL_MAX_DELAY) ? Delay + 1U : Delay);
+    return;
+  }
+
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t wait = Delay;
+
+  if (wait < HAL_MAX_DELAY)
+  {
+    wait += (uint32_t)(uwTickFreq);
+  }
+  while ((HAL_GetTick() - tickstart) < wait)
+  {
+  }
+}
 
 /* USER CODE END 4 */
 
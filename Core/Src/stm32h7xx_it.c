@@ -22,6 +22,7 @@
 #include "stm32h7xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "Trace.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -62,6 +63,7 @@ extern DMA2D_HandleTypeDef hdma2d;
 extern MDMA_HandleTypeDef hmdma_jpeg_infifo_nf;
 extern MDMA_HandleTypeDef hmdma_jpeg_outfifo_ne;
 extern JPEG_HandleTypeDef hjpeg;
+extern DMA_HandleTypeDef hdma_usart3_tx;
 extern UART_HandleTypeDef huart3;
 extern TIM_HandleTypeDef htim6;
 
@@ -167,17 +169,31 @@ void DebugMon_Handler(void)
 /* please refer to the startup file (startup_stm32h7xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles DMA1 stream0 global interrupt.
+  */
+void DMA1_Stream0_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream0_IRQn 0 */
+  TRACE_ISR_ENTER(TRACE_ISR_UART_DMA);
+  /* USER CODE END DMA1_Stream0_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart3_tx);
+  /* USER CODE BEGIN DMA1_Stream0_IRQn 1 */
+  TRACE_ISR_EXIT(TRACE_ISR_UART_DMA);
+  /* USER CODE END DMA1_Stream0_IRQn 1 */
+}
+
 /**
   * @brief This function handles USART3 global interrupt.
   */
 void USART3_IRQHandler(void)
 {
   /* USER CODE BEGIN USART3_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_UART);
   /* USER CODE END USART3_IRQn 0 */
   HAL_UART_IRQHandler(&huart3);
   /* USER CODE BEGIN USART3_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_UART);
   /* USER CODE END USART3_IRQn 1 */
 }
 
@@ -201,11 +217,11 @@ void TIM6_DAC_IRQHandler(void)
 void DMA2_Stream0_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA2_Stream0_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_DCMI_DMA);
   /* USER CODE END DMA2_Stream0_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_dcmi);
   /* USER CODE BEGIN DMA2_Stream0_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_DCMI_DMA);
   /* USER CODE END DMA2_Stream0_IRQn 1 */
 }
 
@@ -215,11 +231,11 @@ void DMA2_Stream0_IRQHandler(void)
 void ETH_IRQHandler(void)
 {
   /* USER CODE BEGIN ETH_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_ETH);
   /* USER CODE END ETH_IRQn 0 */
   HAL_ETH_IRQHandler(&heth);
   /* USER CODE BEGIN ETH_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_ETH);
   /* USER CODE END ETH_IRQn 1 */
 }
 
@@ -229,11 +245,11 @@ void ETH_IRQHandler(void)
 void DCMI_IRQHandler(void)
 {
   /* USER CODE BEGIN DCMI_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_DCMI);
   /* USER CODE END DCMI_IRQn 0 */
   HAL_DCMI_IRQHandler(&hdcmi);
   /* USER CODE BEGIN DCMI_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_DCMI);
   /* USER CODE END DCMI_IRQn 1 */
 }
 
@@ -243,11 +259,11 @@ void DCMI_IRQHandler(void)
 void DMA2D_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA2D_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_DMA2D);
   /* USER CODE END DMA2D_IRQn 0 */
   HAL_DMA2D_IRQHandler(&hdma2d);
   /* USER CODE BEGIN DMA2D_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_DMA2D);
   /* USER CODE END DMA2D_IRQn 1 */
 }
 
@@ -257,11 +273,11 @@ void DMA2D_IRQHandler(void)
 void JPEG_IRQHandler(void)
 {
   /* USER CODE BEGIN JPEG_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_JPEG);
   /* USER CODE END JPEG_IRQn 0 */
   HAL_JPEG_IRQHandler(&hjpeg);
   /* USER CODE BEGIN JPEG_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_JPEG);
   /* USER CODE END JPEG_IRQn 1 */
 }
 
@@ -271,12 +287,12 @@ void JPEG_IRQHandler(void)
 void MDMA_IRQHandler(void)
 {
   /* USER CODE BEGIN MDMA_IRQn 0 */
-
+  TRACE_ISR_ENTER(TRACE_ISR_JPEG_MDMA);
   /* USER CODE END MDMA_IRQn 0 */
   HAL_MDMA_IRQHandler(&hmdma_jpeg_infifo_nf);
   HAL_MDMA_IRQHandler(&hmdma_jpeg_outfifo_ne);
   /* USER CODE BEGIN MDMA_IRQn 1 */
-
+  TRACE_ISR_EXIT(TRACE_ISR_JPEG_MDMA);
   /* USER CODE END MDMA_IRQn 1 */
 }
 
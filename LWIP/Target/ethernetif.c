@@ -33,7 +33,7 @@
 
 /* Within 'USER CODE' section, code will be kept by default at each generation */
 /* USER CODE BEGIN 0 */
-
+#include "app_config.h"
 /* USER CODE END 0 */
 
 /* Private define ------------------------------------------------------------*/
@@ -55,7 +55,12 @@
 /* ETH_RX_BUFFER_SIZE parameter is defined in lwipopts.h */
 
 /* USER CODE BEGIN 1 */
-
+/* 接收线程静态创建：栈与控制块放在 D1 .rtos_sec，不占 FreeRTOS 堆 */
+RTOS_SECTION static uint32_t EthIf_Stack[INTERFACE_THREAD_STACK_SIZE / 4];
+RTOS_SECTION static StaticTask_t EthIf_ControlBlock;
+/* lwIP 堆 (LWIP_RAM_HEAP_POINTER)：链接到 D2 .lwip_sec，紧跟 Rx 池，TX pbuf 由此分配 */
+__attribute__((section(".Lwip_HeapSection"))) __attribute__((aligned(32)))
+unsigned char lwip_ram_heap[LWIP_RAM_HEAP_SIZE];
 /* USER CODE END 1 */
 
 /* Private variables ---------------------------------------------------------*/
@@ -282,7 +287,10 @@ static void low_level_init(struct netif *netif)
 /* USER CODE BEGIN OS_THREAD_NEW_CMSIS_RTOS_V2 */
   memset(&attributes, 0x0, sizeof(osThreadAttr_t));
   attributes.name = "EthIf";
-  attributes.stack_size = INTERFACE_THREAD_STACK_SIZE;
+  attributes.cb_mem = &EthIf_ControlBlock;
+  attributes.cb_size = sizeof(EthIf_ControlBlock);
+  attributes.stack_mem = &EthIf_Stack[0];
+  attributes.stack_size = sizeof(EthIf_Stack);
   attributes.priority = osPriorityRealtime;
   osThreadNew(ethernetif_input, netif, &attributes);
 /* USER CODE END OS_THREAD_NEW_CMSIS_RTOS_V2 */
@@ -59,20 +59,28 @@
 #define MEM_SIZE 16384
 /*----- Default Value for H7 devices: 0x30004000 -----*/
 #define LWIP_RAM_HEAP_POINTER 0x30004000
+/*----- Default Value for MEMP_NUM_TCP_SEG: 16 ---*/
+#define MEMP_NUM_TCP_SEG 32
+/*----- Default Value for LWIP_DHCP: 0 ---*/
+#define LWIP_DHCP 1
 /*----- Value supported for H7 devices: 1 -----*/
 #define LWIP_SUPPORT_CUSTOM_PBUF 1
 /*----- Value in opt.h for LWIP_ETHERNET: LWIP_ARP || PPPOE_SUPPORT -*/
 #define LWIP_ETHERNET 1
 /*----- Value in opt.h for LWIP_DNS_SECURE: (LWIP_DNS_SECURE_RAND_XID | LWIP_DNS_SECURE_NO_MULTIPLE_OUTSTANDING | LWIP_DNS_SECURE_RAND_SRC_PORT) -*/
 #define LWIP_DNS_SECURE 7
+/*----- Default Value for TCP_MSS: 536 ---*/
+#define TCP_MSS 1460
+/*----- Default Value for TCP_SND_BUF: 1072 ---*/
+#define TCP_SND_BUF 5840
 /*----- Value in opt.h for TCP_SND_QUEUELEN: (4*TCP_SND_BUF + (TCP_MSS - 1))/TCP_MSS -----*/
-#define TCP_SND_QUEUELEN 9
+#define TCP_SND_QUEUELEN 16
 /*----- Value in opt.h for TCP_SNDLOWAT: LWIP_MIN(LWIP_MAX(((TCP_SND_BUF)/2), (2 * TCP_MSS) + 1), (TCP_SND_BUF) - 1) -*/
-#define TCP_SNDLOWAT 1071
+#define TCP_SNDLOWAT 2921
 /*----- Value in opt.h for TCP_SNDQUEUELOWAT: LWIP_MAX(TCP_SND_QUEUELEN)/2, 5) -*/
-#define TCP_SNDQUEUELOWAT 5
+#define TCP_SNDQUEUELOWAT 8
 /*----- Value in opt.h for TCP_WND_UPDATE_THRESHOLD: LWIP_MIN(TCP_WND/4, TCP_MSS*4) -----*/
-#define TCP_WND_UPDATE_THRESHOLD 536
+#define TCP_WND_UPDATE_THRESHOLD 1460
 /*----- Value in opt.h for LWIP_NETIF_LINK_CALLBACK: 0 -----*/
 #define LWIP_NETIF_LINK_CALLBACK 1
 /*----- Value in opt.h for TCPIP_THREAD_STACKSIZE: 0 -----*/
@@ -121,7 +129,16 @@
 #define CHECKSUM_CHECK_ICMP6 0
 /*-----------------------------------------------------------------------------*/
 /* USER CODE BEGIN 1 */
-
+/* 开机用备份 SRAM 中缓存的目标 MAC 预置静态 ARP 表项，省去首帧前的 ARP 往返 */
+#define ETHARP_SUPPORT_STATIC_ENTRIES 1
+/* 关闭 DHCP 绑定前的 ARP 冲突探测 (约 1s)，换取复位后快速上线 */
+#define DHCP_DOES_ARP_CHECK 0
+/* lwIP 堆改用 ethernetif.c 中的 lwip_ram_heap (链接到 D2 .lwip_sec，紧跟 Rx 池)。
+   Cube 默认的固定地址 0x30004000 压在 Rx 池尾部和 DCMI 条带缓冲上，链接器看不到这段占用 */
+#undef LWIP_RAM_HEAP_POINTER
+#define LWIP_RAM_HEAP_POINTER lwip_ram_heap
+#define LWIP_RAM_HEAP_SIZE (MEM_SIZE + 64) /* mem.c 需要 MEM_SIZE 加首尾两个 struct mem，余量供对齐 */
+extern unsigned char lwip_ram_heap[];
 /* USER CODE END 1 */
 
 #ifdef __cplusplus
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+IVCIS 逐层推理耗时报告
+用法: python ai_profile_report.py serial.log [--report ../X-CUBE-AI/App/vehicle_detector_generate_report.txt]
+                                  [--mhz 480] [--top 15] [--csv out.csv]
+功能: 从串口日志中提取 AIPROF 行 (AI_PROFILE_ENABLE=1 时输出，取最后一组)，
+      按 c_id 与生成报告的 "Number of operations per c-layer" 表对齐，
+      给出实测占比、周期/MACC，并与报告按 MACC 估算的占比对照，找出真实热点。
+"""
+import argparse
+import csv
+import os
+import re
+import sys
+
+DEFAULT_REPORT = os.path.join(os.path.dirname(__file__), "..", "X-CUBE-AI", "App",
+                              "vehicle_detector_generate_report.txt")
+
+
+def parse_report(path):
+    """返回 {c_id: (name, macc)}"""
+    layers = {}
+    in_table = False
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            if line.startswith("Number of operations per c-layer"):
+                in_table = True
+                continue
+            if in_table:
+                if line.startswith("total"):
+                    break
+                m = re.match(r"^(\d+)\s+\d+\s+(\S+)\s+\(.*?\)\s+([\d,]+)", line)
+                if m:
+                    layers[int(m.group(1))] = (m.group(2), int(m.group(3).replace(",", "")))
+    return layers
+
+
+def parse_log(path):
+    """返回最后一组 AIPROF 数据 {c_id: dict}"""
+    groups, cur = [], None
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith("AIPROF,"):
+                continue
+            parts = line.split(",")
+            if parts[1] == "c_id":
+                cur = {}
+                groups.append(cur)
+            elif cur is not None and parts[1] != "total":
+                cur[int(parts[1])] = {
+                    "name": parts[2], "runs": int(parts[3]), "min": int(parts[4]),
+                    "avg": int(parts[5]), "max": int(parts[6]),
+                }
+    if not groups:
+        sys.exit("no AIPROF lines found (build with AI_PROFILE_ENABLE=1)")
+    return groups[-1]
+
+
+def main():
+    ap = argparse.ArgumentParser(description="IVCIS per-layer inference profile report")
+    ap.add_argument("log")
+    ap.add_argument("--report", default=DEFAULT_REPORT)
+    ap.add_argument("--mhz", type=float, default=480.0)
+    ap.add_argument("--top", type=int, default=15)
+    ap.add_argument("--csv", help="写出合并后的 CSV")
+    args = ap.parse_args()
+
+    rep = parse_report(args.report)
+    prof = parse_log(args.log)
+    total = sum(p["avg"] for p in prof.values()) or 1
+    total_macc = sum(m for _, m in rep.values()) or 1
+
+    rows = []
+    for cid, p in sorted(prof.items()):
+        name, macc = rep.get(cid, ("?", 0))
+        if name != "?" and name != p["name"]:
+            print(f"[WARN] c_id {cid}: board says {p['name']}, report says {name} (regenerated model?)")
+        rows.append({
+            "c_id": cid, "name": p["name"], "macc": macc,
+            "avg_cyc": p["avg"], "min_cyc": p["min"], "max_cyc": p["max"],
+            "pct": 100.0 * p["avg"] / total,
+            "est_pct": 100.0 * macc / total_macc,
+            "cyc_per_macc": p["avg"] / macc if macc else 0.0,
+            "avg_us": p["avg"] / args.mhz,
+        })
+
+    print(f"{len(rows)} layers, {next(iter(prof.values()))['runs']} runs, "
+          f"avg {total / args.mhz / 1000:.2f} ms per inference")
+    print(f"{'c_id':>4} {'name':<22} {'avg_us':>9} {'jitter%':>8} {'pct':>6} {'est':>6} {'cyc/macc':>9}")
+    for r in sorted(rows, key=lambda r: r["avg_cyc"], reverse=True)[:args.top]:
+        jitter = 100.0 * (r["max_cyc"] - r["min_cyc"]) / r["avg_cyc"] if r["avg_cyc"] else 0.0
+        print(f"{r['c_id']:>4} {r['name']:<22} {r['avg_us']:>9.1f} {jitter:>8.1f} "
+              f"{r['pct']:>5.1f}% {r['est_pct']:>5.1f}% {r['cyc_per_macc']:>9.2f}")
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            w = csv.DictWriter(f, fieldnames=list(rows[0].keys()))
+            w.writeheader()
+            w.writerows(rows)
+        print(f"[OK] wrote {args.csv}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,374 @@
+#include "ai_ref.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ========================================== */
+/* 1. 运行时状态                               */
+/* ========================================== */
+/*
+ * 每个激活张量独立 malloc，不复现板端的激活区复用 (overlay)，便于逐层比对。
+ * 重量化沿用 TFLite/CMSIS-NN 的定点乘子 + 移位 (双舍入)，与 X-CUBE-AI 的 SSSA8
+ * 内核同源；softmax 用 float 计算后再量化，与板端可能有 1 LSB 差异。
+ */
+typedef struct {
+    int32_t *mult;      // 逐输出通道乘子 (Q31)
+    int32_t *shift;     // 逐输出通道移位 (>0 左移)
+    int32_t n;
+} RefRequant_t;
+
+static const uint8_t *weights = NULL;
+static void **tensor_buf = NULL;
+static RefRequant_t *node_rq = NULL;
+
+/* ========================================== */
+/* 2. 定点工具 (同 TFLite reference_ops)        */
+/* ========================================== */
+
+static void quantize_multiplier(double m, int32_t *q, int32_t *shift) {
+    int exp;
+    double f;
+    int64_t qf;
+
+    if (m == 0.0) {
+        *q = 0;
+        *shift = 0;
+        return;
+    }
+    f = frexp(m, &exp);
+    qf = (int64_t)llround(f * (double)(1LL << 31));
+    if (qf == (1LL << 31)) {
+        qf /= 2;
+        exp++;
+    }
+    if (exp < -31) {
+        exp = 0;
+        qf = 0;
+    }
+    *q = (int32_t)qf;
+    *shift = exp;
+}
+
+static int32_t sat_round_doubling_high_mul(int32_t a, int32_t b) {
+    int64_t ab;
+    int32_t nudge;
+
+    if (a == b && a == INT32_MIN) return INT32_MAX;
+    ab = (int64_t)a * (int64_t)b;
+    nudge = (ab >= 0) ? (1 << 30) : (1 - (1 << 30));
+    return (int32_t)((ab + nudge) / (1LL << 31));
+}
+
+static int32_t rounding_divide_by_pot(int32_t x, int32_t exp) {
+    int32_t mask = (int32_t)((1LL << exp) - 1);
+    int32_t rem = x & mask;
+    int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+    return (x >> exp) + (rem > threshold ? 1 : 0);
+}
+
+static int32_t mul_by_quantized(int32_t x, int32_t q, int32_t shift) {
+    int32_t left = shift > 0 ? shift : 0;
+    int32_t right = shift > 0 ? 0 : -shift;
+    return rounding_divide_by_pot(sat_round_doubling_high_mul(x * (1 << left), q), right);
+}
+
+static inline int8_t clamp_s8(int32_t v) {
+    return (int8_t)(v < -128 ? -128 : (v > 127 ? 127 : v));
+}
+
+static inline int32_t rd_s32(uint32_t off) {
+    int32_t v;
+    memcpy(&v, weights + off, sizeof(v));   // 权重块内偏置未必 4 字节对齐
+    return v;
+}
+
+static uint32_t tensor_elems(const RefTensor_t *t) {
+    return (uint32_t)t->h * t->w * t->c;
+}
+
+/* ========================================== */
+/* 3. 各层实现 (NHWC)                          */
+/* ========================================== */
+
+static void op_requant(const RefNode_t *nd) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    int8_t *out = tensor_buf[nd->out];
+    uint32_t n = tensor_elems(ti);
+    float ratio = ti->scale / to->scale;
+
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t q = (ti->fmt == REF_FMT_U8) ? ((const uint8_t *)tensor_buf[nd->in[0]])[i]
+                                            : ((const int8_t *)tensor_buf[nd->in[0]])[i];
+        out[i] = clamp_s8((int32_t)lrintf((float)(q - ti->zp) * ratio) + to->zp);
+    }
+}
+
+static void op_conv(const RefNode_t *nd, const RefRequant_t *rq) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    const int8_t *w = (const int8_t *)(weights + nd->w_off);
+    int8_t *out = tensor_buf[nd->out];
+    const int32_t kh = nd->k[0], kw = nd->k[1], cin = ti->c;
+
+    for (int32_t oy = 0; oy < to->h; oy++) {
+        for (int32_t ox = 0; ox < to->w; ox++) {
+            for (int32_t oc = 0; oc < to->c; oc++) {
+                const int8_t *wk = w + (uint32_t)oc * kh * kw * cin;
+                int32_t acc = rd_s32(nd->b_off + 4U * oc);
+
+                for (int32_t ky = 0; ky < kh; ky++) {
+                    int32_t iy = oy * nd->s[0] - nd->pad[0] + ky;
+                    if (iy < 0 || iy >= ti->h) continue;    // 填充值即零点，贡献为 0
+                    for (int32_t kx = 0; kx < kw; kx++) {
+                        int32_t ix = ox * nd->s[1] - nd->pad[2] + kx;
+                        if (ix < 0 || ix >= ti->w) continue;
+                        const int8_t *px = in + ((uint32_t)iy * ti->w + ix) * cin;
+                        const int8_t *wp = wk + (ky * kw + kx) * cin;
+                        for (int32_t ic = 0; ic < cin; ic++) {
+                            acc += (px[ic] - ti->zp) * wp[ic];
+                        }
+                    }
+                }
+                acc = mul_by_quantized(acc, rq->mult[oc], rq->shift[oc]) + to->zp;
+                out[((uint32_t)oy * to->w + ox) * to->c + oc] = clamp_s8(acc);
+            }
+        }
+    }
+}
+
+static void op_dwconv(const RefNode_t *nd, const RefRequant_t *rq) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    const int8_t *w = (const int8_t *)(weights + nd->w_off);   // [1][kh][kw][C]
+    int8_t *out = tensor_buf[nd->out];
+    const int32_t kh = nd->k[0], kw = nd->k[1], ch = to->c;
+
+    for (int32_t oy = 0; oy < to->h; oy++) {
+        for (int32_t ox = 0; ox < to->w; ox++) {
+            for (int32_t c = 0; c < ch; c++) {
+                int32_t acc = rd_s32(nd->b_off + 4U * c);
+
+                for (int32_t ky = 0; ky < kh; ky++) {
+                    int32_t iy = oy * nd->s[0] - nd->pad[0] + ky;
+                    if (iy < 0 || iy >= ti->h) continue;
+                    for (int32_t kx = 0; kx < kw; kx++) {
+                        int32_t ix = ox * nd->s[1] - nd->pad[2] + kx;
+                        if (ix < 0 || ix >= ti->w) continue;
+                        acc += (in[((uint32_t)iy * ti->w + ix) * ch + c] - ti->zp) * w[(ky * kw + kx) * ch + c];
+                    }
+                }
+                acc = mul_by_quantized(acc, rq->mult[c], rq->shift[c]) + to->zp;
+                out[((uint32_t)oy * to->w + ox) * ch + c] = clamp_s8(acc);
+            }
+        }
+    }
+}
+
+static void op_pad(const RefNode_t *nd) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    int8_t *out = tensor_buf[nd->out];
+    uint32_t row = (uint32_t)ti->w * ti->c;
+
+    memset(out, (int8_t)nd->pad_value, tensor_elems(to));
+    for (int32_t y = 0; y < ti->h; y++) {
+        memcpy(out + ((uint32_t)(y + nd->pad[0]) * to->w + nd->pad[2]) * to->c, in + (uint32_t)y * row, row);
+    }
+}
+
+/* 整数加法，同 TFLite int8 Add：两路先左移 20 位对齐到 2*max(scale)，求和后再重量化 */
+static void op_add(const RefNode_t *nd) {
+    const RefTensor_t *ta = &ref_tensors[nd->in[0]], *tb = &ref_tensors[nd->in[1]], *to = &ref_tensors[nd->out];
+    const int8_t *a = tensor_buf[nd->in[0]], *b = tensor_buf[nd->in[1]];
+    int8_t *out = tensor_buf[nd->out];
+    const int32_t left_shift = 20;
+    double twice_max = 2.0 * fmax(ta->scale, tb->scale);
+    int32_t ma, sa, mb, sb, mo, so;
+
+    quantize_multiplier(ta->scale / twice_max, &ma, &sa);
+    quantize_multiplier(tb->scale / twice_max, &mb, &sb);
+    quantize_multiplier(twice_max / ((double)(1 << left_shift) * to->scale), &mo, &so);
+
+    for (uint32_t i = 0, n = tensor_elems(to); i < n; i++) {
+        int32_t va = mul_by_quantized((a[i] - ta->zp) * (1 << left_shift), ma, sa);
+        int32_t vb = mul_by_quantized((b[i] - tb->zp) * (1 << left_shift), mb, sb);
+        out[i] = clamp_s8(mul_by_quantized(va + vb, mo, so) + to->zp);
+    }
+}
+
+static void op_avgpool(const RefNode_t *nd) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    int8_t *out = tensor_buf[nd->out];
+    int32_t m, s;
+
+    quantize_multiplier((double)ti->scale / ((double)to->scale * nd->k[0] * nd->k[1]), &m, &s);
+    for (int32_t oy = 0; oy < to->h; oy++) {
+        for (int32_t ox = 0; ox < to->w; ox++) {
+            for (int32_t c = 0; c < to->c; c++) {
+                int32_t acc = 0;
+                for (int32_t ky = 0; ky < nd->k[0]; ky++) {
+                    for (int32_t kx = 0; kx < nd->k[1]; kx++) {
+                        uint32_t iy = (uint32_t)(oy * nd->s[0] + ky), ix = (uint32_t)(ox * nd->s[1] + kx);
+                        acc += in[(iy * ti->w + ix) * ti->c + c] - ti->zp;
+                    }
+                }
+                out[((uint32_t)oy * to->w + ox) * to->c + c] = clamp_s8(mul_by_quantized(acc, m, s) + to->zp);
+            }
+        }
+    }
+}
+
+static void op_dense(const RefNode_t *nd, const RefRequant_t *rq) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    const int8_t *w = (const int8_t *)(weights + nd->w_off);   // [units][in]
+    int8_t *out = tensor_buf[nd->out];
+    uint32_t n_in = tensor_elems(ti);
+
+    for (uint32_t u = 0; u < to->c; u++) {
+        int32_t acc = rd_s32(nd->b_off + 4U * u);
+        for (uint32_t i = 0; i < n_in; i++) {
+            acc += (in[i] - ti->zp) * w[u * n_in + i];
+        }
+        int32_t ch = (rq->n > 1) ? (int32_t)u : 0;
+        out[u] = clamp_s8(mul_by_quantized(acc, rq->mult[ch], rq->shift[ch]) + to->zp);
+    }
+}
+
+static void op_softmax(const RefNode_t *nd) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]], *to = &ref_tensors[nd->out];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    int8_t *out = tensor_buf[nd->out];
+    float e[256], sum = 0.0f;
+    int32_t max = -128;
+
+    for (uint32_t i = 0; i < to->c; i++) {
+        if (in[i] > max) max = in[i];
+    }
+    for (uint32_t i = 0; i < to->c; i++) {
+        e[i] = expf(nd->beta * ti->scale * (float)(in[i] - max));
+        sum += e[i];
+    }
+    for (uint32_t i = 0; i < to->c; i++) {
+        out[i] = clamp_s8((int32_t)lrintf(e[i] / sum / to->scale) + to->zp);
+    }
+}
+
+static void op_dequant(const RefNode_t *nd) {
+    const RefTensor_t *ti = &ref_tensors[nd->in[0]];
+    const int8_t *in = tensor_buf[nd->in[0]];
+    float *out = tensor_buf[nd->out];
+
+    for (uint32_t i = 0, n = tensor_elems(ti); i < n; i++) {
+        out[i] = (float)(in[i] - ti->zp) * ti->scale;
+    }
+}
+
+/* ========================================== */
+/* 4. 对外接口                                 */
+/* ========================================== */
+
+/**
+ * @brief  绑定权重块并分配各层张量、预计算逐通道重量化参数
+ * @param  w: vehicle_detector_data_params.c 中的权重数组 (size 须等于 ref_weights_size)
+ * @retval 0: 成功; -1: 权重大小不符或内存不足
+ */
+int AI_Ref_Init(const uint8_t *w, uint32_t size) {
+    if (w == NULL || size != ref_weights_size) return -1;
+    AI_Ref_Deinit();
+    weights = w;
+
+    tensor_buf = calloc(ref_num_tensors, sizeof(void *));
+    node_rq = calloc(ref_num_nodes, sizeof(RefRequant_t));
+    if (tensor_buf == NULL || node_rq == NULL) goto fail;
+
+    for (uint16_t i = 0; i < ref_num_tensors; i++) {
+        const RefTensor_t *t = &ref_tensors[i];
+        tensor_buf[i] = calloc(tensor_elems(t), (t->fmt == REF_FMT_F32) ? sizeof(float) : 1);
+        if (tensor_buf[i] == NULL) goto fail;
+    }
+
+    for (uint16_t i = 0; i < ref_num_nodes; i++) {
+        const RefNode_t *nd = &ref_nodes[i];
+        RefRequant_t *rq = &node_rq[i];
+        if (nd->ws_n == 0) continue;
+
+        float s_in = ref_tensors[nd->in[0]].scale, s_out = ref_tensors[nd->out].scale;
+        rq->n = nd->ws_n;
+        rq->mult = malloc(sizeof(int32_t) * rq->n);
+        rq->shift = malloc(sizeof(int32_t) * rq->n);
+        if (rq->mult == NULL || rq->shift == NULL) goto fail;
+        for (int32_t c = 0; c < rq->n; c++) {
+            quantize_multiplier((double)s_in * (double)ref_wscales[nd->ws_idx + c] / (double)s_out,
+                                &rq->mult[c], &rq->shift[c]);
+        }
+    }
+    return 0;
+
+fail:
+    AI_Ref_Deinit();
+    return -1;
+}
+
+void AI_Ref_Deinit(void) {
+    if (tensor_buf != NULL) {
+        for (uint16_t i = 0; i < ref_num_tensors; i++) free(tensor_buf[i]);
+        free(tensor_buf);
+        tensor_buf = NULL;
+    }
+    if (node_rq != NULL) {
+        for (uint16_t i = 0; i < ref_num_nodes; i++) {
+            free(node_rq[i].mult);
+            free(node_rq[i].shift);
+        }
+        free(node_rq);
+        node_rq = NULL;
+    }
+    weights = NULL;
+}
+
+/**
+ * @brief  推理一帧
+ * @param  input: 96x96x3 RGB888 (与板端模型输入相同，QLinear(1.0, 0))
+ * @param  probs: 输出 15 类概率，可为 NULL (只需中间张量时)
+ * @retval 0: 成功; -1: 未初始化
+ */
+int AI_Ref_Run(const uint8_t *input, float probs[REF_NUM_CLASSES]) {
+    if (weights == NULL || input == NULL) return -1;
+
+    memcpy(tensor_buf[ref_input_tensor], input, REF_IN_SIZE);
+    for (uint16_t i = 0; i < ref_num_nodes; i++) {
+        const RefNode_t *nd = &ref_nodes[i];
+        switch (nd->op) {
+        case REF_OP_REQUANT: op_requant(nd); break;
+        case REF_OP_CONV:    op_conv(nd, &node_rq[i]); break;
+        case REF_OP_DWCONV:  op_dwconv(nd, &node_rq[i]); break;
+        case REF_OP_PAD:     op_pad(nd); break;
+        case REF_OP_ADD:     op_add(nd); break;
+        case REF_OP_AVGPOOL: op_avgpool(nd); break;
+        case REF_OP_DENSE:   op_dense(nd, &node_rq[i]); break;
+        case REF_OP_SOFTMAX: op_softmax(nd); break;
+        case REF_OP_DEQUANT: op_dequant(nd); break;
+        default: return -1;
+        }
+    }
+    if (probs != NULL) {
+        memcpy(probs, tensor_buf[ref_output_tensor], sizeof(float) * REF_NUM_CLASSES);
+    }
+    return 0;
+}
+
+/**
+ * @brief  取某个激活张量的最新内容 (逐层比对用)，格式见 ref_tensors[idx].fmt
+ */
+const void *AI_Ref_Tensor(uint16_t idx) {
+    return (tensor_buf != NULL && idx < ref_num_tensors) ? tensor_buf[idx] : NULL;
+}
+
+int AI_Ref_FindTensor(const char *name) {
+    for (uint16_t i = 0; i < ref_num_tensors; i++) {
+        if (strcmp(ref_tensors[i].name, name) == 0) return i;
+    }
+    return -1;
+}
@@ -0,0 +1,74 @@
+#ifndef AI_REF_H
+#define AI_REF_H
+
+/*
+ * vehicle_detector 主机参考推理引擎 (可移植 C99，不依赖 NetworkRuntime 静态库)
+ * 计算图由 ai_ref_gen.py 从 .ai/ 下的 c_info.json 导出到 ai_ref_graph.c，
+ * 权重直接链接 X-CUBE-AI/App/vehicle_detector_data_params.c。
+ */
+#include <stdint.h>
+
+#define REF_IN_SIZE     (96 * 96 * 3)
+#define REF_NUM_CLASSES 15
+
+typedef enum {
+    REF_FMT_U8 = 0,
+    REF_FMT_S8,
+    REF_FMT_F32,
+} RefFmt_t;
+
+typedef enum {
+    REF_OP_REQUANT = 0,   // 整数 -> 整数重量化 (输入 u8 -> s8)
+    REF_OP_CONV,          // 普通/逐点卷积，逐通道 SSSA8
+    REF_OP_DWCONV,        // 深度卷积，逐通道 SSSA8
+    REF_OP_PAD,           // 常量填充
+    REF_OP_ADD,           // 残差逐元素相加
+    REF_OP_AVGPOOL,       // 平均池化
+    REF_OP_DENSE,         // 全连接
+    REF_OP_SOFTMAX,
+    REF_OP_DEQUANT,       // 整数 -> float
+} RefOp_t;
+
+/* 激活张量 (NHWC，batch=1) */
+typedef struct {
+    const char *name;
+    uint8_t fmt;
+    uint16_t h, w, c;
+    float scale;
+    int32_t zp;
+} RefTensor_t;
+
+typedef struct {
+    uint8_t op;
+    const char *name;
+    int16_t in[2];          // 输入张量下标，-1 表示无
+    int16_t out;
+    uint32_t w_off;         // 权重在权重块中的字节偏移
+    uint32_t b_off;         // 偏置 (int32) 在权重块中的字节偏移
+    uint16_t ws_idx;        // 权重 scale 在 ref_wscales 中的起点
+    uint16_t ws_n;          // 权重 scale 个数 (逐通道为输出通道数)
+    uint8_t k[2];           // 卷积核/池化窗口 (H, W)
+    uint8_t s[2];           // 步长 (H, W)
+    uint8_t pad[4];         // 上, 下, 左, 右
+    int16_t pad_value;      // PAD 填充值 (量化域)
+    float beta;             // SOFTMAX beta
+} RefNode_t;
+
+/* ai_ref_graph.c (生成) */
+extern const uint32_t ref_weights_size;
+extern const uint64_t ref_total_macc;
+extern const uint16_t ref_num_tensors;
+extern const uint16_t ref_num_nodes;
+extern const uint16_t ref_input_tensor;
+extern const uint16_t ref_output_tensor;
+extern const RefTensor_t ref_tensors[];
+extern const float ref_wscales[];
+extern const RefNode_t ref_nodes[];
+
+int  AI_Ref_Init(const uint8_t *w, uint32_t size);
+void AI_Ref_Deinit(void);
+int  AI_Ref_Run(const uint8_t *input, float probs[REF_NUM_CLASSES]);
+const void *AI_Ref_Tensor(uint16_t idx);
+int  AI_Ref_FindTensor(const char *name);
+
+#endif
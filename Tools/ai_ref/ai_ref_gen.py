@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+IVCIS 主机参考推理引擎 —— 计算图导出
+用法: python ai_ref_gen.py [--info ../../.ai/vehicle_detector_null_c_info.json] [-o ai_ref_graph.c]
+功能: 读取 X-CUBE-AI 生成时留下的 *_c_info.json，导出 ai_ref.c 所需的节点表、
+      激活张量表 (形状/量化参数) 与逐通道权重 scale，权重数据本身仍直接链接
+      X-CUBE-AI/App/vehicle_detector_data_params.c。
+      默认选取 generated_time 与 vehicle_detector_data_params.c 头部 @date 一致的
+      json，并校验权重块大小与各权重/偏置的偏移，模型重新生成后重跑本脚本即可。
+"""
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(HERE, "..", "..")
+PARAMS_C = os.path.join(ROOT, "X-CUBE-AI", "App", "vehicle_detector_data_params.c")
+
+FMT = {"STAI_FORMAT_U8": "REF_FMT_U8", "STAI_FORMAT_S8": "REF_FMT_S8", "STAI_FORMAT_FLOAT": "REF_FMT_F32"}
+
+
+def params_date():
+    with open(PARAMS_C, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            m = re.search(r"@date\s+(\S+)", line)
+            if m:
+                return m.group(1)
+    return None
+
+
+def pick_info():
+    date = params_date()
+    cands = sorted(glob.glob(os.path.join(ROOT, ".ai", "*_c_info.json")))
+    for path in cands:
+        with open(path, encoding="utf-8") as f:
+            env = json.load(f)["environment"]
+        if env["generated_model"]["generated_time"] == date:
+            return path
+    sys.exit(f"no c_info.json matches vehicle_detector_data_params.c @date {date}")
+
+
+def nums(s):
+    return [int(v) for v in re.findall(r"-?\d+", s)]
+
+
+def hwc(buf):
+    """按 shape_map 取 (H, W, C)，缺省维度为 1"""
+    dims = dict(zip(buf["shape_map"], buf["shape"]))
+    return dims.get("H", 1), dims.get("W", 1), dims.get("CH", 1)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="export vehicle_detector graph for the host reference engine")
+    ap.add_argument("--info", help="c_info.json (默认按 @date 自动匹配)")
+    ap.add_argument("-o", "--out", default=os.path.join(HERE, "ai_ref_graph.c"))
+    args = ap.parse_args()
+
+    info_path = args.info or pick_info()
+    with open(info_path, encoding="utf-8") as f:
+        info = json.load(f)
+    bufs = {b["id"]: b for b in info["buffers"]}
+    graph = info["graphs"][0]
+    wsize = info["memory_footprint"]["weights"]
+
+    tensors, tidx = [], {}
+
+    def tensor(bid):
+        if bid not in tidx:
+            b = bufs[bid]
+            q = b["intq"]
+            scale = q["scales"][0] if q else 1.0
+            zp = q["offsets"][0] if q else 0
+            tidx[bid] = len(tensors)
+            tensors.append((b["name"].replace("_output_array", ""), FMT[b["format"]], *hwc(b), scale, zp))
+        return tidx[bid]
+
+    def param(bid, nbytes):
+        b = bufs[bid]
+        if b["mpool_id"] != 1 or b["offset_start"] + b["size_bytes"] > wsize or b["size_bytes"] != nbytes:
+            sys.exit(f"unexpected weight layout: {b['name']}")
+        return b["offset_start"]
+
+    wscales, nodes, total_macc = [], [], 0
+    for n in graph["nodes"]:
+        a = n["attributes"]
+        desc = n["description"]
+        acts = [i for i in n["inputs"] if not bufs[i]["is_param"]]
+        ins = [tensor(i) for i in acts] + [-1] * (2 - len(acts))
+        out = tensor(n["outputs"][0])
+        node = {"op": None, "name": n["name"], "in": ins, "out": out, "w_off": 0, "b_off": 0,
+                "ws_idx": 0, "ws_n": 0, "k": (1, 1), "s": (1, 1), "pad": (0, 0, 0, 0), "pad_value": 0, "beta": 1.0}
+        total_macc += n["macc"]
+
+        if desc == "Conversion":
+            node["op"] = "REF_OP_DEQUANT" if bufs[n["outputs"][0]]["format"] == "STAI_FORMAT_FLOAT" else "REF_OP_REQUANT"
+        elif desc in ("Conv2D", "Dense"):
+            wb, bb = bufs[n["inputs"][1]], bufs[n["inputs"][2]]
+            q = wb["intq"]
+            if any(q["offsets"]):
+                sys.exit(f"{n['name']}: asymmetric weights not supported")
+            node["ws_idx"], node["ws_n"] = len(wscales), len(q["scales"])
+            wscales.extend(q["scales"])
+            node["w_off"] = param(wb["id"], wb["size_bytes"])
+            node["b_off"] = param(bb["id"], 4 * bb["shape"][0])
+            if desc == "Dense":
+                node["op"] = "REF_OP_DENSE"
+            else:
+                node["op"] = "REF_OP_DWCONV" if a["is_depthwise"] == "True" else "REF_OP_CONV"
+                node["k"] = tuple(nums(a["filter_size"]))
+                node["s"] = tuple(nums(a["stride"]))
+                pt, pb, pl, pr = nums(a["pad"])
+                node["pad"] = (pt, pb, pl, pr)
+        elif desc == "Pad":
+            if a["mode"] != "constant":
+                sys.exit(f"{n['name']}: pad mode {a['mode']} not supported")
+            node["op"] = "REF_OP_PAD"
+            node["pad"] = tuple(nums(a["pad"]))
+            node["pad_value"] = nums(a["value"])[0]
+        elif desc == "Eltwise":
+            if a["operation"] != "add":
+                sys.exit(f"{n['name']}: eltwise {a['operation']} not supported")
+            node["op"] = "REF_OP_ADD"
+        elif desc == "Pool":
+            if a["pool_function"] != "avg":
+                sys.exit(f"{n['name']}: pool {a['pool_function']} not supported")
+            node["op"] = "REF_OP_AVGPOOL"
+            node["k"] = tuple(nums(a["pool_size"]))
+            node["s"] = tuple(nums(a["pool_stride"]))
+            node["pad"] = tuple(nums(a["pool_pad"]))
+        elif desc == "Nonlinearity" and a["nonlinearity"] == "softmax":
+            node["op"] = "REF_OP_SOFTMAX"
+            # params = [beta 乘子, 左移, diff_min]，乘子/左移由 beta*scale*2^26 量化得到
+            mult, shift, _ = nums(a["params"])
+            node["beta"] = mult / 2.0 ** 31 * 2.0 ** shift / 2.0 ** 26 / tensors[ins[0]][5]
+        else:
+            sys.exit(f"{n['name']}: unsupported layer {desc}")
+        nodes.append(node)
+
+    with open(args.out, "w", encoding="utf-8", newline="\n") as f:
+        f.write("/* 由 ai_ref_gen.py 生成，请勿手工修改\n")
+        f.write(f" * 来源: {os.path.basename(info_path)}\n")
+        f.write(f" * 生成时间: {info['environment']['generated_model']['generated_time']}, "
+                f"网络签名 {info['environment']['network_signature']}\n */\n")
+        f.write('#include "ai_ref.h"\n\n')
+        f.write(f"const uint32_t ref_weights_size = {wsize};\n")
+        f.write(f"const uint64_t ref_total_macc = {total_macc};\n")
+        f.write(f"const uint16_t ref_num_tensors = {len(tensors)};\n")
+        f.write(f"const uint16_t ref_num_nodes = {len(nodes)};\n")
+        f.write(f"const uint16_t ref_input_tensor = {tidx[graph['inputs'][0]]};\n")
+        f.write(f"const uint16_t ref_output_tensor = {tidx[graph['outputs'][0]]};\n\n")
+
+        f.write("const RefTensor_t ref_tensors[] = {\n")
+        for name, fmt, h, w, c, scale, zp in tensors:
+            f.write(f'    {{ "{name}", {fmt}, {h}, {w}, {c}, {scale!r}f, {zp} }},\n')
+        f.write("};\n\n")
+
+        f.write("const float ref_wscales[] = {\n")
+        for i in range(0, len(wscales), 4):
+            f.write("    " + " ".join(f"{v!r}f," for v in wscales[i:i + 4]) + "\n")
+        f.write("};\n\n")
+
+        f.write("const RefNode_t ref_nodes[] = {\n")
+        for nd in nodes:
+            f.write(f'    {{ {nd["op"]}, "{nd["name"]}", {{ {nd["in"][0]}, {nd["in"][1]} }}, {nd["out"]}, '
+                    f'{nd["w_off"]}, {nd["b_off"]}, {nd["ws_idx"]}, {nd["ws_n"]}, '
+                    f'{{ {nd["k"][0]}, {nd["k"][1]} }}, {{ {nd["s"][0]}, {nd["s"][1]} }}, '
+                    f'{{ {", ".join(str(p) for p in nd["pad"])} }}, {nd["pad_value"]}, {nd["beta"]!r}f }},\n')
+        f.write("};\n")
+
+    print(f"[OK] {os.path.basename(info_path)}: {len(nodes)} nodes, {len(tensors)} tensors, "
+          f"{len(wscales)} weight scales, {total_macc} MACC -> {args.out}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,446 @@
+/*
+ * vehicle_detector 主机参考推理命令行
+ *
+ * 编译 (x86/ARM 主机 gcc/clang 均可):
+ *   gcc -O2 -std=gnu99 -I../../Middlewares/ST/AI/Inc -I../host_shim -I../../APP/Inc -o ai_ref ai_ref_main.c ai_ref.c ai_ref_graph.c \
+ *       ../../X-CUBE-AI/App/vehicle_detector_data_params.c ../../APP/src/Vision_Roi.c -lm
+ *
+ * 用法:
+ *   ai_ref run FILE...                 推理 96x96 PPM(P6) 或 27648 字节 RGB888 原始文件
+ *   ai_ref golden check GOLDEN [TOL]   用内置合成输入跑一遍，与金标文件逐项比对 (默认容差 1 LSB)
+ *   ai_ref golden record GOLDEN        重新生成金标文件 (仅在确认模型/数值改动符合预期后)
+ *   ai_ref bench [N]                   吞吐基准，默认 200 次
+ *   ai_ref roi LIST [DUMP_DIR]         ROI 裁切回放：LIST 每行 "帧.ppm x y w h [类别]"，同一帧分别用
+ *                                      默认中心裁切与运动框裁切 (与板端 Vision_Roi.c 同一份代码) 推理并对比；
+ *                                      给出类别的帧其 ROI 裁切 top-1 必须等于该类别，否则视为回归
+ *                                      (帧路径相对 LIST 所在目录)
+ * 比对失败时返回非 0，可直接接入 CI:
+ *   ./ai_ref golden check vehicle_detector_golden.txt
+ *   ./ai_ref roi roi_frames/roi_list.txt
+ * 金标为 12 个内置合成输入的 gemm/softmax int8 输出，模型重新生成后需先重跑 ai_ref_gen.py。
+ */
+#include "ai_ref.h"
+#include "Vision_Roi.h"
+#include "app_config.h"   /* ROI 回放参数 (主机经 ../host_shim 包含) */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+extern const uint64_t s_vehicle_detector_weights_array_u64[];
+
+#define GOLDEN_MAX_LINE 512
+
+/* ========================================== */
+/* 1. 输入                                     */
+/* ========================================== */
+
+static const char *const pattern_names[] = {
+    "gray0", "gray128", "gray255", "hgrad", "vgrad", "checker8",
+    "bars", "blob", "noise1", "noise2", "noise3", "noise4",
+};
+#define NUM_PATTERNS (sizeof(pattern_names) / sizeof(pattern_names[0]))
+
+/* 与平台无关的 LCG，保证各主机生成的噪声输入一致 */
+static uint32_t lcg_next(uint32_t *s) {
+    *s = *s * 1664525U + 1013904223U;
+    return *s >> 24;
+}
+
+static void make_pattern(uint32_t idx, uint8_t *img) {
+    static const uint8_t bars[8][3] = {
+        {255, 255, 255}, {255, 255, 0}, {0, 255, 255}, {0, 255, 0},
+        {255, 0, 255}, {255, 0, 0}, {0, 0, 255}, {0, 0, 0},
+    };
+    uint32_t seed = idx * 0x9E3779B9U;
+
+    for (uint32_t y = 0; y < 96; y++) {
+        for (uint32_t x = 0; x < 96; x++) {
+            uint8_t *p = img + (y * 96 + x) * 3;
+            switch (idx) {
+            case 0: p[0] = p[1] = p[2] = 0; break;
+            case 1: p[0] = p[1] = p[2] = 128; break;
+            case 2: p[0] = p[1] = p[2] = 255; break;
+            case 3: p[0] = (uint8_t)(x * 255 / 95); p[1] = (uint8_t)(255 - p[0]); p[2] = 64; break;
+            case 4: p[0] = 64; p[1] = (uint8_t)(y * 255 / 95); p[2] = (uint8_t)(255 - p[1]); break;
+            case 5: p[0] = p[1] = p[2] = (((x / 8) + (y / 8)) & 1) ? 230 : 25; break;
+            case 6: memcpy(p, bars[x / 12], 3); break;
+            case 7: /* 灰色路面上的深色车体 + 浅色车窗 */
+                p[0] = p[1] = p[2] = 110;
+                if (y >= 30 && y < 75 && x >= 18 && x < 78) { p[0] = 40; p[1] = 45; p[2] = 60; }
+                if (y >= 36 && y < 50 && x >= 28 && x < 68) { p[0] = 170; p[1] = 190; p[2] = 200; }
+                break;
+            default:
+                p[0] = (uint8_t)lcg_next(&seed);
+                p[1] = (uint8_t)lcg_next(&seed);
+                p[2] = (uint8_t)lcg_next(&seed);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  读取 96x96 P6 PPM 或 RGB888 原始文件
+ * @retval 0: 成功; -1: 格式不符
+ */
+static int load_image(const char *path, uint8_t *img) {
+    FILE *f = fopen(path, "rb");
+    char magic[3] = {0};
+    int w, h, maxv, ok = -1;
+
+    if (f == NULL) return -1;
+    if (fread(magic, 1, 2, f) == 2 && strcmp(magic, "P6") == 0) {
+        if (fscanf(f, "%d %d %d", &w, &h, &maxv) == 3 && w == 96 && h == 96 && maxv == 255) {
+            fgetc(f);
+            ok = (fread(img, 1, REF_IN_SIZE, f) == REF_IN_SIZE) ? 0 : -1;
+        }
+    } else {
+        fseek(f, 0, SEEK_END);
+        if (ftell(f) == REF_IN_SIZE) {
+            fseek(f, 0, SEEK_SET);
+            ok = (fread(img, 1, REF_IN_SIZE, f) == REF_IN_SIZE) ? 0 : -1;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+/* ========================================== */
+/* 2. 金标比对                                 */
+/* ========================================== */
+
+typedef struct {
+    int top1;
+    int8_t logits[REF_NUM_CLASSES];   // softmax 之前的 int8 输出
+    int8_t probs_q[REF_NUM_CLASSES];  // softmax 的 int8 输出
+} GoldenRow_t;
+
+static int softmax_node(void) {
+    for (uint16_t i = 0; i < ref_num_nodes; i++) {
+        if (ref_nodes[i].op == REF_OP_SOFTMAX) return i;
+    }
+    return -1;
+}
+
+static int infer_row(const uint8_t *img, GoldenRow_t *row) {
+    float probs[REF_NUM_CLASSES];
+    int sm = softmax_node();
+
+    if (sm < 0 || AI_Ref_Run(img, probs) != 0) return -1;
+    memcpy(row->logits, AI_Ref_Tensor(ref_nodes[sm].in[0]), REF_NUM_CLASSES);
+    memcpy(row->probs_q, AI_Ref_Tensor(ref_nodes[sm].out), REF_NUM_CLASSES);
+    row->top1 = 0;
+    for (int i = 1; i < REF_NUM_CLASSES; i++) {
+        if (probs[i] > probs[row->top1]) row->top1 = i;
+    }
+    return 0;
+}
+
+static int golden_record(const char *path) {
+    FILE *f = fopen(path, "w");
+    uint8_t img[REF_IN_SIZE];
+    GoldenRow_t row;
+
+    if (f == NULL) return -1;
+    fprintf(f, "# vehicle_detector golden vectors: name top1 | gemm int8 x%d | softmax int8 x%d\n",
+            REF_NUM_CLASSES, REF_NUM_CLASSES);
+    for (uint32_t p = 0; p < NUM_PATTERNS; p++) {
+        make_pattern(p, img);
+        if (infer_row(img, &row) != 0) {
+            fclose(f);
+            return -1;
+        }
+        fprintf(f, "%s %d |", pattern_names[p], row.top1);
+        for (int i = 0; i < REF_NUM_CLASSES; i++) fprintf(f, " %d", row.logits[i]);
+        fprintf(f, " |");
+        for (int i = 0; i < REF_NUM_CLASSES; i++) fprintf(f, " %d", row.probs_q[i]);
+        fprintf(f, "\n");
+    }
+    fclose(f);
+    printf("[OK] recorded %u vectors to %s\n", (unsigned)NUM_PATTERNS, path);
+    return 0;
+}
+
+static int parse_row(char *line, char *name, GoldenRow_t *row) {
+    char *tok = strtok(line, " \t\r\n");
+    int v;
+
+    if (tok == NULL || tok[0] == '#') return -1;
+    strncpy(name, tok, 31);
+    name[31] = '\0';
+    if ((tok = strtok(NULL, " \t\r\n")) == NULL) return -1;
+    row->top1 = atoi(tok);
+    for (int part = 0; part < 2; part++) {
+        int8_t *dst = part ? row->probs_q : row->logits;
+        if ((tok = strtok(NULL, " \t\r\n")) == NULL || strcmp(tok, "|") != 0) return -1;
+        for (int i = 0; i < REF_NUM_CLASSES; i++) {
+            if ((tok = strtok(NULL, " \t\r\n")) == NULL) return -1;
+            v = atoi(tok);
+            dst[i] = (int8_t)v;
+        }
+    }
+    return 0;
+}
+
+static int golden_check(const char *path, int tol) {
+    FILE *f = fopen(path, "r");
+    char line[GOLDEN_MAX_LINE], name[32];
+    uint8_t img[REF_IN_SIZE];
+    GoldenRow_t want, got;
+    int checked = 0, failed = 0;
+
+    if (f == NULL) {
+        printf("[FAIL] cannot open %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        uint32_t p;
+        int dl = 0, dp = 0;
+
+        if (parse_row(line, name, &want) != 0) continue;
+        for (p = 0; p < NUM_PATTERNS && strcmp(pattern_names[p], name) != 0; p++) {}
+        if (p == NUM_PATTERNS) {
+            printf("[FAIL] %s: unknown vector\n", name);
+            failed++;
+            continue;
+        }
+        make_pattern(p, img);
+        if (infer_row(img, &got) != 0) {
+            fclose(f);
+            return -1;
+        }
+        for (int i = 0; i < REF_NUM_CLASSES; i++) {
+            int d = abs(got.logits[i] - want.logits[i]);
+            if (d > dl) dl = d;
+            d = abs(got.probs_q[i] - want.probs_q[i]);
+            if (d > dp) dp = d;
+        }
+        /* top1 不同时，只有金标里前两名的 logit 差在容差内才算并列 */
+        int tie = abs(want.logits[got.top1] - want.logits[want.top1]) <= tol;
+        int ok = dl <= tol && dp <= tol && (got.top1 == want.top1 || tie);
+        printf("[%s] %-9s top1 %2d/%2d  max|dlogit|=%d max|dprob|=%d\n",
+               ok ? " OK " : "FAIL", name, got.top1, want.top1, dl, dp);
+        checked++;
+        failed += !ok;
+    }
+    fclose(f);
+    printf("%d vectors, %d failed (tol %d LSB)\n", checked, failed, tol);
+    return (checked > 0 && failed == 0) ? 0 : -1;
+}
+
+/* ========================================== */
+/* 3. 推理与基准                               */
+/* ========================================== */
+
+static int cmd_run(int argc, char **argv) {
+    uint8_t img[REF_IN_SIZE];
+    float probs[REF_NUM_CLASSES];
+    int ret = 0;
+
+    for (int a = 0; a < argc; a++) {
+        if (load_image(argv[a], img) != 0 || AI_Ref_Run(img, probs) != 0) {
+            printf("%s: not a 96x96 PPM/RGB888 file\n", argv[a]);
+            ret = -1;
+            continue;
+        }
+        int best = 0;
+        for (int i = 1; i < REF_NUM_CLASSES; i++) {
+            if (probs[i] > probs[best]) best = i;
+        }
+        printf("%s: class %d (%.3f) probs", argv[a], best, probs[best]);
+        for (int i = 0; i < REF_NUM_CLASSES; i++) printf(" %.3f", probs[i]);
+        printf("\n");
+    }
+    return ret;
+}
+
+static int cmd_bench(int runs) {
+    uint8_t img[REF_IN_SIZE];
+    struct timespec t0, t1;
+    double sec;
+
+    make_pattern(8, img);
+    AI_Ref_Run(img, NULL);   // 预热
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < runs; i++) {
+        AI_Ref_Run(img, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    sec = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    printf("%d runs: %.3f ms/inference, %.1f inf/s, %.1f MMACC/s (%llu MACC per inference)\n",
+           runs, sec * 1000.0 / runs, runs / sec, (double)ref_total_macc * runs / sec / 1e6,
+           (unsigned long long)ref_total_macc);
+    return 0;
+}
+
+/* ========================================== */
+/* 4. ROI 裁切回放                             */
+/* ========================================== */
+
+/**
+ * @brief  读取任意尺寸 P6 PPM，转成 OV5640 输出的大端 RGB565
+ * @retval 像素缓冲 (调用者 free)；失败返回 NULL
+ */
+static uint8_t *load_frame565(const char *path, int *w, int *h) {
+    FILE *f = fopen(path, "rb");
+    uint8_t *rgb = NULL, *out = NULL;
+    int maxv;
+
+    if (f == NULL) return NULL;
+    if (fscanf(f, "P6 %d %d %d", w, h, &maxv) == 3 && maxv == 255 && *w > 0 && *h > 0) {
+        size_t n = (size_t)*w * *h;
+        fgetc(f);
+        rgb = malloc(n * 3);
+        out = malloc(n * 2);
+        if (rgb != NULL && out != NULL && fread(rgb, 3, n, f) == n) {
+            for (size_t i = 0; i < n; i++) {
+                uint16_t px = (uint16_t)(((rgb[i * 3] & 0xF8) << 8) | ((rgb[i * 3 + 1] & 0xFC) << 3) | (rgb[i * 3 + 2] >> 3));
+                out[i * 2] = (uint8_t)(px >> 8);
+                out[i * 2 + 1] = (uint8_t)px;
+            }
+        } else {
+            free(out);
+            out = NULL;
+        }
+    }
+    free(rgb);
+    fclose(f);
+    return out;
+}
+
+/* 与板端相同：帧首填 letterbox，再按条带喂入抽样 */
+static void replay_thumb(const uint8_t *frame, int w, int h, const VisionRect_t *sq, uint8_t *thumb) {
+    static uint8_t lut[256];
+    VisionRoiMap_t map;
+
+    for (int i = 0; i < 256; i++) lut[i] = (uint8_t)i;   // 模型输入为 QLinear(1.0, 0)
+    Vision_Roi_Map(sq, (uint16_t)w, (uint16_t)h, &map);
+    Vision_Roi_FillBorder(&map, lut[AI_ROI_FILL], thumb);
+    for (int y0 = 0; y0 < h; y0 += JPEG_STRIP_LINES) {
+        uint16_t lines = (uint16_t)((h - y0 < JPEG_STRIP_LINES) ? h - y0 : JPEG_STRIP_LINES);
+        Vision_Roi_Strip(&map, frame + (size_t)y0 * w * 2, (uint16_t)y0, lines, (uint16_t)w, lut, thumb);
+    }
+}
+
+static void save_ppm(const char *dir, const char *tag, int idx, const uint8_t *thumb) {
+    char path[512];
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%03d_%s.ppm", dir, idx, tag);
+    if ((f = fopen(path, "wb")) == NULL) return;
+    fprintf(f, "P6\n96 96\n255\n");
+    fwrite(thumb, 1, REF_IN_SIZE, f);
+    fclose(f);
+}
+
+static int argmax(const float *p) {
+    int best = 0;
+    for (int i = 1; i < REF_NUM_CLASSES; i++) {
+        if (p[i] > p[best]) best = i;
+    }
+    return best;
+}
+
+static int cmd_roi(const char *list, const char *dump) {
+    FILE *f = fopen(list, "r");
+    char line[GOLDEN_MAX_LINE], name[GOLDEN_MAX_LINE], path[2 * GOLDEN_MAX_LINE];
+    const char *slash = strrchr(list, '/');
+    int dir_len = (slash != NULL) ? (int)(slash - list + 1) : 0;
+    uint8_t full[REF_IN_SIZE], crop[REF_IN_SIZE];
+    float pf[REF_NUM_CLASSES], pc[REF_NUM_CLASSES];
+    int n = 0, labeled = 0, hit_full = 0, hit_crop = 0, agree = 0, errors = 0;
+
+    if (f == NULL) {
+        printf("[FAIL] cannot open %s\n", list);
+        return -1;
+    }
+    printf("%-28s %-19s %-19s %s\n", "frame", "full (cls/p)", "roi (cls/p)", "label");
+    while (fgets(line, sizeof(line), f) != NULL) {
+        int x, y, bw, bh, label = -1, w, h;
+        VisionRect_t box, sq_full, sq_roi;
+        uint8_t *frame;
+
+        if (line[0] == '#' || sscanf(line, "%511s %d %d %d %d %d", name, &x, &y, &bw, &bh, &label) < 5) continue;
+        if (name[0] == '/') snprintf(path, sizeof(path), "%s", name);
+        else snprintf(path, sizeof(path), "%.*s%s", dir_len, list, name);
+        if ((frame = load_frame565(path, &w, &h)) == NULL) {
+            printf("[FAIL] %s: not a P6 PPM\n", path);
+            errors++;
+            continue;
+        }
+        sq_full.x = (int16_t)((w - h) / 2);   // 板端默认：中心正方形
+        sq_full.y = 0;
+        sq_full.w = sq_full.h = (uint16_t)h;
+        box.x = (int16_t)x;
+        box.y = (int16_t)y;
+        box.w = (uint16_t)bw;
+        box.h = (uint16_t)bh;
+        Vision_Roi_Fit(&box, (uint16_t)w, (uint16_t)h, AI_ROI_MARGIN_PCT, AI_ROI_MIN_SIDE, &sq_roi);
+
+        replay_thumb(frame, w, h, &sq_full, full);
+        replay_thumb(frame, w, h, &sq_roi, crop);
+        free(frame);
+        AI_Ref_Run(full, pf);
+        AI_Ref_Run(crop, pc);
+        if (dump != NULL) {
+            save_ppm(dump, "full", n, full);
+            save_ppm(dump, "roi", n, crop);
+        }
+
+        int cf = argmax(pf), cc = argmax(pc);
+        printf("%-28.28s %2d/%.3f           %2d/%.3f           %d  roi=(%d,%d %u)%s\n",
+               name, cf, pf[cf], cc, pc[cc], label, sq_roi.x, sq_roi.y, sq_roi.w,
+               (label >= 0 && cc != label) ? "  [FAIL] roi top-1 != label" : "");
+        n++;
+        agree += (cf == cc);
+        if (label >= 0) {
+            labeled++;
+            hit_full += (cf == label);
+            hit_crop += (cc == label);
+        }
+    }
+    fclose(f);
+    printf("%d frames, full/roi agree %d", n, agree);
+    if (labeled > 0) {
+        printf(", accuracy full %.1f%% roi %.1f%% (%d labeled)", 100.0 * hit_full / labeled,
+               100.0 * hit_crop / labeled, labeled);
+    }
+    printf("\n");
+    return (n > 0 && errors == 0 && hit_crop == labeled) ? 0 : -1;
+}
+
+static void usage(void) {
+    printf("usage: ai_ref run FILE... | golden check GOLDEN [TOL] | golden record GOLDEN | bench [N]\n"
+           "              | roi LIST [DUMP_DIR]\n");
+}
+
+int main(int argc, char **argv) {
+    int ret;
+
+    if (argc < 2) {
+        usage();
+        return 2;
+    }
+    if (AI_Ref_Init((const uint8_t *)s_vehicle_detector_weights_array_u64, ref_weights_size) != 0) {
+        printf("[FAIL] engine init\n");
+        return 1;
+    }
+
+    if (strcmp(argv[1], "run") == 0 && argc >= 3) {
+        ret = cmd_run(argc - 2, argv + 2);
+    } else if (strcmp(argv[1], "golden") == 0 && argc >= 4 && strcmp(argv[2], "check") == 0) {
+        ret = golden_check(argv[3], argc >= 5 ? atoi(argv[4]) : 1);
+    } else if (strcmp(argv[1], "golden") == 0 && argc >= 4 && strcmp(argv[2], "record") == 0) {
+        ret = golden_record(argv[3]);
+    } else if (strcmp(argv[1], "bench") == 0) {
+        ret = cmd_bench(argc >= 3 ? atoi(argv[2]) : 200);
+    } else if (strcmp(argv[1], "roi") == 0 && argc >= 3) {
+        ret = cmd_roi(argv[2], argc >= 4 ? argv[3] : NULL);
+    } else {
+        usage();
+        ret = -1;
+    }
+    AI_Ref_Deinit();
+    return ret == 0 ? 0 : 1;
+}
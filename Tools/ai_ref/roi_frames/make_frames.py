@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+ROI 回放回归集的合成帧生成
+用法: python make_frames.py        (在本目录下重写 frame_*.ppm，内容由固定种子决定)
+说明: 320x192 路面背景 (带噪声与车道线) 上画一个偏离画面中心的车辆轮廓，
+      roi_list.txt 给出各帧的运动框与期望类别 (ai_ref roi 的 ROI 裁切 top-1)。
+      帧很小以便入库；Vision_Roi 的裁切/抽样与分辨率无关，板上 800x480 帧同样适用。
+      修改本脚本或模型重新生成后，先确认结果符合预期，再据 ai_ref roi 的输出更新 roi_list.txt。
+"""
+import os
+import random
+
+W, H = 320, 192
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# (文件名, 车身左上角, 车身宽高, 车身颜色, 种子)
+FRAMES = [
+    ("frame_0.ppm", (12, 70), (110, 56), (200, 30, 30), 1),     # 左侧小车
+    ("frame_1.ppm", (208, 20), (100, 50), (230, 230, 230), 2),  # 右上远处
+    ("frame_2.ppm", (180, 96), (132, 80), (40, 60, 170), 3),    # 右下大车
+    ("frame_3.ppm", (100, 60), (120, 64), (240, 200, 20), 4),   # 居中：两种裁切应一致
+]
+
+
+def put(img, x, y, c):
+    if 0 <= x < W and 0 <= y < H:
+        i = (y * W + x) * 3
+        img[i:i + 3] = bytes(c)
+
+
+def rect(img, x0, y0, w, h, c):
+    for y in range(y0, y0 + h):
+        for x in range(x0, x0 + w):
+            put(img, x, y, c)
+
+
+def disc(img, cx, cy, r, c):
+    for y in range(cy - r, cy + r + 1):
+        for x in range(cx - r, cx + r + 1):
+            if (x - cx) ** 2 + (y - cy) ** 2 <= r * r:
+                put(img, x, y, c)
+
+
+def make(name, pos, size, color, seed):
+    rng = random.Random(seed)
+    img = bytearray(W * H * 3)
+    for y in range(H):
+        for x in range(W):
+            g = 90 + rng.randrange(-12, 13)
+            put(img, x, y, (g, g, g + 4))
+    for x in range(0, W, 40):
+        rect(img, x, H // 2 - 2, 20, 4, (235, 235, 235))     # 车道虚线
+
+    (x0, y0), (w, h) = pos, size
+    rect(img, x0, y0 + h // 3, w, h * 2 // 3 - h // 8, color)          # 车身
+    rect(img, x0 + w // 5, y0, w * 3 // 5, h // 3 + 1, color)          # 驾驶室
+    rect(img, x0 + w // 5 + 4, y0 + 4, w * 3 // 5 - 8, h // 3 - 6, (30, 40, 60))  # 车窗
+    for cx in (x0 + w // 5, x0 + w * 4 // 5):
+        disc(img, cx, y0 + h - h // 8, h // 8 + 2, (15, 15, 15))        # 车轮
+
+    with open(os.path.join(HERE, name), "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (W, H))
+        f.write(img)
+
+
+def main():
+    for fr in FRAMES:
+        make(*fr)
+        print(fr[0])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""
+IVCIS 板上金标验证与推理基准 (板卡需以 AI_VALIDATE_ENABLE=1 编译)
+用法:
+  python ai_validate.py BOARD_IP [--loops 100] [--port 8002]
+                        [--golden ai_ref/vehicle_detector_golden.txt] [--tol 1]
+                        [--inputs FILE ...] [--tflite MODEL.tflite]
+说明:
+  默认输入为 ai_ref 的 12 个内置合成图 (与 Tools/ai_ref/ai_ref_main.c 的 make_pattern 逐字节一致)，
+  参考输出取金标文件中 softmax 的 int8 值 (scale 1/256, zp -128)，与板上 float 输出按 LSB 比较。
+  --inputs   96x96 P6 PPM 或 27648 字节 RGB888 原始文件；无参考时只打印输出与耗时。
+  --tflite   用 .tflite 解释器 (tflite_runtime 或 tensorflow) 计算参考输出，替代金标文件。
+             金标只对应内置权重 (model v0)；板卡报告远程下发的模型 (v!=0) 时必须给出 --tflite，
+             否则拒绝比较并返回非 0。
+  输入像素在板上按模型输入量化参数查表后送入网络 (与相机路径一致)，--tflite 参考按同一公式量化。
+  --tol      允许的最大误差 (LSB)；超出、top1 不一致或多次推理输出不一致时返回非 0。
+  板卡对每个向量循环推理 --loops 次，回传首次 (冷缓存)/最小/平均/最大周期数。
+"""
+import argparse
+import os
+import socket
+import struct
+import sys
+import time
+
+MAGIC_DATA = 0x444C4156   # "VALD"
+MAGIC_RUN = 0x524C4156    # "VALR"
+MAGIC_RES = 0x534C4156    # "VALS"
+CHUNK = 1024
+IN_SIZE = 96 * 96 * 3
+N_CLASSES = 15
+N_CHUNKS = (IN_SIZE + CHUNK - 1) // CHUNK
+RES_FMT = "<IHBBIHBBIIIIII%df" % N_CLASSES       # 与 APP/Inc/AI_Validate.h 的 AiValResult_t 一致
+SOFTMAX_SCALE, SOFTMAX_ZP = 1.0 / 256, -128       # nl_69 (见 Tools/ai_ref/ai_ref_graph.c)
+STATUS = {0: "OK", 1: "MISSING", 2: "BUSY", 3: "FAILED"}
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+PATTERNS = ["gray0", "gray128", "gray255", "hgrad", "vgrad", "checker8",
+            "bars", "blob", "noise1", "noise2", "noise3", "noise4"]
+BARS = [(255, 255, 255), (255, 255, 0), (0, 255, 255), (0, 255, 0),
+        (255, 0, 255), (255, 0, 0), (0, 0, 255), (0, 0, 0)]
+
+
+def make_pattern(idx):
+    """ai_ref_main.c make_pattern 的逐字节移植 (含与平台无关的 LCG)"""
+    img = bytearray(IN_SIZE)
+    seed = (idx * 0x9E3779B9) & 0xFFFFFFFF
+    for y in range(96):
+        for x in range(96):
+            o = (y * 96 + x) * 3
+            if idx == 0:
+                px = (0, 0, 0)
+            elif idx == 1:
+                px = (128, 128, 128)
+            elif idx == 2:
+                px = (255, 255, 255)
+            elif idx == 3:
+                r = x * 255 // 95
+                px = (r, 255 - r, 64)
+            elif idx == 4:
+                g = y * 255 // 95
+                px = (64, g, 255 - g)
+            elif idx == 5:
+                v = 230 if ((x // 8) + (y // 8)) & 1 else 25
+                px = (v, v, v)
+            elif idx == 6:
+                px = BARS[x // 12]
+            elif idx == 7:
+                px = (110, 110, 110)
+                if 30 <= y < 75 and 18 <= x < 78:
+                    px = (40, 45, 60)
+                if 36 <= y < 50 and 28 <= x < 68:
+                    px = (170, 190, 200)
+            else:
+                c = []
+                for _ in range(3):
+                    seed = (seed * 1664525 + 1013904223) & 0xFFFFFFFF
+                    c.append(seed >> 24)
+                px = tuple(c)
+            img[o:o + 3] = bytes(px)
+    return bytes(img)
+
+
+def load_image(path):
+    data = open(path, "rb").read()
+    if data[:2] == b"P6":
+        fields, pos = [], 2
+        while len(fields) < 3:              # 宽 高 最大值，之后恰好一个空白字符
+            while data[pos:pos + 1].isspace():
+                pos += 1
+            end = pos
+            while not data[end:end + 1].isspace():
+                end += 1
+            fields.append(data[pos:end])
+            pos = end
+        if fields != [b"96", b"96", b"255"] or len(data) < pos + 1 + IN_SIZE:
+            sys.exit(f"[ERR] {path}: need a 96x96 8-bit PPM")
+        return data[pos + 1:pos + 1 + IN_SIZE]
+    if len(data) != IN_SIZE:
+        sys.exit(f"[ERR] {path}: expected {IN_SIZE} B raw RGB888")
+    return data
+
+
+def load_golden(path):
+    ref = {}
+    for line in open(path, encoding="utf-8"):
+        if line.startswith("#") or "|" not in line:
+            continue
+        head, _, probs = line.split("|")
+        name = head.split()[0]
+        ref[name] = [(int(q) - SOFTMAX_ZP) * SOFTMAX_SCALE for q in probs.split()]
+    return ref
+
+
+def tflite_runner(path):
+    try:
+        from tflite_runtime.interpreter import Interpreter
+    except ImportError:
+        try:
+            from tensorflow.lite import Interpreter
+        except ImportError:
+            sys.exit("[ERR] --tflite needs tflite_runtime or tensorflow")
+    import numpy as np
+    it = Interpreter(model_path=path)
+    it.allocate_tensors()
+    inp, out = it.get_input_details()[0], it.get_output_details()[0]
+
+    def run(img):
+        x = np.frombuffer(img, dtype=np.uint8).reshape(inp["shape"])
+        scale, zp = inp["quantization"]
+        if scale:   # 与 AI_Model.c model_build_lut 相同: q = round(v / scale) + zp
+            lim = np.iinfo(inp["dtype"])
+            x = np.clip(np.floor(x / scale + 0.5) + zp, lim.min, lim.max)
+        x = x.astype(inp["dtype"])
+        it.set_tensor(inp["index"], x)
+        it.invoke()
+        y = it.get_tensor(out["index"]).reshape(-1).astype(np.float64)
+        scale, zp = out["quantization"]
+        if out["dtype"] != np.float32 and scale:
+            y = (y - zp) * scale
+        return list(y)
+    return run
+
+
+def run_vector(sock, board, vec, img, loops, timeout):
+    """下发一个向量并取回结果；分片丢失时按板卡给出的位图补发"""
+    todo = range(N_CHUNKS)
+    for _ in range(5):
+        for c in todo:
+            sock.sendto(struct.pack("<IHH", MAGIC_DATA, vec, c) + img[c * CHUNK:(c + 1) * CHUNK], board)
+            time.sleep(0.0005)   # 避免一次灌满板卡的接收池
+        sock.sendto(struct.pack("<IHH", MAGIC_RUN, vec, loops), board)
+        sock.settimeout(timeout)
+        while True:
+            try:
+                data, _ = sock.recvfrom(512)
+            except socket.timeout:
+                sys.exit(f"[ERR] vec {vec}: no reply from board")
+            if len(data) == struct.calcsize(RES_FMT):
+                res = struct.unpack(RES_FMT, data)
+                if res[0] == MAGIC_RES and res[1] == vec:
+                    break
+        status, missing = res[2], res[4]
+        if status == 1:
+            todo = [c for c in range(N_CHUNKS) if missing & (1 << c)]
+            continue
+        if status == 2:
+            time.sleep(0.2)
+            todo = []
+            continue
+        return res
+    sys.exit(f"[ERR] vec {vec}: board keeps answering {STATUS.get(status, status)}")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="compare on-target vehicle_detector outputs with reference vectors")
+    ap.add_argument("board")
+    ap.add_argument("--port", type=int, default=8002)
+    ap.add_argument("--loops", type=int, default=100)
+    ap.add_argument("--golden", default=os.path.join(HERE, "ai_ref", "vehicle_detector_golden.txt"))
+    ap.add_argument("--tol", type=float, default=1.0, help="max error in softmax LSB (1/256)")
+    ap.add_argument("--inputs", nargs="*")
+    ap.add_argument("--tflite")
+    args = ap.parse_args()
+
+    if args.inputs:
+        vectors = [(os.path.basename(p), load_image(p)) for p in args.inputs]
+        golden = {}
+    else:
+        vectors = [(n, make_pattern(i)) for i, n in enumerate(PATTERNS)]
+        golden = load_golden(args.golden)
+    reference = tflite_runner(args.tflite) if args.tflite else None
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    board = (args.board, args.port)
+    timeout = 2.0 + args.loops * 0.2
+    worst, lat_us, failures = 0.0, [], 0
+    print(f"{'vector':10} {'top1':>9} {'max err':>10} {'LSB':>6}   {'first/min/avg/max us':>26}  model")
+    for vec, (name, img) in enumerate(vectors):
+        res = run_vector(sock, board, vec, img, args.loops, timeout)
+        status, top1, loops, stable, version, hz = res[2], res[3], res[5], res[6], res[8], res[9]
+        if version != 0 and reference is None and golden:
+            sys.exit(f"[ERR] board runs downloaded model v{version}; the golden file only covers the "
+                     f"builtin weights (v0), pass --tflite with the deployed model")
+        cyc = (res[10], res[11], res[13], res[12])   # 首次/最小/平均/最大
+        out = list(res[14:14 + N_CLASSES])
+        if status != 0:
+            print(f"{name:10} board status {STATUS.get(status, status)}")
+            failures += 1
+            continue
+        us = [c * 1e6 / hz for c in cyc]
+        lat_us.append(us[2])
+        ref = reference(img) if reference else golden.get(name)
+        line = f"{name:10} {top1:>4}"
+        if ref is not None:
+            ref_top1 = max(range(N_CLASSES), key=lambda i: ref[i])
+            err = max(abs(a - b) for a, b in zip(out, ref))
+            lsb = err / SOFTMAX_SCALE
+            worst = max(worst, err)
+            bad = lsb > args.tol + 1e-6 or ref_top1 != top1 or not stable
+            failures += bad
+            line += f"/{ref_top1:<4} {err:10.6f} {lsb:6.2f}"
+        else:
+            bad = not stable
+            failures += bad
+            line += f"{'':5} {'-':>10} {'-':>6}"
+        line += f"   {us[0]:6.0f}/{us[1]:6.0f}/{us[2]:6.0f}/{us[3]:6.0f}  v{version}"
+        if not stable:
+            line += "  (outputs differ between loops)"
+        print(line + ("  <-- FAIL" if bad else ""))
+
+    if lat_us:
+        print(f"[VAL] {len(vectors)} vectors x {loops} loops: max error {worst:.6f} "
+              f"({worst / SOFTMAX_SCALE:.2f} LSB), mean latency {sum(lat_us) / len(lat_us):.0f} us "
+              f"@ {hz / 1e6:.0f} MHz")
+    if failures:
+        sys.exit(f"[VAL] {failures} vector(s) failed")
+    print("[VAL] PASS")
+
+
+if __name__ == "__main__":
+    main()
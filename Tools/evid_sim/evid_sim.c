@@ -0,0 +1,357 @@
+/*
+ * 证据日志主机测试：RAM 模拟日志区，驱动板端同一份 Evidence_Log.c，
+ * 模拟记录任意字节处断电、扇区轮转时断电、上传游标 (ACK) 恢复与环形回收磨损。
+ *
+ * 编译:
+ *   gcc -O2 -std=gnu99 -Wall -I../../APP/Inc -o evid_sim evid_sim.c ../../APP/src/Evidence_Log.c
+ *
+ * 用法:
+ *   evid_sim          跑全部场景，任一场景不符合预期时返回非 0
+ *   evid_sim -v       同时打印每个断电点的结果
+ *
+ * 断电模型：从设定时刻起再编程 N 字节后掉电，正在写的 Flash 字只写入前 N%32 字节
+ * (其余保持擦除态)，之后所有擦写失败直到重新挂载。板上掉电瞬间的 Flash 字还可能出现
+ * ECC 错误，由 HardFault 复位兜底，此处不模拟。
+ * 扇区缩小为 4 KB，格式与板上 128 KB 扇区相同，只是更快触发轮转。
+ */
+#include "Evidence_Log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_SECTOR_SIZE     4096U
+#define SIM_SECTOR_COUNT    4U
+#define SIM_FW_SIZE         32U
+#define SIM_LOG_SIZE        (SIM_SECTOR_SIZE * SIM_SECTOR_COUNT)
+
+/* 与 Evidence_Log.c 的记录格式一致：头 32B + 负载 (32B 补齐) + 提交字 32B */
+#define REC_FOOT(len)       (SIM_FW_SIZE + (((len) + SIM_FW_SIZE - 1U) & ~(SIM_FW_SIZE - 1U)) + SIM_FW_SIZE)
+
+static int verbose = 0;
+
+/* ========================================== */
+/* 1. RAM Flash 后端                           */
+/* ========================================== */
+
+static uint8_t log_mem[SIM_LOG_SIZE];
+static uint8_t word_written[SIM_LOG_SIZE / SIM_FW_SIZE];
+static uint32_t n_double_prog;
+static long power_budget = -1;  /* 掉电前还能编程的字节数，-1 不掉电 */
+static int power_dead = 0;
+
+static int8_t ram_erase(uint32_t sector) {
+    if (power_dead || sector >= SIM_SECTOR_COUNT) return -1;
+    memset(log_mem + sector * SIM_SECTOR_SIZE, 0xFF, SIM_SECTOR_SIZE);
+    memset(word_written + sector * SIM_SECTOR_SIZE / SIM_FW_SIZE, 0, SIM_SECTOR_SIZE / SIM_FW_SIZE);
+    return 0;
+}
+
+static int8_t ram_program(uint32_t offset, const uint8_t *src32) {
+    uint32_t n = SIM_FW_SIZE;
+
+    if (power_dead) return -1;
+    if (offset % SIM_FW_SIZE != 0 || offset + SIM_FW_SIZE > SIM_LOG_SIZE) return -1;
+    /* H7 的 Flash 字只能在擦除后写一次 */
+    if (word_written[offset / SIM_FW_SIZE]) {
+        n_double_prog++;
+        return -1;
+    }
+    if (power_budget >= 0 && power_budget < (long)SIM_FW_SIZE) {
+        n = (uint32_t)power_budget;
+        power_dead = 1;
+    }
+    if (n > 0) {
+        word_written[offset / SIM_FW_SIZE] = 1;
+        memcpy(log_mem + offset, src32, n);
+    }
+    if (power_dead) return -1;
+    if (power_budget >= 0) power_budget -= SIM_FW_SIZE;
+    return 0;
+}
+
+/* CRC-32/MPEG-2：与 STM32 硬件 CRC 单元默认配置 (字节输入) 相同 */
+static uint32_t sw_crc(const uint8_t *p, uint32_t len) {
+    uint32_t c = 0xFFFFFFFFUL;
+    while (len--) {
+        c ^= (uint32_t)(*p++) << 24;
+        for (int k = 0; k < 8; k++) c = (c & 0x80000000UL) ? (c << 1) ^ 0x04C11DB7UL : (c << 1);
+    }
+    return c;
+}
+
+static const EvidFlashOps_t ram_ops = {
+    .base = log_mem,
+    .sector_size = SIM_SECTOR_SIZE,
+    .sector_count = SIM_SECTOR_COUNT,
+    .erase = ram_erase,
+    .program = ram_program,
+    .crc = sw_crc,
+};
+
+/* ========================================== */
+/* 2. 工具                                     */
+/* ========================================== */
+
+static void blank_flash(void) {
+    memset(log_mem, 0xFF, sizeof(log_mem));
+    memset(word_written, 0, sizeof(word_written));
+}
+
+/* 上电：恢复供电并重新挂载 */
+static int8_t power_on(void) {
+    power_budget = -1;
+    power_dead = 0;
+    return Evidence_Log_Mount(&ram_ops);
+}
+
+static uint32_t rec_len(uint32_t frame) {
+    return 1U + (frame * 37U) % 300U;
+}
+
+static int8_t append(uint32_t frame) {
+    static uint8_t buf[512];
+    uint32_t len = rec_len(frame);
+    for (uint32_t i = 0; i < len; i++) buf[i] = (uint8_t)(frame * 7U + i);
+    return Evidence_Log_Append(EVID_REC_RESULT, buf, len, frame);
+}
+
+static int payload_ok(const EvidRecord_t *r) {
+    if (r->len != rec_len(r->frame_id)) return 0;
+    for (uint32_t i = 0; i < r->len; i++) {
+        if (r->pData[i] != (uint8_t)(r->frame_id * 7U + i)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief  像 Net 任务补发一样取出并确认最多 max 条记录
+ * @param  out: 依次收到的 frame_id (可为 NULL)
+ * @retval 收到的条数；负载校验不符返回 -1
+ */
+static int drain(uint32_t *out, int max) {
+    EvidRecord_t r;
+    int n = 0;
+
+    while (n < max && Evidence_Log_PeekUnsent(&r) == 0) {
+        if (!payload_ok(&r)) return -1;
+        if (out != NULL) out[n] = r.frame_id;
+        n++;
+        Evidence_Log_MarkSent(r.seq);
+    }
+    return n;
+}
+
+/* ========================================== */
+/* 3. 场景                                     */
+/* ========================================== */
+
+static int fails = 0;
+
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { printf("  FAIL: %s\n", msg); fails++; } \
+} while (0)
+
+#define CHECK_AT(cond, msg, cut) do { \
+    if (!(cond)) { printf("  FAIL: %s (cut %u)\n", msg, (unsigned)(cut)); fails++; } \
+} while (0)
+
+static uint32_t got[4096];
+
+/**
+ * @brief  追加一条记录时在第 cut 字节处掉电，上电后检查可见性、残缺计数与后续追加
+ */
+static void torn_append_case(uint32_t cut) {
+    const uint32_t frame_x = 100;       /* rec_len = 1 + 3700 % 300 = 101 -> 占 192 B */
+    const uint32_t foot = REC_FOOT(rec_len(frame_x));
+    const uint32_t commit_off = foot - SIM_FW_SIZE;
+    EvidStats_t st;
+    int visible = (cut >= commit_off + 8U);  /* 提交字的 magic 与 seq 都落盘才算提交 */
+    int hdr_ok = (cut >= 28U);               /* 记录头前 28 字节 (含 hdr_crc) 落盘才可按长度跳过 */
+    int n;
+
+    blank_flash();
+    power_on();
+    for (uint32_t f = 1; f <= 3; f++) append(f);
+
+    power_budget = (long)cut;
+    CHECK_AT((append(frame_x) == 0) == (cut >= foot), "append result vs. power cut", cut);
+    CHECK_AT(power_on() == 0, "remount failed", cut);
+    Evidence_Log_GetStats(&st);
+    if (visible || !hdr_ok) {
+        CHECK_AT(st.torn_records == 0, "unexpected torn record", cut);
+    } else {
+        CHECK_AT(st.torn_records == 1, "torn record not detected", cut);
+    }
+    CHECK_AT(st.next_seq == (visible ? 5U : 4U), "next_seq after remount", cut);
+
+    CHECK_AT(append(200) == 0, "append after remount failed", cut);
+    CHECK_AT(power_on() == 0, "second remount failed", cut);
+    n = drain(got, 16);
+    CHECK_AT(n == (visible ? 5 : 4), "record count after remount", cut);
+    if (n >= 4) {
+        CHECK_AT(got[0] == 1 && got[1] == 2 && got[2] == 3, "earlier records lost", cut);
+        CHECK_AT(got[n - 1] == 200, "record appended after remount not readable", cut);
+        if (visible) CHECK_AT(got[3] == frame_x, "committed record not readable", cut);
+    }
+    if (verbose) {
+        printf("    cut %3u: %s, torn %u, next_seq %u\n", cut, visible ? "committed" : "dropped",
+               st.torn_records, st.next_seq);
+    }
+}
+
+/**
+ * @brief  日志写满后轮转回收最旧扇区时掉电
+ * @param  cut: 回收扇区擦除后再编程多少字节掉电；-1 表示擦除前就掉电
+ */
+static void torn_rotate_case(long cut) {
+    const uint32_t per_sector = (SIM_SECTOR_SIZE - SIM_FW_SIZE) / REC_FOOT(rec_len(1));
+    uint32_t total, f = 1;
+    EvidStats_t st;
+    int n, ok = 1;
+
+    /* 同一长度的记录填满全部扇区 (frame_id 取 rec_len 相同的值：1, 301, 601 ...) */
+    blank_flash();
+    power_on();
+    total = per_sector * SIM_SECTOR_COUNT;
+    for (uint32_t i = 0; i < total; i++, f += 300) append(f);
+    Evidence_Log_GetStats(&st);
+    CHECK(st.active_sector == SIM_SECTOR_COUNT - 1, "log not full before rotation");
+
+    if (cut < 0) power_dead = 1;
+    else power_budget = cut;
+    append(f);
+    CHECK(power_on() == 0, "remount after rotation power loss failed");
+    CHECK(append(f + 300) == 0, "append after rotation power loss failed");
+    CHECK(power_on() == 0, "second remount failed");
+
+    n = drain(got, 4096);
+    CHECK(n > 0, "nothing readable after rotation power loss");
+    for (int i = 1; i < n; i++) {
+        if (got[i] <= got[i - 1] || (got[i] != f && got[i] != f + 300 && got[i] != got[i - 1] + 300)) ok = 0;
+    }
+    CHECK(ok, "records out of order or with gaps after rotation power loss");
+    CHECK(n > 0 && got[n - 1] == f + 300, "record appended after remount not readable");
+    /* 无论掉电点在哪，两次追加之后只应回收了最旧的一个扇区 */
+    CHECK(n > 1 && got[0] == 1U + per_sector * 300U, "records beyond the oldest sector lost");
+    if (verbose) printf("    cut %3ld: %d readable, first frame %u\n", cut, n, n > 0 ? got[0] : 0);
+}
+
+/**
+ * @brief  第 EVID_ACK_EVERY 条确认落盘 ACK 时在第 cut 字节处掉电
+ */
+static void torn_ack_case(uint32_t cut) {
+    const uint32_t foot = REC_FOOT(4);
+    int visible = (cut >= foot - SIM_FW_SIZE + 8U);
+    EvidRecord_t r;
+    EvidStats_t st;
+
+    blank_flash();
+    power_on();
+    for (uint32_t f = 1; f <= 20; f++) append(f);
+    drain(NULL, EVID_ACK_EVERY - 1);
+    power_budget = (long)cut;
+    drain(NULL, 1);
+    power_on();
+    Evidence_Log_GetStats(&st);
+    CHECK_AT(st.acked_seq == (visible ? (uint32_t)EVID_ACK_EVERY : 0U), "acked_seq after ACK power loss", cut);
+    CHECK_AT(Evidence_Log_PeekUnsent(&r) == 0 && r.frame_id == st.acked_seq + 1, "resume point", cut);
+}
+
+int main(int argc, char **argv) {
+    EvidRecord_t r;
+    EvidStats_t st;
+    int n;
+
+    if (argc > 1 && strcmp(argv[1], "-v") == 0) verbose = 1;
+
+    printf("[1] format, append, remount and read back\n");
+    blank_flash();
+    CHECK(Evidence_Log_Mount(NULL) != 0, "mount without flash ops accepted");
+    CHECK(power_on() == 0, "format failed");
+    for (uint32_t f = 1; f <= 10; f++) CHECK(append(f) == 0, "append failed");
+    CHECK(power_on() == 0, "remount failed");
+    Evidence_Log_GetStats(&st);
+    CHECK(st.next_seq == 11 && st.acked_seq == 0 && st.torn_records == 0, "state after remount");
+    n = drain(got, 100);
+    CHECK(n == 10 && got[0] == 1 && got[9] == 10, "records after remount");
+
+    printf("[2] power loss at every byte of a record\n");
+    {
+        const uint32_t foot = REC_FOOT(rec_len(100));
+        int f0 = fails;
+        for (uint32_t cut = 0; cut <= foot; cut++) torn_append_case(cut);
+        printf("    %u cut points, %s\n", foot + 1, fails == f0 ? "ok" : "FAILED");
+    }
+
+    printf("[3] power loss while recycling the oldest sector\n");
+    torn_rotate_case(-1);
+    for (long cut = 0; cut <= 64; cut += 4) torn_rotate_case(cut);
+
+    printf("[4] upload cursor (ACK) recovery\n");
+    blank_flash();
+    power_on();
+    for (uint32_t f = 1; f <= 20; f++) append(f);
+    n = drain(got, 10);
+    CHECK(n == 10 && got[9] == 10, "first 10 records");
+    power_on();
+    Evidence_Log_GetStats(&st);
+    CHECK(st.acked_seq == EVID_ACK_EVERY, "acked_seq not restored from the last ACK record");
+    CHECK(Evidence_Log_PeekUnsent(&r) == 0 && r.frame_id == EVID_ACK_EVERY + 1, "resume point after remount");
+    /* 重新挂载后未落盘的确认计数清零：再确认 EVID_ACK_EVERY - 1 条不应落盘 */
+    drain(NULL, 3);
+    power_on();
+    drain(NULL, EVID_ACK_EVERY - 1);
+    Evidence_Log_GetStats(&st);
+    CHECK(st.appended == 0, "ACK written early, pending count survived remount");
+    drain(NULL, 1);
+    Evidence_Log_GetStats(&st);
+    CHECK(st.appended == 1, "ACK not written after EVID_ACK_EVERY confirmations");
+    n = drain(NULL, 100);
+    power_on();
+    Evidence_Log_GetStats(&st);
+    CHECK(Evidence_Log_PeekUnsent(&r) != 0, "records left after full drain and remount");
+    {
+        int f0 = fails;
+        for (uint32_t cut = 0; cut <= REC_FOOT(4); cut++) torn_ack_case(cut);
+        printf("    %u ACK cut points, %s\n", REC_FOOT(4) + 1, fails == f0 ? "ok" : "FAILED");
+    }
+
+    printf("[5] wrap-around with lagging upload and periodic reboots\n");
+    {
+        static uint8_t delivered[20001];
+        uint32_t total = 20000, unique = 0, lost = 0, missing = 0;
+
+        blank_flash();
+        power_on();
+        for (uint32_t f = 1; f <= total; f++) {
+            CHECK(append(f) == 0, "append failed");
+            if (f % 3 == 0) {
+                /* 上传速度约为写入的一半，日志持续被写满回收 */
+                n = drain(got, 1);
+                if (n == 1 && !delivered[got[0]]) { delivered[got[0]] = 1; unique++; }
+                CHECK(n >= 0, "payload CRC mismatch");
+            }
+            if (f % 997 == 0) {
+                Evidence_Log_GetStats(&st);
+                lost += st.lost_unsent;
+                power_on();
+            }
+        }
+        n = drain(got, 4096);
+        for (int i = 0; i < n; i++) {
+            if (!delivered[got[i]]) { delivered[got[i]] = 1; unique++; }
+        }
+        Evidence_Log_GetStats(&st);
+        lost += st.lost_unsent;
+        for (uint32_t f = 1; f <= total; f++) missing += delivered[f] ? 0 : 1;
+        printf("    %u appended, %u delivered, %u reported lost, erase count %u..%u\n",
+               total, unique, lost, st.erase_min, st.erase_max);
+        CHECK(missing <= lost, "records vanished without being counted in lost_unsent");
+        CHECK(st.erase_max - st.erase_min <= 1, "uneven sector wear");
+        CHECK(st.write_errors == 0, "write errors without power loss");
+    }
+
+    CHECK(n_double_prog == 0, "a flash word was programmed twice");
+    printf("%s (%d failures)\n", fails ? "FAILED" : "ALL PASSED", fails);
+    return fails ? 1 : 0;
+}
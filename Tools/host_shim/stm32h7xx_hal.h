@@ -0,0 +1,17 @@
+#ifndef STM32H7XX_HAL_H
+#define STM32H7XX_HAL_H
+
+/*
+ * 主机工具用的 HAL 替身：只为在主机上 #include "app_config.h" 取参数，
+ * 提供 app_config.h 宏展开时用到的常量，其余 HAL 类型/函数一概不提供。
+ * 用法: gcc ... -I../host_shim -I../../APP/Inc
+ */
+#include <stdint.h>
+
+#define FLASH_BANK_1        0x01U
+#define FLASH_BANK_2        0x02U
+#define FLASH_SECTOR_SIZE   0x00020000UL   /* 128 KB */
+
+uint32_t HAL_GetTick(void);   /* 由工具自行实现 */
+
+#endif
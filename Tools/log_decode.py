@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""
+IVCIS 串口日志解码 (固件以 LOG_BINARY=1 编译时使用，文本 printf 原样透传)
+用法:
+  python log_decode.py firmware.elf [--port COM5 --baud 921600] [--file capture.bin] [--ts]
+说明:
+  二进制记录 (APP/Inc/Log.h)：0xA5 | 级别<<4 | 参数个数 | 格式串编号 (2B) | tick (4B) | 参数 (各 4B) | 异或校验
+  格式串编号是 ELF 中 .log_fmt 段 (链接脚本 INFO 段，从地址 1 开始) 内的地址。
+  同步字节后长度、校验或编号任一不符即当作普通文本字节处理。
+  不指定 --port/--file 时从标准输入读取原始字节。
+  --ts   每条二进制记录前加上板卡时间戳 (ms) 与级别。
+"""
+import argparse
+import codecs
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+MAX_ARGS = 8
+LEVELS = {1: "E", 2: "W", 3: "I", 4: "D"}
+SPEC = re.compile(r"%([-+ #0]*)(\d+)?(?:\.(\d+))?(hh|h|ll|l|z|t|j)?([diouxXcp%])")
+
+
+def load_formats(path):
+    """读 ELF (32/64 位，小端) 的 .log_fmt 段，返回 {编号: 格式串}"""
+    data = open(path, "rb").read()
+    if data[:4] != b"\x7fELF" or data[5] != 1:
+        sys.exit(f"[ERR] {path}: not a little-endian ELF")
+    is64 = data[4] == 2
+    if is64:
+        shoff, = struct.unpack_from("<Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+        sh_fmt = "<IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+        sh_fmt = "<IIIIIIIIII"
+    sections = [struct.unpack_from(sh_fmt, data, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    names = data[strtab[4]:strtab[4] + strtab[5]]
+
+    for sh in sections:
+        name = names[sh[0]:names.index(b"\0", sh[0])].decode()
+        if name != ".log_fmt":
+            continue
+        addr, off, size = sh[3], sh[4], sh[5]
+        if addr + size > 0x10000:
+            sys.exit("[ERR] .log_fmt exceeds 64 KB, format ids no longer fit in 16 bits")
+        blob = data[off:off + size]
+        fmts, i = {}, 0
+        while i < size:
+            end = blob.find(b"\0", i)
+            if end < 0:
+                end = size
+            if end > i:
+                fmts[addr + i] = blob[i:end].decode("utf-8", "replace")
+            i = end + 1
+        return fmts
+    sys.exit(f"[ERR] {path}: no .log_fmt section (built with LOG_BINARY=0?)")
+
+
+def c_format(fmt, args):
+    """按 C printf 规则用 32 位参数展开格式串"""
+    it = iter(args)
+
+    def one(m):
+        flags, width, prec, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        v = next(it, 0)
+        if conv in "di":
+            v = v - (1 << 32) if v & 0x80000000 else v
+            conv = "d"
+        elif conv == "u":
+            conv = "d"
+        elif conv == "c":
+            v = chr(v & 0xFF)
+        elif conv == "p":
+            return "0x%08x" % v
+        spec = "%" + flags + (width or "") + ("." + prec if prec and conv != "c" else "") + conv
+        return spec % v
+
+    return SPEC.sub(one, fmt)
+
+
+class Decoder:
+    def __init__(self, fmts, ts):
+        self.fmts = fmts
+        self.ts = ts
+        self.buf = bytearray()
+        self.bad = 0
+        self.text = codecs.getincrementaldecoder("utf-8")("replace")  # 0xA5 也是 UTF-8 后续字节
+
+    def try_record(self):
+        """缓冲以同步字节开头：返回 (消耗字节数, 文本)；数据不够返回 None；不是记录返回 (1, None)"""
+        b = self.buf
+        if len(b) < 2:
+            return None
+        nargs = b[1] & 0x0F
+        if nargs > MAX_ARGS or (b[1] >> 4) not in LEVELS:
+            return 1, None
+        n = 9 + 4 * nargs
+        if len(b) < n:
+            return None
+        sum_ = 0
+        for x in b[1:n - 1]:
+            sum_ ^= x
+        fid, tick = struct.unpack_from("<HI", b, 2)
+        if sum_ != b[n - 1] or fid not in self.fmts:
+            self.bad += 1
+            return 1, None
+        args = struct.unpack_from("<%dI" % nargs, b, 8)
+        text = c_format(self.fmts[fid], args)
+        if self.ts:
+            text = f"{tick / 1000:10.3f} {LEVELS[b[1] >> 4]} " + text
+        return n, text
+
+    def feed(self, data):
+        self.buf += data
+        out = []
+        while self.buf:
+            if self.buf[0] != SYNC:
+                end = self.buf.find(SYNC)
+                end = len(self.buf) if end < 0 else end
+                out.append(self.text.decode(bytes(self.buf[:end])))
+                del self.buf[:end]
+                continue
+            rec = self.try_record()
+            if rec is None:
+                break
+            used, text = rec
+            out.append(text if text is not None else self.text.decode(bytes(self.buf[:1])))
+            del self.buf[:used]
+        return "".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="decode tokenized IVCIS log records mixed with plain text")
+    ap.add_argument("elf")
+    ap.add_argument("--port")
+    ap.add_argument("--baud", type=int, default=921600)
+    ap.add_argument("--file")
+    ap.add_argument("--ts", action="store_true")
+    args = ap.parse_args()
+
+    dec = Decoder(load_formats(args.elf), args.ts)
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("[ERR] --port needs pyserial")
+        src = serial.Serial(args.port, args.baud, timeout=0.1)
+        read = lambda: src.read(4096)
+    else:
+        src = open(args.file, "rb") if args.file else sys.stdin.buffer
+        read = lambda: src.read1(4096) if hasattr(src, "read1") else src.read(4096)
+
+    try:
+        while True:
+            data = read()
+            if not data and not args.port:
+                break
+            sys.stdout.write(dec.feed(data))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    if dec.bad:
+        print(f"\n[LOG] {dec.bad} sync bytes without a valid record", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
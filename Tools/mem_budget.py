@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""
+IVCIS 内存预算检查 (按存储域统计链接结果)
+用法: python mem_budget.py IVCIS_Edge_H753.map [--budget RAM_D1=480K ...] [-v]
+说明: 解析 GNU ld 生成的 map 文件：从 "Memory Configuration" 取各区域起址/长度，
+      再把每个占用地址空间的输出段按 VMA 归入所在区域 (.data 等带加载地址的段同时计入 Flash)，
+      打印各域用量与预算；任一域超出预算或同一区域内两个输出段地址重叠时返回 1。
+      CubeIDE 工程属性 Post-build steps 中调用 (在 Debug/ 或 Release/ 目录下执行):
+          python ../Tools/mem_budget.py ${ProjName}.map
+      链接器只在区域放不下时报错，预算比区域长度小，留出后续功能的增长余量；
+      调整预算改下面的 BUDGETS，或临时用 --budget 覆盖。
+"""
+import argparse
+import re
+import sys
+
+# 各域预算 (字节)；未列出的区域以区域长度为预算
+BUDGETS = {
+    "FLASH":   480 * 1024,   # 程序区 512K (模型权重在 MODEL_A/MODEL_B)
+    "DTCMRAM": 120 * 1024,   # AI 激活区 + 主栈/堆检查段，128K
+    "ITCMRAM": 60 * 1024,    # AI 热点层权重，64K
+    "RAM_D1":  480 * 1024,   # .data/.bss/.rtos_sec/JPEG 与 AI 缓冲，512K
+    "RAM_D2":  272 * 1024,   # ETH 描述符/Rx 池/lwIP 堆/DCMI 条带/JPEG 输出，288K
+    "RAM_D3":  60 * 1024,    # 64K
+}
+
+# 不占目标地址空间的段 (调试信息、INFO 段等)
+NON_ALLOC = re.compile(r"^\.(debug|comment|ARM\.attributes|log_fmt|stab|gnu\.attributes|iplt|igot|rel)")
+
+# 紧跟 AT> FLASH 段的清零段，map 同样给出加载地址，但镜像中并不占 Flash
+NO_LOAD_IMAGE = re.compile(r"^\.(bss|rtos_sec)")
+
+RE_REGION = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+RE_SECTION = re.compile(r"^(\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?)?\s*$")
+RE_WRAPPED = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$")
+
+
+def parse_size(text):
+    m = re.fullmatch(r"(0x[0-9a-fA-F]+|\d+)([KkMm]?)", text.strip())
+    if not m:
+        raise argparse.ArgumentTypeError(f"bad size: {text}")
+    value = int(m.group(1), 0)
+    return value * {"": 1, "k": 1024, "m": 1024 * 1024}[m.group(2).lower()]
+
+
+def parse_map(path):
+    """返回 (regions, sections)：regions = [(name, origin, length)]，sections = [(name, vma, size, lma)]"""
+    regions, sections = [], []
+    with open(path, encoding="utf-8", errors="replace") as f:
+        lines = f.read().splitlines()
+
+    i = 0
+    while i < len(lines) and lines[i].strip() != "Memory Configuration":
+        i += 1
+    if i == len(lines):
+        raise ValueError("no 'Memory Configuration' table, is this a GNU ld map file?")
+    i += 1
+    while i < len(lines) and not lines[i].startswith("Linker script and memory map"):
+        m = RE_REGION.match(lines[i])
+        if m and m.group(1) not in ("Name", "*default*"):
+            regions.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+        i += 1
+
+    # 输出段从第 0 列开始；段名过长时地址与大小折到下一行
+    while i < len(lines):
+        m = RE_SECTION.match(lines[i])
+        i += 1
+        if not m:
+            continue
+        name, vma, size, lma = m.groups()
+        if vma is None:
+            if i >= len(lines):
+                break
+            w = RE_WRAPPED.match(lines[i])
+            if not w:
+                continue
+            vma, size, lma = w.groups()
+            i += 1
+        if NON_ALLOC.match(name):
+            continue
+        size = int(size, 16)
+        if size == 0:
+            continue
+        sections.append((name, int(vma, 16), size, int(lma, 16) if lma else None))
+    return regions, sections
+
+
+def region_of(regions, addr):
+    for name, origin, length in regions:
+        if origin <= addr < origin + length:
+            return name
+    return None
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("map", help="GNU ld map file, e.g. Debug/IVCIS_Edge_H753.map")
+    ap.add_argument("--budget", action="append", default=[], metavar="REGION=SIZE",
+                    help="override a region budget, SIZE like 480K or 0x78000")
+    ap.add_argument("-v", "--verbose", action="store_true", help="list the sections in each region")
+    args = ap.parse_args()
+
+    budgets = dict(BUDGETS)
+    for item in args.budget:
+        name, _, size = item.partition("=")
+        budgets[name] = parse_size(size)
+
+    try:
+        regions, sections = parse_map(args.map)
+    except (OSError, ValueError) as e:
+        print(f"[MEM] {e}", file=sys.stderr)
+        return 2
+
+    used = {name: 0 for name, _, _ in regions}
+    members = {name: [] for name, _, _ in regions}
+    errors = []
+    for name, vma, size, lma in sections:
+        reg = region_of(regions, vma)
+        if reg is None:
+            errors.append(f"{name} at 0x{vma:08x} is outside every memory region")
+            continue
+        used[reg] += size
+        members[reg].append((vma, size, name))
+        if lma is not None and lma != vma and not NO_LOAD_IMAGE.match(name):
+            load_reg = region_of(regions, lma)
+            if load_reg is not None:
+                used[load_reg] += size
+                members[load_reg].append((lma, size, name + " (load)"))
+
+    # 区域内按地址排序后相邻段不应重叠 (例如段内强行指定的绝对地址)
+    for reg, items in members.items():
+        items.sort()
+        for (a0, s0, n0), (a1, _, n1) in zip(items, items[1:]):
+            if a0 + s0 > a1:
+                errors.append(f"{n0} [0x{a0:08x}, 0x{a0 + s0:08x}) overlaps {n1} at 0x{a1:08x} in {reg}")
+
+    print(f"{'Region':<10} {'Used':>10} {'Budget':>10} {'Length':>10}  {'Use/Budget':>10}")
+    for reg, origin, length in regions:
+        budget = budgets.get(reg, length)
+        pct = used[reg] * 100.0 / budget if budget else 0.0
+        flag = ""
+        if used[reg] > budget:
+            flag = "  OVER BUDGET"
+            errors.append(f"{reg} uses {used[reg]} B, budget {budget} B ({used[reg] - budget} B over)")
+        print(f"{reg:<10} {used[reg]:>10} {budget:>10} {length:>10}  {pct:>9.1f}%{flag}")
+        if args.verbose:
+            for addr, size, name in members[reg]:
+                print(f"    0x{addr:08x} {size:>8}  {name}")
+
+    for e in errors:
+        print(f"[MEM] error: {e}", file=sys.stderr)
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+IVCIS MJPEG-over-HTTP 预览压力测试
+用法: python mjpeg_load_test.py BOARD_IP [--clients 3] [--seconds 30] [--port 80]
+功能: 同时打开多个浏览器式连接，逐个解析 multipart 分段，校验每帧 SOI/EOI 与
+      Content-Length，统计每个客户端的帧率与最小帧间隔 (应不低于 HTTP_MIN_INTERVAL_MS)，
+      超过 HTTP_MAX_VIEWERS 的连接应收到 503。
+"""
+import argparse
+import socket
+import threading
+import time
+
+BOUNDARY = b"--ivcisframe"
+
+
+class Client(threading.Thread):
+    def __init__(self, idx, host, port, seconds, slow):
+        super().__init__(daemon=True)
+        self.idx = idx
+        self.host = host
+        self.port = port
+        self.seconds = seconds
+        self.slow = slow
+        self.status = None
+        self.frames = 0
+        self.bytes = 0
+        self.bad = 0
+        self.intervals = []
+        self.error = None
+
+    def read_until(self, sock, buf, token):
+        while token not in buf:
+            chunk = sock.recv(4096)
+            if not chunk:
+                raise ConnectionError("closed by board")
+            buf += chunk
+            if self.slow:
+                time.sleep(0.05)  # 模拟慢速观看者
+        head, _, rest = buf.partition(token)
+        return head, rest
+
+    def read_exact(self, sock, buf, n):
+        while len(buf) < n:
+            chunk = sock.recv(65536)
+            if not chunk:
+                raise ConnectionError("closed by board")
+            buf += chunk
+        return buf[:n], buf[n:]
+
+    def run(self):
+        try:
+            sock = socket.create_connection((self.host, self.port), timeout=5)
+            sock.sendall(b"GET /stream HTTP/1.1\r\nHost: ivcis\r\n\r\n")
+            head, buf = self.read_until(sock, b"", b"\r\n\r\n")
+            self.status = head.split(b"\r\n", 1)[0].decode(errors="replace")
+            if b" 200 " not in head.split(b"\r\n", 1)[0]:
+                return
+            end = time.time() + self.seconds
+            last = None
+            while time.time() < end:
+                part, buf = self.read_until(sock, buf, b"\r\n\r\n")
+                if BOUNDARY not in part:
+                    self.bad += 1
+                    continue
+                length = 0
+                for line in part.split(b"\r\n"):
+                    if line.lower().startswith(b"content-length:"):
+                        length = int(line.split(b":")[1])
+                jpg, buf = self.read_exact(sock, buf, length + 2)
+                now = time.time()
+                if jpg[:2] != b"\xff\xd8" or jpg[length - 2:length] != b"\xff\xd9" or jpg[length:] != b"\r\n":
+                    self.bad += 1
+                self.frames += 1
+                self.bytes += length
+                if last is not None:
+                    self.intervals.append(now - last)
+                last = now
+            sock.close()
+        except Exception as e:  # noqa: BLE001
+            self.error = str(e)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="IVCIS MJPEG preview load test")
+    ap.add_argument("host")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--clients", type=int, default=3)
+    ap.add_argument("--seconds", type=float, default=30)
+    ap.add_argument("--slow", type=int, default=0, help="其中多少个客户端模拟慢速读取")
+    args = ap.parse_args()
+
+    clients = [Client(i, args.host, args.port, args.seconds, i < args.slow) for i in range(args.clients)]
+    for c in clients:
+        c.start()
+        time.sleep(0.2)
+    for c in clients:
+        c.join(args.seconds + 10)
+
+    for c in clients:
+        fps = c.frames / args.seconds
+        min_gap = min(c.intervals) * 1000 if c.intervals else 0
+        print(f"[client {c.idx}{' slow' if c.slow else ''}] {c.status} frames={c.frames} "
+              f"fps={fps:.2f} kB={c.bytes // 1024} bad={c.bad} min_gap={min_gap:.0f}ms"
+              + (f" error={c.error}" if c.error else ""))
+
+
+if __name__ == "__main__":
+    main()
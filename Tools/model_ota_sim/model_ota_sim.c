@@ -0,0 +1,401 @@
+/*
+ * 模型权重更新主机测试：RAM 模拟 A/B 两个权重区，驱动板端同一份 Model_Bank.c，
+ * 模拟完整更新、传输中断续传、数据损坏、提交前断电、B 区在用时再次更新、证据日志擦除 Bank2，
+ * 以及换了出厂权重的固件烧录后旧 blob 失效。
+ *
+ * 编译:
+ *   gcc -O2 -std=gnu99 -Wall -I../../APP/Inc -o model_ota_sim model_ota_sim.c ../../APP/src/Model_Bank.c
+ *
+ * 用法:
+ *   model_ota_sim          跑全部场景，任一场景不符合预期时返回非 0
+ *   model_ota_sim -v       同时打印每次中断/续传
+ *
+ * 板上 A 区 (出厂权重) 与程序同在 Bank1，B 区与证据日志在 Bank2。RAM 后端检查:
+ *   - A 区从不被擦写 (板上擦写 Bank1 会挂起取指与中断)；
+ *   - 擦除 B 区/证据日志时没有读者持有 B 区，擦除期间 ReadBegin 只交出 A 区 (板上读 B 区会挂起总线)；
+ *   - ReadBegin 从不返回 NULL，即更新与日志轮换期间推理一帧不跳，只是临时改用出厂权重
+ *     (板上见 "[MODEL] ... inferences fell back to the built-in weights" 与 "[AI] ... built-in fallbacks=")。
+ * 擦除是异步的：RAM 后端在 erase_start 后若干次 erase_poll 才完成，其间每个节拍 AI 任务都取一次权重。
+ * 更新耗时按下面的 Flash 典型时间与链路速率估算，板上实测见 "[MODEL] ... committed in N ms"。
+ */
+#include "Model_Bank.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 与 app_config.h / 生成代码保持一致 */
+#define SIM_SECTOR_SIZE     (128U * 1024U)
+#define SIM_SLOT_SIZE       (4U * SIM_SECTOR_SIZE)
+#define SIM_WEIGHTS_SIZE    (53684U * 8U)    /* s_vehicle_detector_weights_array_u64 */
+#define SIM_NET_SIG         0x5EED1234UL    /* 网络结构签名 */
+#define SIM_ERASE_POLLS     3U              /* 每次擦除在完成前返回忙的 poll 次数 */
+
+/* 估算用：H7 扇区擦除、Flash 字编程典型时间，100M 以太网有效吞吐 */
+#define SIM_T_ERASE_MS      1000U
+#define SIM_T_PROG_US       16U
+#define SIM_LINK_KBPS       (6U * 1024U)
+
+static int verbose = 0;
+
+/* ========================================== */
+/* 1. RAM Flash 后端                           */
+/* ========================================== */
+
+static uint8_t slot_mem[MODEL_SLOTS][SIM_SLOT_SIZE];
+static uint8_t word_written[MODEL_SLOTS][SIM_SLOT_SIZE / MODEL_FW_SIZE];
+static uint32_t n_erase, n_prog, n_builtin_hits, n_double_prog, n_read_in_erase, n_skips, n_reads;
+static uint32_t erase_busy;     /* >0: 擦除进行中，剩余忙的 poll 次数 */
+static uint8_t erase_slot;
+static uint32_t erase_sector;
+static uint8_t reading_b;       /* AI 任务持有 B 区 (ReadBegin 交出 B 区到 ReadEnd 之间) */
+static uint8_t evid_erasing;    /* 证据日志正在擦除 Bank2 */
+
+static int8_t ram_erase_start(uint8_t slot, uint32_t sector) {
+    if (slot == MODEL_SLOT_BUILTIN) n_builtin_hits++;
+    if (reading_b) n_read_in_erase++;
+    if (erase_busy != 0 || sector >= SIM_SLOT_SIZE / SIM_SECTOR_SIZE) return -1;
+    erase_slot = slot;
+    erase_sector = sector;
+    erase_busy = SIM_ERASE_POLLS + 1U;
+    n_erase++;
+    return 0;
+}
+
+static int8_t ram_erase_poll(void) {
+    if (erase_busy == 0) return -1;
+    if (--erase_busy != 0) return 1;
+    memset(slot_mem[erase_slot] + erase_sector * SIM_SECTOR_SIZE, 0xFF, SIM_SECTOR_SIZE);
+    memset(word_written[erase_slot] + erase_sector * SIM_SECTOR_SIZE / MODEL_FW_SIZE, 0,
+           SIM_SECTOR_SIZE / MODEL_FW_SIZE);
+    return 0;
+}
+
+static int8_t ram_program(uint8_t slot, uint32_t offset, const uint8_t *src32) {
+    if (slot == MODEL_SLOT_BUILTIN) n_builtin_hits++;
+    if (offset % MODEL_FW_SIZE != 0 || offset + MODEL_FW_SIZE > SIM_SLOT_SIZE) return -1;
+    /* H7 的 Flash 字只能在擦除后写一次 */
+    if (word_written[slot][offset / MODEL_FW_SIZE]) {
+        n_double_prog++;
+        return -1;
+    }
+    word_written[slot][offset / MODEL_FW_SIZE] = 1;
+    memcpy(slot_mem[slot] + offset, src32, MODEL_FW_SIZE);
+    n_prog++;
+    return 0;
+}
+
+/* CRC-32/MPEG-2：与 STM32 硬件 CRC 单元默认配置 (字节输入) 相同 */
+static uint32_t sw_crc(const uint8_t *p, uint32_t len) {
+    uint32_t c = 0xFFFFFFFFUL;
+    while (len--) {
+        c ^= (uint32_t)(*p++) << 24;
+        for (int k = 0; k < 8; k++) c = (c & 0x80000000UL) ? (c << 1) ^ 0x04C11DB7UL : (c << 1);
+    }
+    return c;
+}
+
+static const ModelFlashOps_t ram_ops = {
+    .base = { slot_mem[0], slot_mem[1] },
+    .slot_size = SIM_SLOT_SIZE,
+    .sector_size = SIM_SECTOR_SIZE,
+    .erase_start = ram_erase_start,
+    .erase_poll = ram_erase_poll,
+    .program = ram_program,
+    .crc = sw_crc,
+};
+
+/* ========================================== */
+/* 2. 工具                                     */
+/* ========================================== */
+
+static uint8_t builtin_w[SIM_WEIGHTS_SIZE];
+
+/* 出厂镜像：A 区为出厂头 + 链接的权重 (相当于烧录 ELF)；keep_b 为 0 时 B 区为擦除态 (整片擦除后烧录) */
+static void factory_flash(uint32_t seed, int keep_b) {
+    ModelBlobHdr_t *h = (ModelBlobHdr_t *)slot_mem[0];
+    ModelCommit_t *c = (ModelCommit_t *)(slot_mem[0] + MODEL_FW_SIZE);
+
+    memset(slot_mem[0], 0xFF, SIM_SLOT_SIZE);
+    memset(word_written[0], 0, sizeof(word_written[0]));
+    if (!keep_b) {
+        memset(slot_mem[1], 0xFF, SIM_SLOT_SIZE);
+        memset(word_written[1], 0, sizeof(word_written[1]));
+    }
+    srand(seed);
+    for (uint32_t i = 0; i < SIM_WEIGHTS_SIZE; i++) builtin_w[i] = (uint8_t)rand();
+    memset(h, 0, 2 * MODEL_FW_SIZE);
+    h->magic = MODEL_MAGIC;
+    h->size = SIM_WEIGHTS_SIZE;
+    h->flags = MODEL_F_BUILTIN;
+    c->magic = MODEL_COMMIT_MAGIC;
+    memcpy(slot_mem[0] + MODEL_DATA_OFFSET, builtin_w, SIM_WEIGHTS_SIZE);
+}
+
+static const uint8_t *builtin_addr(void) {
+    return slot_mem[0] + MODEL_DATA_OFFSET;
+}
+
+static const uint8_t *slot_b_addr(void) {
+    return slot_mem[1] + MODEL_DATA_OFFSET;
+}
+
+/* 与 Model_Bank 相同的算法：CRC(网络结构签名 LE32 + 出厂权重 CRC LE32)，下发方 model_push.py 亦同 */
+static uint32_t bank_sig(void) {
+    uint32_t key[2] = { SIM_NET_SIG, sw_crc(builtin_w, SIM_WEIGHTS_SIZE) };
+    return sw_crc((const uint8_t *)key, sizeof(key));
+}
+
+static int8_t mount(void) {
+    return Model_Bank_Mount(&ram_ops, SIM_NET_SIG, builtin_addr(), SIM_WEIGHTS_SIZE);
+}
+
+static void make_blob(uint8_t *w, uint32_t seed, uint32_t version, uint32_t sig, ModelBlobHdr_t *h) {
+    srand(seed);
+    for (uint32_t i = 0; i < SIM_WEIGHTS_SIZE; i++) w[i] = (uint8_t)rand();
+    memset(h, 0, sizeof(*h));
+    h->magic = MODEL_MAGIC;
+    h->version = version;
+    h->size = SIM_WEIGHTS_SIZE;
+    h->crc = sw_crc(w, SIM_WEIGHTS_SIZE);
+    h->signature = sig;
+    h->hdr_crc = sw_crc((const uint8_t *)h, 28);
+}
+
+/* AI 任务：取本次推理的权重 (与 ai_run_frame 相同)，拿到 B 区时记为持有读者 */
+static const uint8_t *ai_read(uint32_t *version) {
+    const uint8_t *w = Model_Bank_ReadBegin(version);
+
+    n_reads++;
+    if (w == NULL) n_skips++;
+    if (w == slot_b_addr()) {
+        if (erase_busy != 0 || evid_erasing) n_read_in_erase++;
+        reading_b = 1;
+    }
+    return w;
+}
+
+static void ai_done(void) {
+    reading_b = 0;
+    Model_Bank_ReadEnd();
+}
+
+/* Net 任务：等擦除完成；期间每个节拍 AI 任务都推理一次 */
+static int8_t drain_erase(void) {
+    int8_t r;
+
+    while ((r = Model_Bank_Poll()) == 1) {
+        ai_read(NULL);
+        ai_done();
+    }
+    return r;
+}
+
+/**
+ * @brief  模拟一次 (可能多次中断的) 传输，行为与 Model_Ota 接收端一致
+ * @param  cuts: 各次连接在发送多少字节后断开 (相对本次连接起点)，0 结束
+ * @param  corrupt_at: 发送过程中把该偏移处的字节翻转 (模拟未被发现的链路错误)，-1 不损坏
+ * @param  chunk: 每次交给 Model_Bank_Write 的长度 (TCP 段)
+ * @retval Model_Bank_Finish 的结果；中途 Begin/Write 失败返回 -2
+ */
+static int transfer(const uint8_t *w, const ModelBlobHdr_t *h, const uint32_t *cuts, long corrupt_at,
+                    uint32_t chunk, uint32_t *sent_total, uint32_t *connections, int finish) {
+    uint32_t resume = 0, sent = 0;
+    static uint8_t buf[4096];
+
+    *sent_total = 0;
+    *connections = 0;
+    for (;;) {
+        uint32_t limit = (cuts != NULL && *cuts != 0) ? *cuts++ : 0xFFFFFFFFUL;
+        if (Model_Bank_Begin(h, &resume) != 0) return -2;
+        (*connections)++;
+        if (verbose) printf("    connect #%u: resume at %u\n", *connections, resume);
+        sent = 0;
+        for (uint32_t off = resume; off < h->size && sent < limit;) {
+            uint32_t n = chunk, used;
+            if (n > h->size - off) n = h->size - off;
+            if (n > limit - sent) n = limit - sent;
+            memcpy(buf, w + off, n);
+            if (corrupt_at >= (long)off && corrupt_at < (long)(off + n)) buf[corrupt_at - off] ^= 0x5A;
+            int8_t r = Model_Bank_Write(buf, n, &used);
+            off += used;
+            sent += used;
+            *sent_total += used;
+            if (r < 0) return -2;
+            if (r == 0 && used < n && drain_erase() != 0) return -2;   /* 遇到未擦除扇区，剩余数据擦完再写 */
+            if (r == 1) {
+                if (verbose) printf("    complete after %u B on the wire\n", *sent_total);
+                return finish ? Model_Bank_Finish() : 0;
+            }
+        }
+        if (verbose) printf("    link dropped after %u B\n", sent);
+    }
+}
+
+static void estimate(const char *what, uint32_t bytes, uint32_t erases, uint32_t progs) {
+    uint32_t link_ms = bytes / SIM_LINK_KBPS;
+    uint32_t flash_ms = erases * SIM_T_ERASE_MS + progs * SIM_T_PROG_US / 1000U;
+    printf("    %s: %u B on the wire, %u erases, %u words -> est. %u ms (link %u ms, flash %u ms)\n",
+           what, bytes, erases, progs, link_ms > flash_ms ? link_ms : flash_ms, link_ms, flash_ms);
+}
+
+/* ========================================== */
+/* 3. 场景                                     */
+/* ========================================== */
+
+static int fails = 0;
+
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { printf("  FAIL: %s\n", msg); fails++; } \
+} while (0)
+
+static uint8_t w1[SIM_WEIGHTS_SIZE], w2[SIM_WEIGHTS_SIZE], w3[SIM_WEIGHTS_SIZE];
+
+int main(int argc, char **argv) {
+    ModelBlobHdr_t h1, h2, h3, hbad;
+    ModelBankStats_t st;
+    uint32_t sent, conns, ver, resume;
+    uint32_t e0, p0, f0;
+    uint32_t used, e1, sig, old_sig;
+    const uint8_t *wp;
+
+    if (argc > 1 && strcmp(argv[1], "-v") == 0) verbose = 1;
+
+    factory_flash(1, 0);
+    sig = bank_sig();
+    make_blob(w1, 11, 2, sig, &h1);
+    make_blob(w2, 22, 3, sig, &h2);
+    make_blob(w3, 33, 4, sig, &h3);
+
+    printf("[1] factory image mounts built-in weights in slot A\n");
+    CHECK(mount() == 0, "mount failed");
+    CHECK(Model_Bank_Signature() == sig, "signature does not cover the built-in weights");
+    wp = ai_read(&ver);
+    ai_done();
+    CHECK(wp == builtin_addr() && ver == 0, "built-in weights not active");
+
+    printf("[2] full update into slot B with 3 interrupted connections\n");
+    {
+        const uint32_t cuts[] = { 50000, 1, 123457, 0 };
+        n_erase = n_prog = 0;
+        CHECK(transfer(w1, &h1, cuts, -1, 1460, &sent, &conns, 1) == 0, "update failed");
+        CHECK(conns == 4, "expected 4 connections");
+        estimate("update", sent, n_erase, n_prog);
+        Model_Bank_GetStats(&st);
+        CHECK(st.resumes == 3 && st.updates == 1, "resume/update count");
+        wp = ai_read(&ver);
+        ai_done();
+        CHECK(wp == slot_b_addr() && ver == 2, "slot B not active after commit");
+        CHECK(memcmp(wp, w1, SIM_WEIGHTS_SIZE) == 0, "slot B content mismatch");
+        CHECK(sent - SIM_WEIGHTS_SIZE < 3 * MODEL_FW_SIZE, "resume resent more than a flash word per cut");
+    }
+
+    printf("[3] reboot keeps the updated slot\n");
+    CHECK(mount() == 0, "remount failed");
+    Model_Bank_GetStats(&st);
+    CHECK(st.active == MODEL_SLOT_OTA && st.generation == 1 && st.version == 2, "slot B gen 1 v2 expected");
+
+    printf("[4] updating slot B while it is active falls back to the built-in weights\n");
+    e0 = n_erase;
+    p0 = n_prog;
+    e1 = n_erase;
+    CHECK(Model_Bank_Begin(&h2, &resume) == 0 && resume == 0, "update refused");
+    wp = ai_read(&ver);                      /* 推理正在读 B 区 */
+    CHECK(wp == slot_b_addr() && ver == 2, "slot B not readable before the first erase");
+    CHECK(Model_Bank_Write(w2, 1460, &used) == 0 && used == 0 && n_erase == e1, "erase started under a reader");
+    ai_done();
+    wp = ai_read(&ver);
+    ai_done();
+    CHECK(wp == builtin_addr() && ver == 0, "new reads still get slot B once it is being rewritten");
+    CHECK(Model_Bank_Write(w2, 1460, &used) == 0 && used == 0 && n_erase == e1 + 1, "erase not started");
+    CHECK(drain_erase() == 0, "erase failed");
+    {
+        const uint32_t cuts[] = { 4096, 300000, 0 };
+        uint32_t s2;
+        CHECK(Model_Bank_Write(w2, 1460, &used) == 0 && used == 1460, "write after the erase");
+        CHECK(transfer(w2, &h2, cuts, -1, 512, &s2, &conns, 1) == 0, "second update failed");
+        estimate("update", s2 + used, n_erase - e0, n_prog - p0);
+    }
+    wp = ai_read(&ver);
+    ai_done();
+    CHECK(wp == slot_b_addr() && ver == 3, "slot B v3 not active after commit");
+    CHECK(memcmp(wp, w2, SIM_WEIGHTS_SIZE) == 0, "slot B content mismatch");
+    CHECK(mount() == 0, "remount after second update");
+    Model_Bank_GetStats(&st);
+    CHECK(st.active == MODEL_SLOT_OTA && st.generation == 2 && st.version == 3, "slot B gen 2 v3 expected");
+
+    printf("[5] corrupted transfer is rejected, built-in weights stay in use\n");
+    CHECK(transfer(w3, &h3, NULL, 200000, 1460, &sent, &conns, 1) == -1, "corrupt blob accepted");
+    Model_Bank_GetStats(&st);
+    CHECK(st.rejected == 1 && st.active == MODEL_SLOT_BUILTIN, "state after reject");
+    wp = ai_read(&ver);
+    ai_done();
+    CHECK(wp == builtin_addr() && ver == 0, "rejected blob readable");
+    CHECK(mount() == 0 && Model_Bank_Weights(&ver) == builtin_addr() && ver == 0,
+          "rejected blob became active after reboot");
+
+    printf("[6] power loss before commit falls back to the built-in weights\n");
+    CHECK(transfer(w3, &h3, NULL, -1, 1460, &sent, &conns, 0) == 0, "transfer failed");
+    CHECK(mount() == 0 && Model_Bank_Weights(&ver) == builtin_addr() && ver == 0,
+          "uncommitted slot became active");
+    CHECK(Model_Bank_Begin(&h3, &resume) == 0 && resume == 0, "session must restart after reboot");
+
+    printf("[7] header checks: signature, size, header CRC\n");
+    hbad = h3;
+    hbad.signature ^= 1;
+    hbad.hdr_crc = sw_crc((const uint8_t *)&hbad, 28);
+    CHECK(Model_Bank_Begin(&hbad, &resume) != 0, "signature mismatch accepted");
+    hbad = h3;
+    hbad.size = SIM_SLOT_SIZE;
+    hbad.hdr_crc = sw_crc((const uint8_t *)&hbad, 28);
+    CHECK(Model_Bank_Begin(&hbad, &resume) != 0, "oversized blob accepted");
+    hbad = h3;
+    hbad.version++;
+    CHECK(Model_Bank_Begin(&hbad, &resume) != 0, "bad header CRC accepted");
+    CHECK(transfer(w3, &h3, NULL, -1, 1460, &sent, &conns, 1) == 0, "third update failed");
+    CHECK(Model_Bank_Weights(&ver) == slot_b_addr() && ver == 4, "slot B v4 not active");
+
+    printf("[8] evidence log erase waits for the reader, inference keeps running on slot A\n");
+    Model_Bank_GetStats(&st);
+    f0 = st.fallback_reads;
+    wp = ai_read(&ver);
+    CHECK(wp == slot_b_addr(), "slot B not readable");
+    CHECK(Model_Bank_EraseBegin() != 0, "evidence erase admitted under a reader");
+    ai_done();
+    wp = ai_read(&ver);
+    ai_done();
+    CHECK(wp == builtin_addr() && ver == 0, "pending evidence erase did not redirect reads to slot A");
+    CHECK(Model_Bank_EraseBegin() == 0, "evidence erase refused without a reader");
+    evid_erasing = 1;
+    for (int k = 0; k < 3; k++) {
+        wp = ai_read(&ver);
+        ai_done();
+        CHECK(wp == builtin_addr(), "slot B read while the evidence log erases Bank2");
+    }
+    evid_erasing = 0;
+    Model_Bank_EraseEnd();
+    wp = ai_read(&ver);
+    ai_done();
+    CHECK(wp == slot_b_addr() && ver == 4, "slot B not restored after the evidence erase");
+    Model_Bank_GetStats(&st);
+    CHECK(st.fallback_reads - f0 == 4U, "fallback reads not counted");
+
+    printf("[9] firmware with different built-in weights invalidates downloaded blobs\n");
+    old_sig = sig;
+    factory_flash(2, 1);        /* 重新烧录 ELF：只重写 A 区，B 区仍是 v4 */
+    sig = bank_sig();
+    CHECK(mount() == 0 && Model_Bank_Weights(&ver) == builtin_addr() && ver == 0,
+          "stale slot B kept after the built-in weights changed");
+    CHECK(Model_Bank_Signature() == sig && sig != old_sig, "signature did not follow the built-in weights");
+    CHECK(Model_Bank_Begin(&h2, &resume) != 0, "blob for the old firmware accepted");
+    make_blob(w2, 44, 5, sig, &h2);
+    CHECK(transfer(w2, &h2, NULL, -1, 1460, &sent, &conns, 1) == 0, "update for the new firmware failed");
+    CHECK(Model_Bank_Weights(&ver) == slot_b_addr() && ver == 5, "slot B v5 not active after reflash");
+
+    printf("    %u weight reads, %u skipped\n", n_reads, n_skips);
+    CHECK(n_builtin_hits == 0, "built-in slot A erased or written");
+    CHECK(n_read_in_erase == 0, "slot B read while Bank2 was erasing");
+    CHECK(n_skips == 0, "inference skipped for lack of readable weights");
+    CHECK(n_double_prog == 0, "a flash word was programmed twice");
+    printf("%s (%d failures)\n", fails ? "FAILED" : "ALL PASSED", fails);
+    return fails ? 1 : 0;
+}
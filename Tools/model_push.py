@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+IVCIS 模型权重远程更新 (写入 B 区，断线续传，无需复位)
+用法:
+  python model_push.py BOARD_IP --version N [--weights FILE] [--port 8001]
+                       [--retries 5] [--drop-after BYTES] [--dump FILE] [--builtin FILE]
+说明:
+  --weights  权重来源：X-CUBE-AI 生成的 *_data_params.c (默认 X-CUBE-AI/App/vehicle_detector_data_params.c)
+             或原始 .bin；必须与板上固件的网络代码 (图结构与量化参数) 配套。
+  --builtin  板上固件链接的出厂权重 (默认即 X-CUBE-AI/App/vehicle_detector_data_params.c，与固件同一次生成)。
+  --drop-after 首次连接发送该字节数后主动断开，用于在实板上验证续传。
+  头格式与 APP/Inc/Model_Bank.h 的 ModelBlobHdr_t 一致，CRC 为 CRC-32/MPEG-2 (STM32 硬件 CRC 默认配置)；
+  签名 = CRC(网络结构签名 LE32 + 出厂权重 CRC LE32)，与 Model_Bank.c 的 Model_Bank_Mount 一致：
+  网络结构签名由 X-CUBE-AI/App 头文件中的模型名与尺寸计算 (Model_Ota.c 的 model_signature)，
+  并入出厂权重后，重新生成的固件不再接受为旧固件准备的权重。板上签名见串口 "[MODEL] slot ... signature 0x..."。
+  板卡串口依次打印 "[MODEL] receiving ..."、"[MODEL] ... committed in N ms"、
+  "[AI] weights switched to vN, inference paused N us"。更新期间 (B 区擦写) 板上推理临时改用出厂权重，
+  串口先打印 "[AI] weights switched to v0"，不跳帧。
+"""
+import argparse
+import os
+import re
+import socket
+import struct
+import sys
+import time
+
+MODEL_MAGIC = 0x314C444D        # "MDL1"
+GEN_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "X-CUBE-AI", "App")
+
+
+def _crc_table():
+    table = []
+    for i in range(256):
+        c = i << 24
+        for _ in range(8):
+            c = ((c << 1) ^ 0x04C11DB7) if c & 0x80000000 else (c << 1)
+        table.append(c & 0xFFFFFFFF)
+    return table
+
+
+CRC_TABLE = _crc_table()
+
+
+def crc_mpeg2(data):
+    c = 0xFFFFFFFF
+    for b in data:
+        c = ((c << 8) & 0xFFFFFFFF) ^ CRC_TABLE[((c >> 24) ^ b) & 0xFF]
+    return c
+
+
+def load_weights(path):
+    if path.endswith(".c"):
+        src = open(path, encoding="utf-8", errors="ignore").read()
+        body = re.search(r"weights_array_u64\[\d+\]\s*=\s*\{(.*?)\};", src, re.S)
+        if body is None:
+            sys.exit(f"[ERR] no weights array in {path}")
+        words = [int(w, 16) for w in re.findall(r"0x([0-9a-fA-F]+)U", body.group(1))]
+        return b"".join(struct.pack("<Q", w) for w in words)
+    return open(path, "rb").read()
+
+
+def model_signature(gen_dir):
+    def macro(fname, name):
+        text = open(os.path.join(gen_dir, fname), encoding="utf-8", errors="ignore").read()
+        m = re.search(r"#define\s+" + name + r"\s+\(?\"?([\w]+)\"?\)?", text)
+        if m is None:
+            sys.exit(f"[ERR] {name} not found in {fname}")
+        return m.group(1)
+
+    sig = "%s:%s:%s:%s" % (macro("vehicle_detector.h", "AI_VEHICLE_DETECTOR_MODEL_NAME"),
+                           macro("vehicle_detector_data_params.h", "AI_VEHICLE_DETECTOR_DATA_WEIGHTS_SIZE"),
+                           macro("vehicle_detector.h", "AI_VEHICLE_DETECTOR_IN_1_SIZE_BYTES"),
+                           macro("vehicle_detector.h", "AI_VEHICLE_DETECTOR_OUT_1_SIZE"))
+    return sig, crc_mpeg2(sig.encode())
+
+
+def bank_signature(net_sig, builtin):
+    return crc_mpeg2(struct.pack("<II", net_sig, crc_mpeg2(builtin)))
+
+
+def build_header(version, weights, signature):
+    head = struct.pack("<7I", MODEL_MAGIC, version, len(weights), crc_mpeg2(weights), signature, 0, 0)
+    return head + struct.pack("<I", crc_mpeg2(head))
+
+
+def read_line(sock):
+    buf = b""
+    while not buf.endswith(b"\n"):
+        chunk = sock.recv(64)
+        if not chunk:
+            raise ConnectionError("closed by board")
+        buf += chunk
+    return buf.decode(errors="replace").strip()
+
+
+def push_once(args, header, weights, drop_after):
+    """一次连接：发头、按板卡给出的偏移续传；返回 True 表示已提交"""
+    with socket.create_connection((args.board, args.port), timeout=15) as sock:
+        sock.sendall(header)
+        reply = read_line(sock)
+        if not reply.startswith("RESUME"):
+            sys.exit(f"[ERR] board refused the update: {reply}")
+        offset = int(reply.split()[1])
+        print(f"  connected, board resumes at {offset}/{len(weights)} B")
+        end = len(weights) if drop_after is None else min(len(weights), offset + drop_after)
+        view = memoryview(weights)
+        for pos in range(offset, end, 4096):
+            sock.sendall(view[pos:min(pos + 4096, end)])
+        if end < len(weights):
+            print(f"  dropping the link after {end - offset} B (resume test)")
+            return False
+        reply = read_line(sock)  # 校验与提交在板上完成后才回复
+        if not reply.startswith("OK"):
+            sys.exit(f"[ERR] board rejected the blob: {reply}")
+        return True
+
+
+def main():
+    ap = argparse.ArgumentParser(description="stream new vehicle_detector weights into the inactive bank")
+    ap.add_argument("board")
+    ap.add_argument("--version", type=int, required=True)
+    ap.add_argument("--weights", default=os.path.join(GEN_DIR, "vehicle_detector_data_params.c"))
+    ap.add_argument("--port", type=int, default=8001)
+    ap.add_argument("--retries", type=int, default=5)
+    ap.add_argument("--drop-after", type=int, default=None)
+    ap.add_argument("--dump", help="also write header + weights to FILE")
+    ap.add_argument("--builtin", default=os.path.join(GEN_DIR, "vehicle_detector_data_params.c"),
+                    help="built-in weights linked into the board firmware")
+    args = ap.parse_args()
+
+    weights = load_weights(args.weights)
+    sig_text, net_sig = model_signature(GEN_DIR)
+    builtin = load_weights(args.builtin)
+    signature = bank_signature(net_sig, builtin)
+    header = build_header(args.version, weights, signature)
+    print(f"[MODEL] v{args.version}: {len(weights)} B, crc 0x{crc_mpeg2(weights):08X}, "
+          f"signature '{sig_text}' + built-in crc 0x{crc_mpeg2(builtin):08X} -> 0x{signature:08X}")
+    if args.dump:
+        with open(args.dump, "wb") as f:
+            f.write(header + weights)
+
+    start = time.time()
+    drop = args.drop_after
+    for attempt in range(args.retries + 1):
+        try:
+            if push_once(args, header, weights, drop):
+                print(f"[OK] v{args.version} committed in {time.time() - start:.2f} s "
+                      f"({attempt} reconnects); board switches weights at the next inference")
+                return
+        except (OSError, ConnectionError) as e:
+            print(f"  link error: {e}, retrying")
+            time.sleep(1)
+        drop = None
+    sys.exit("[ERR] giving up")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+IVCIS 本地策略规则表下发 (热加载，无需重新烧录)
+用法:
+  python policy_push.py BOARD_IP [--version N] [--moto allow|block] [--pickup truck|car]
+                        [--conf 0.85] [--offline degrade|lock] [--rule CLS=ACTION,BILL,ALARM ...]
+                        [--dump FILE] [--key KEY]
+示例:
+  python policy_push.py 192.168.1.10 --version 3 --moto allow --conf 0.9
+  python policy_push.py 192.168.1.10 --rule 14=none,0,0 --rule 2=pass,0x14,0
+说明:
+  规则表格式与 APP/Inc/Policy_Engine.h 的 PolicyTable_t 一致 (小端、按字节打包、CRC-32)，
+  后跟 32 字节 HMAC-SHA256 标签 (密钥与 app_config.h 的 NET_AUTH_KEY 一致，默认取环境变量
+  IVCIS_PSK)，发往板卡 UDP 8000 端口；板卡认证、校验通过后立即生效并保存到备份 SRAM，串口打印
+  "[POLICY] Rule table vN loaded"。之后的识别结果记录中 policy_version 即为新版本号。
+  版本号必须大于板卡当前生效的表 (默认表为 v0)，否则按重放拒绝。
+"""
+import argparse
+import hashlib
+import hmac
+import os
+import socket
+import struct
+import zlib
+
+UDP_LOCAL_PORT = 8000            # app_config.h UDP_LOCAL_PORT
+NUM_CLASSES = 15
+MAGIC = 0x314C4F50               # "POL1"
+DEFAULT_KEY = os.environ.get("IVCIS_PSK", "ivcis-psk-change-me")
+
+ACT = {"none": 0, "pass": 1, "block": 2}
+F_MOTO_ALLOW, F_PICKUP_CAR, F_OFFLINE_LOCK = 0x01, 0x02, 0x04
+
+# 与 Policy_Engine.c 的默认表一致: (动作, 计费车型, 拦截原因)
+DEFAULT_RULES = [
+    ("pass", 0x11, 0), ("pass", 0x11, 0), ("pass", 0x13, 0), ("pass", 0x21, 0),  # 小客车 面包车 大客车 皮卡
+    ("pass", 0x22, 0), ("pass", 0x21, 0), ("pass", 0x24, 0), ("pass", 0x26, 0),  # 厢货 轻货 重货 半挂
+    ("block", 0, 3), ("block", 0, 2), ("block", 0, 2), ("block", 0, 4),          # 摩托 自行车 电动车 三轮
+    ("block", 0, 4), ("block", 0, 1), ("none", 0, 0),                            # 拖拉机 行人 背景
+]
+MOTO_CLASS, PICKUP_CLASS, PICKUP_CAR_BILL = 8, 3, 0x11
+
+
+def build_table(version, flags, conf_pct, rules):
+    body = struct.pack("<IHBBBBBB", MAGIC, version, NUM_CLASSES, flags, conf_pct,
+                       MOTO_CLASS, PICKUP_CLASS, PICKUP_CAR_BILL)
+    for action, bill, alarm in rules:
+        body += struct.pack("<BBBB", ACT[action], bill, alarm, 0)
+    return body + struct.pack("<I", zlib.crc32(body) & 0xFFFFFFFF)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="push a policy rule table to the board")
+    ap.add_argument("board")
+    ap.add_argument("--version", type=int, default=1)
+    ap.add_argument("--moto", choices=["allow", "block"], default="block")
+    ap.add_argument("--pickup", choices=["truck", "car"], default="truck")
+    ap.add_argument("--conf", type=float, default=0.85)
+    ap.add_argument("--offline", choices=["degrade", "lock"], default="degrade")
+    ap.add_argument("--rule", action="append", default=[], help="CLS=ACTION,BILL,ALARM")
+    ap.add_argument("--dump", help="also write the binary table to FILE")
+    ap.add_argument("--key", default=DEFAULT_KEY, help="pre-shared key (NET_AUTH_KEY)")
+    args = ap.parse_args()
+
+    if not 0.5 <= args.conf <= 0.99:
+        ap.error("--conf must be within 0.5 ~ 0.99 (PRD section 4)")
+    rules = list(DEFAULT_RULES)
+    for r in args.rule:
+        cls, spec = r.split("=")
+        action, bill, alarm = spec.split(",")
+        rules[int(cls)] = (action, int(bill, 0), int(alarm, 0))
+
+    flags = ((F_MOTO_ALLOW if args.moto == "allow" else 0) |
+             (F_PICKUP_CAR if args.pickup == "car" else 0) |
+             (F_OFFLINE_LOCK if args.offline == "lock" else 0))
+    table = build_table(args.version, flags, int(round(args.conf * 100)), rules)
+    if args.dump:
+        with open(args.dump, "wb") as f:
+            f.write(table)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    msg = table + hmac.new(args.key.encode(), table, hashlib.sha256).digest()
+    sock.sendto(msg, (args.board, UDP_LOCAL_PORT))
+    print(f"[OK] Sent rule table v{args.version} ({len(msg)} bytes) to {args.board}:{UDP_LOCAL_PORT}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+IVCIS RTP/JPEG (RFC 2435) 参考解包器
+用法: python rtp_jpeg_receiver.py [--port 5004] [--save DIR]
+功能: 接收板端 RTP/JPEG 流，按 RFC 2435 附录 A 重建完整 JPEG 文件，
+      并逐包校验协议字段 (版本/PT/序号连续/分片偏移连续/时间戳/marker)。
+
+标准播放器可直接打开同目录下的 SDP:
+    ffplay -protocol_whitelist file,udp,rtp ivcis_rtp.sdp
+    gst-launch-1.0 udpsrc port=5004 caps="application/x-rtp,media=video,encoding-name=JPEG,clock-rate=90000,payload=26" \\
+        ! rtpjpegdepay ! jpegdec ! autovideosink
+"""
+import argparse
+import os
+import socket
+import struct
+from datetime import datetime
+
+# JPEG 标准 Huffman 表 (ITU T.81 Annex K.3，与 STM32 硬件编码器一致)
+LUM_DC_BITS = [0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0]
+LUM_DC_VALS = list(range(12))
+CHM_DC_BITS = [0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0]
+CHM_DC_VALS = list(range(12))
+LUM_AC_BITS = [0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d]
+LUM_AC_VALS = bytes.fromhex(
+    "01020300041105122131410613516107227114328191a1082342b1c11552d1f0"
+    "2433627282090a161718191a25262728292a3435363738393a43444546474849"
+    "4a535455565758595a636465666768696a737475767778797a838485868788898a"
+    "92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7"
+    "c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9eaf1f2f3f4f5f6f7f8f9fa")
+CHM_AC_BITS = [0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77]
+CHM_AC_VALS = bytes.fromhex(
+    "000102031104052131061241510761711322328108144291a1b1c109233352f0"
+    "156272d10a162434e125f11718191a262728292a35363738393a434445464748"
+    "494a535455565758595a636465666768696a737475767778797a828384858687"
+    "88898a92939495969798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3"
+    "c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae2e3e4e5e6e7e8e9eaf2f3f4f5f6f7f8"
+    "f9fa")
+
+
+def make_dht(tclass, tid, bits, vals):
+    body = bytes([(tclass << 4) | tid]) + bytes(bits) + bytes(vals)
+    return b"\xff\xc4" + struct.pack(">H", len(body) + 2) + body
+
+
+def make_headers(jtype, width8, height8, qtables):
+    """RFC 2435 附录 A MakeHeaders 的 Python 版本"""
+    out = bytearray(b"\xff\xd8")
+    for i, qt in enumerate(qtables):
+        out += b"\xff\xdb" + struct.pack(">HB", 67, i) + qt
+    w, h = width8 * 8, height8 * 8
+    y_samp = 0x21 if jtype == 0 else 0x22
+    out += b"\xff\xc0" + struct.pack(">HBHHB", 17, 8, h, w, 3)
+    out += bytes([1, y_samp, 0, 2, 0x11, 1, 3, 0x11, 1])
+    out += make_dht(0, 0, LUM_DC_BITS, LUM_DC_VALS)
+    out += make_dht(1, 0, LUM_AC_BITS, LUM_AC_VALS)
+    out += make_dht(0, 1, CHM_DC_BITS, CHM_DC_VALS)
+    out += make_dht(1, 1, CHM_AC_BITS, CHM_AC_VALS)
+    out += b"\xff\xda" + struct.pack(">HB", 12, 3)
+    out += bytes([1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0])
+    return bytes(out)
+
+
+class Depacketizer:
+    def __init__(self):
+        self.reset()
+        self.expected_seq = None
+        self.lost = 0
+        self.errors = 0
+        self.frames = 0
+
+    def reset(self):
+        self.ts = None
+        self.scan = bytearray()
+        self.header = None
+
+    def error(self, msg):
+        self.errors += 1
+        print(f"[ERR] {msg}")
+        self.reset()
+
+    def feed(self, pkt):
+        """返回完整 JPEG (bytes) 或 None"""
+        if len(pkt) < 20:
+            return self.error(f"short packet ({len(pkt)} B)")
+        b0, b1, seq, ts, ssrc = struct.unpack(">BBHII", pkt[:12])
+        if b0 >> 6 != 2 or (b1 & 0x7F) != 26:
+            return self.error(f"bad RTP header V={b0 >> 6} PT={b1 & 0x7F}")
+        marker = b1 >> 7
+
+        if self.expected_seq is not None and seq != self.expected_seq:
+            self.lost += (seq - self.expected_seq) & 0xFFFF
+            print(f"[LOSS] expected seq {self.expected_seq}, got {seq}")
+            self.reset()
+        self.expected_seq = (seq + 1) & 0xFFFF
+
+        _, off_hi, off_lo, jtype, q, w8, h8 = struct.unpack(">BBHBBBB", pkt[12:20])
+        offset = (off_hi << 16) | off_lo
+        pos = 20
+        if jtype not in (0, 1):
+            return self.error(f"unsupported type {jtype}")
+
+        if offset == 0:
+            self.reset()
+            self.ts = ts
+            if q < 128:
+                return self.error(f"static Q={q} tables not supported by this tool")
+            mbz, prec, qlen = struct.unpack(">BBH", pkt[pos:pos + 4])
+            pos += 4
+            if prec != 0 or qlen != 128:
+                return self.error(f"bad quant table header prec={prec} len={qlen}")
+            qt = pkt[pos:pos + qlen]
+            pos += qlen
+            self.header = make_headers(jtype, w8, h8, [qt[:64], qt[64:]])
+        elif self.header is None:
+            return None  # 丢了首包，等下一帧
+        else:
+            if ts != self.ts:
+                return self.error(f"timestamp changed inside frame ({self.ts} -> {ts})")
+            if offset != len(self.scan):
+                return self.error(f"fragment offset {offset} != expected {len(self.scan)}")
+
+        self.scan += pkt[pos:]
+        if not marker:
+            return None
+        jpg = self.header + bytes(self.scan) + b"\xff\xd9"
+        self.frames += 1
+        self.reset()
+        return jpg
+
+
+def main():
+    ap = argparse.ArgumentParser(description="IVCIS RTP/JPEG reference depacketizer")
+    ap.add_argument("--port", type=int, default=5004)
+    ap.add_argument("--save", default="./rtp_frames")
+    args = ap.parse_args()
+
+    os.makedirs(args.save, exist_ok=True)
+    rtp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    rtp.bind(("0.0.0.0", args.port))
+    rtcp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    rtcp.bind(("0.0.0.0", args.port + 1))
+    rtcp.setblocking(False)
+    print(f"[RTP Receiver] Listening on :{args.port} (RTCP :{args.port + 1})")
+
+    dep = Depacketizer()
+    while True:
+        pkt, addr = rtp.recvfrom(2048)
+        jpg = dep.feed(pkt)
+        if jpg is not None:
+            name = f"{args.save}/frame_{dep.frames:04d}_{datetime.now().strftime('%H%M%S')}.jpg"
+            with open(name, "wb") as f:
+                f.write(jpg)
+            print(f"[OK] {name} ({len(jpg)} B) lost={dep.lost} err={dep.errors}")
+        try:
+            sr, _ = rtcp.recvfrom(512)
+            if len(sr) >= 28 and sr[1] == 200:
+                ntp_s, ntp_f, rtp_ts, pkts, octets = struct.unpack(">IIIII", sr[8:28])
+                print(f"[RTCP] SR uptime={ntp_s + ntp_f / 2**32:.3f}s rtp_ts={rtp_ts} pkts={pkts} octets={octets}")
+        except BlockingIOError:
+            pass
+
+
+if __name__ == "__main__":
+    main()
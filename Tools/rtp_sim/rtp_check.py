@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+IVCIS RTP/JPEG 分包往返测试
+用法: python rtp_check.py [--sim ./rtp_sim] [JPEG ...]
+说明: 生成一组覆盖分包边界的 JPEG，交给 rtp_sim (板端 Rtp_Jpeg.c 的主机构建，编译方法见 rtp_sim.c)
+      分包并抓包，再用 rtp_jpeg_receiver.py 的 Depacketizer 重组，逐字节比对：
+        [1] 生成的 JPEG 采用与 RFC 2435 附录 A 重建结果相同的文件头，重组结果必须与输入完全一致
+        [2] 发送中途失败：残帧被接收端丢弃，前后帧不受影响
+        [3] 接收端丢包：只丢当前帧，下一帧正常
+        [4] 命令行给出的 JPEG (如板上抓拍)：编码器文件头与重建头不同，只比对量化表与扫描数据
+      任一比对失败返回 1。
+"""
+import argparse
+import os
+import random
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, ".."))
+from rtp_jpeg_receiver import Depacketizer, make_headers  # noqa: E402
+
+
+def config_value(name):
+    """从 APP/Inc/app_config.h 读取整数宏，避免与板端参数手工同步"""
+    with open(os.path.join(HERE, "..", "..", "APP", "Inc", "app_config.h"), encoding="utf-8") as f:
+        m = re.search(rf"^#define\s+{name}\s+(\d+)", f.read(), re.M)
+    if m is None:
+        raise SystemExit(f"{name} not found in app_config.h")
+    return int(m.group(1))
+
+
+RTP_MAX_PAYLOAD = config_value("RTP_MAX_PAYLOAD")
+FIRST_CHUNK = RTP_MAX_PAYLOAD - 4 - 128   # 首包带量化表头与两张表
+
+fails = 0
+
+
+def check(cond, msg):
+    global fails
+    if not cond:
+        fails += 1
+        print(f"  FAIL: {msg}")
+
+
+def make_scan(rng, n):
+    """n 字节熵编码数据：0xFF 后补 0x00，不含标记"""
+    out = bytearray()
+    while len(out) < n:
+        b = rng.randrange(256)
+        if b == 0xFF:
+            if len(out) + 2 > n:
+                continue
+            out += b"\xff\x00"
+        else:
+            out.append(b)
+    return bytes(out)
+
+
+def make_jpeg(rng, jtype, w8, h8, scan_len):
+    qt = [bytes(rng.randrange(1, 256) for _ in range(64)) for _ in range(2)]
+    return make_headers(jtype, w8, h8, qt) + make_scan(rng, scan_len) + b"\xff\xd9"
+
+
+def run_sim(sim, jpegs, workdir, fail_at=None):
+    """写出 JPEG、调用 rtp_sim，返回 (退出码, [(端口, 负载)])"""
+    paths = []
+    for i, jpg in enumerate(jpegs):
+        path = os.path.join(workdir, f"in_{i:03d}.jpg")
+        with open(path, "wb") as f:
+            f.write(jpg)
+        paths.append(path)
+    cap = os.path.join(workdir, "out.rtp")
+    cmd = [sim] + (["-f", str(fail_at)] if fail_at is not None else []) + [cap] + paths
+    res = subprocess.run(cmd, capture_output=True, text=True)
+    if res.returncode != 0:
+        print(res.stdout + res.stderr)
+    pkts = []
+    with open(cap, "rb") as f:
+        data = f.read()
+    pos = 0
+    while pos + 4 <= len(data):
+        port, n = struct.unpack(">HH", data[pos:pos + 4])
+        pkts.append((port, data[pos + 4:pos + 4 + n]))
+        pos += 4 + n
+    return res.returncode, pkts
+
+
+def depacketize(pkts, drop=()):
+    dep = Depacketizer()
+    frames = []
+    for i, (_, pkt) in enumerate(pkts):
+        if i in drop:
+            continue
+        jpg = dep.feed(pkt)
+        if jpg is not None:
+            frames.append(jpg)
+    return dep, frames
+
+
+def scan_of(jpg):
+    """返回 (量化表列表, 扫描数据)，按 Rtp_Jpeg_Parse 的规则切分"""
+    pos, qts = 2, {}
+    while pos + 4 <= len(jpg):
+        marker, seg_len = jpg[pos + 1], struct.unpack(">H", jpg[pos + 2:pos + 4])[0]
+        body = jpg[pos + 4:pos + 2 + seg_len]
+        if marker == 0xDB:
+            for i in range(0, len(body) - 64, 65):
+                qts[body[i] & 0x0F] = body[i + 1:i + 65]
+        elif marker == 0xDA:
+            scan = jpg[pos + 2 + seg_len:]
+            if scan.endswith(b"\xff\xd9"):
+                scan = scan[:-2]
+            return [qts.get(0), qts.get(1, qts.get(0))], scan
+        pos += 2 + seg_len
+    return None, None
+
+
+def main():
+    ap = argparse.ArgumentParser(description="RTP/JPEG packetiser round-trip test")
+    ap.add_argument("--sim", default=os.path.join(HERE, "rtp_sim"),
+                    help="rtp_sim binary (see rtp_sim.c for the build line)")
+    ap.add_argument("jpegs", nargs="*", help="extra JPEG files, e.g. frames captured from the board")
+    args = ap.parse_args()
+
+    rng = random.Random(2435)
+    cases = [
+        (1, 100, 60, 1),                            # 单包
+        (1, 100, 60, FIRST_CHUNK - 1),
+        (1, 100, 60, FIRST_CHUNK),                  # 恰好装满首包
+        (1, 100, 60, FIRST_CHUNK + 1),
+        (0, 100, 60, FIRST_CHUNK + RTP_MAX_PAYLOAD),  # 恰好装满第二包
+        (0, 12, 12, 3 * RTP_MAX_PAYLOAD + 7),
+        (1, 255, 255, 300000),                      # 最大尺寸，约 215 包
+        (1, 100, 60, 45000),                        # 800x480 典型帧
+    ]
+
+    with tempfile.TemporaryDirectory() as work:
+        print("[1] byte-identical round trip")
+        jpegs = [make_jpeg(rng, *c) for c in cases]
+        rc, pkts = run_sim(args.sim, jpegs, work)
+        check(rc == 0, "rtp_sim reported errors")
+        dep, frames = depacketize(pkts)
+        check(len(frames) == len(jpegs), f"{len(frames)} of {len(jpegs)} frames reassembled")
+        for i, (a, b) in enumerate(zip(jpegs, frames)):
+            check(a == b, f"frame {i} ({len(a)} B) differs after reassembly ({len(b)} B)")
+        check(dep.errors == 0 and dep.lost == 0, f"receiver errors {dep.errors}, lost {dep.lost}")
+        print(f"    {len(jpegs)} frames, {len(pkts)} packets")
+
+        print("[2] send failure in the middle of a frame")
+        trio = [make_jpeg(rng, 1, 100, 60, 20000) for _ in range(3)]
+        per_frame = 1 + -(-(20000 - FIRST_CHUNK) // RTP_MAX_PAYLOAD)
+        rc, pkts = run_sim(args.sim, trio, work, fail_at=per_frame + 5)
+        check(rc == 0, "rtp_sim reported errors")
+        dep, frames = depacketize(pkts)
+        check(frames == [trio[0], trio[2]], "frames around the failed one not delivered intact")
+        check(dep.lost == 0, "sequence gap after a failed send")
+
+        print("[3] packet lost on the wire")
+        rc, pkts = run_sim(args.sim, trio, work)
+        dep, frames = depacketize(pkts, drop={per_frame + 3})
+        check(frames == [trio[0], trio[2]], "frames around the lossy one not delivered intact")
+        check(dep.lost == 1, f"receiver counted {dep.lost} lost packets, expected 1")
+
+        if args.jpegs:
+            print("[4] captured JPEGs: quant tables and scan data")
+            inputs = []
+            for path in args.jpegs:
+                with open(path, "rb") as f:
+                    inputs.append(f.read())
+            rc, pkts = run_sim(args.sim, inputs, work)
+            check(rc == 0, "rtp_sim reported errors")
+            dep, frames = depacketize(pkts)
+            check(len(frames) == len(inputs), f"{len(frames)} of {len(inputs)} frames reassembled")
+            for path, a, b in zip(args.jpegs, inputs, frames):
+                qa, sa = scan_of(a)
+                qb, sb = scan_of(b)
+                check(sa is not None and sa == sb, f"{path}: scan data differs")
+                check(qa == qb, f"{path}: quant tables differ")
+
+    print(f"{'FAILED' if fails else 'ALL PASSED'} ({fails} failures)")
+    return 1 if fails else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
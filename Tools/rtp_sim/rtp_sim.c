@@ -0,0 +1,188 @@
+/*
+ * RTP/JPEG 分包主机测试 (发送端)：驱动板端同一份 Rtp_Jpeg.c，udp_sendto 替换为写抓包文件，
+ * 由 rtp_check.py 用 Tools/rtp_jpeg_receiver.py 的解包器重组并逐字节比对。
+ *
+ * 编译:
+ *   gcc -O2 -std=gnu99 -Wall -Istub -I../host_shim -I../../APP/Inc -o rtp_sim rtp_sim.c ../../APP/src/Rtp_Jpeg.c
+ *
+ * 用法:
+ *   rtp_sim [-f N] OUT.rtp IN.jpg...
+ *     依次把每个 JPEG 作为一帧发出 (采集时刻按 25 fps 递增)，抓包写入 OUT.rtp：
+ *     每包 [端口 2B][长度 2B][UDP 负载]，大端。
+ *     -f N  第 N 次 udp_sendto (从 0 计) 返回 ERR_RTE，模拟发送中途失败
+ *   一般直接跑 rtp_check.py，它会生成测试 JPEG 并调用本程序。
+ *
+ * 本程序自身检查：扫描数据以 PBUF_REF 零拷贝引用输入缓冲、单包不超过 RTP_MAX_PAYLOAD、
+ * pbuf 无泄漏、SendFrame 返回值与注入的失败一致；任一不符返回非 0。
+ */
+#include "Rtp_Jpeg.h"
+#include "Net_Client.h"
+#include "cmsis_os.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_MAX_JPEG    (2U * 1024U * 1024U)
+#define SIM_FRAME_MS    40U
+
+NetCtrl_t g_net_ctrl;
+
+static FILE *cap = NULL;
+static const uint8_t *cur_jpg = NULL;
+static uint32_t cur_len = 0;
+static long fail_at = -1;
+static long n_send = 0;
+static long n_pbuf = 0;     /* 未释放的 pbuf 个数 */
+static int fails = 0;
+
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { printf("  FAIL: %s\n", msg); fails++; } \
+} while (0)
+
+/* ========================================== */
+/* 1. 替身实现                                 */
+/* ========================================== */
+
+uint32_t HAL_GetTick(void) {
+    return 0;
+}
+
+osStatus_t osDelay(uint32_t ticks) {
+    (void)ticks;
+    return 0;
+}
+
+struct pbuf *pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type) {
+    struct pbuf *p = calloc(1, sizeof(*p) + (type == PBUF_RAM ? length : 0));
+    (void)layer;
+    if (p == NULL) return NULL;
+    p->payload = (type == PBUF_RAM) ? (void *)(p + 1) : NULL;
+    p->len = p->tot_len = length;
+    p->type = type;
+    n_pbuf++;
+    return p;
+}
+
+u8_t pbuf_free(struct pbuf *p) {
+    u8_t n = 0;
+    while (p != NULL) {
+        struct pbuf *next = p->next;
+        free(p);
+        n_pbuf--;
+        n++;
+        p = next;
+    }
+    return n;
+}
+
+void pbuf_cat(struct pbuf *head, struct pbuf *tail) {
+    struct pbuf *p = head;
+    for (; p->next != NULL; p = p->next) p->tot_len += tail->tot_len;
+    p->tot_len += tail->tot_len;
+    p->next = tail;
+}
+
+struct udp_pcb *udp_new(void) {
+    static struct udp_pcb pcb;
+    return &pcb;
+}
+
+err_t udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port) {
+    (void)ipaddr;
+    pcb->local_port = port;
+    return ERR_OK;
+}
+
+err_t udp_sendto(struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *dst_ip, u16_t dst_port) {
+    uint8_t hdr[4];
+    (void)pcb;
+    (void)dst_ip;
+
+    if (n_send++ == fail_at) return ERR_RTE;
+
+    /* 头为 PBUF_RAM，扫描数据应直接引用编码输出 (零拷贝) */
+    CHECK(p->next != NULL && p->next->type == PBUF_REF, "scan data not sent as PBUF_REF");
+    if (p->next != NULL) {
+        const uint8_t *d = (const uint8_t *)p->next->payload;
+        CHECK(d >= cur_jpg && d + p->next->len <= cur_jpg + cur_len, "PBUF_REF outside the JPEG buffer");
+    }
+    CHECK(p->tot_len <= 12U + 8U + 4U + 128U + RTP_MAX_PAYLOAD, "packet larger than RTP_MAX_PAYLOAD allows");
+
+    hdr[0] = (uint8_t)(dst_port >> 8);
+    hdr[1] = (uint8_t)dst_port;
+    hdr[2] = (uint8_t)(p->tot_len >> 8);
+    hdr[3] = (uint8_t)p->tot_len;
+    fwrite(hdr, 1, 4, cap);
+    for (; p != NULL; p = p->next) fwrite(p->payload, 1, p->len, cap);
+    return ERR_OK;
+}
+
+/* ========================================== */
+/* 2. 主流程                                   */
+/* ========================================== */
+
+static uint8_t *load(const char *path, uint32_t *len) {
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf;
+    size_t n;
+
+    if (f == NULL) return NULL;
+    buf = malloc(SIM_MAX_JPEG);
+    n = (buf != NULL) ? fread(buf, 1, SIM_MAX_JPEG, f) : 0;
+    fclose(f);
+    *len = (uint32_t)n;
+    return buf;
+}
+
+int main(int argc, char **argv) {
+    RtpJpegStats_t st;
+    int argi = 1;
+
+    if (argi + 1 < argc && strcmp(argv[argi], "-f") == 0) {
+        fail_at = atol(argv[argi + 1]);
+        argi += 2;
+    }
+    if (argc - argi < 2) {
+        fprintf(stderr, "usage: %s [-f N] OUT.rtp IN.jpg...\n", argv[0]);
+        return 2;
+    }
+    cap = fopen(argv[argi++], "wb");
+    if (cap == NULL) {
+        perror("open capture");
+        return 2;
+    }
+
+    memset(&g_net_ctrl, 0, sizeof(g_net_ctrl));
+    CHECK(Rtp_Jpeg_Init() == 0, "init failed");
+    {
+        uint8_t dummy[4] = { 0xFF, 0xD8, 0xFF, 0xD9 };
+        CHECK(Rtp_Jpeg_SendFrame(dummy, sizeof(dummy), 0) == -1, "frame sent while the network is down");
+    }
+    g_net_ctrl.state = NET_READY;
+    g_net_ctrl.link_up = 1;
+
+    for (uint32_t i = 0; argi < argc; argi++, i++) {
+        long sends_before = n_send;
+        int8_t r;
+
+        cur_jpg = load(argv[argi], &cur_len);
+        if (cur_jpg == NULL) {
+            fprintf(stderr, "cannot read %s\n", argv[argi]);
+            return 2;
+        }
+        r = Rtp_Jpeg_SendFrame(cur_jpg, cur_len, i * SIM_FRAME_MS);
+        printf("frame %u: %s, %u B -> %ld packets, %s\n", i, argv[argi], cur_len, n_send - sends_before,
+               r == 0 ? "sent" : "failed");
+        CHECK((r != 0) == (fail_at >= sends_before && fail_at < n_send), "SendFrame result vs. injected failure");
+        free((void *)cur_jpg);
+        cur_jpg = NULL;
+    }
+
+    Rtp_Jpeg_GetStats(&st);
+    printf("frames %u, packets %u, octets %u, parse errors %u, send errors %u\n",
+           st.frames, st.packets, st.octets, st.parse_errors, st.send_errors);
+    CHECK(n_pbuf == 0, "pbuf leak");
+    fclose(cap);
+    if (fails) printf("FAILED (%d failures)\n", fails);
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,10 @@
+#ifndef CMSIS_OS_H
+#define CMSIS_OS_H
+
+/* rtp_sim 替身：Rtp_Jpeg.c 只用到 osDelay (分包让出) */
+#include <stdint.h>
+
+typedef int32_t osStatus_t;
+osStatus_t osDelay(uint32_t ticks);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef LWIP_PBUF_H
+#define LWIP_PBUF_H
+
+/* rtp_sim 替身：与 lwIP 2.1 pbuf 字段同名的最小子集，PBUF_REF 只记录外部指针 */
+#include <stdint.h>
+
+typedef uint8_t  u8_t;
+typedef uint16_t u16_t;
+typedef uint32_t u32_t;
+typedef int8_t   err_t;
+
+#define ERR_OK    0
+#define ERR_MEM  -1
+#define ERR_RTE  -4
+
+typedef enum { PBUF_TRANSPORT, PBUF_IP, PBUF_LINK, PBUF_RAW } pbuf_layer;
+typedef enum { PBUF_RAM, PBUF_ROM, PBUF_REF, PBUF_POOL } pbuf_type;
+
+struct pbuf {
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+    pbuf_type type;
+};
+
+struct pbuf *pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type);
+u8_t pbuf_free(struct pbuf *p);
+void pbuf_cat(struct pbuf *head, struct pbuf *tail);
+
+#endif
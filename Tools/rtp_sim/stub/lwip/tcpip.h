@@ -0,0 +1,8 @@
+#ifndef LWIP_TCPIP_H
+#define LWIP_TCPIP_H
+
+/* rtp_sim 替身：单线程，核心锁为空操作 */
+#define LOCK_TCPIP_CORE()
+#define UNLOCK_TCPIP_CORE()
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef LWIP_UDP_H
+#define LWIP_UDP_H
+
+/* rtp_sim 替身：udp_sendto 由 rtp_sim.c 实现，把 pbuf 链展平写入抓包文件 */
+#include "lwip/pbuf.h"
+
+typedef struct { u32_t addr; } ip_addr_t;
+
+struct udp_pcb {
+    u16_t local_port;
+};
+
+#define IP_ADDR_ANY   ((const ip_addr_t *)0)
+
+struct udp_pcb *udp_new(void);
+err_t udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port);
+err_t udp_sendto(struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *dst_ip, u16_t dst_port);
+
+#endif
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""
+IVCIS 订阅上报目标 (HMAC 认证)
+用法:
+  python subscribe.py BOARD_IP [--dest IP] [--key KEY]
+示例:
+  python subscribe.py 192.168.1.10                      # 结果/图像改发到本机
+  python subscribe.py 192.168.1.10 --dest 192.168.1.50  # 改发到指定主机
+说明:
+  板卡默认没有上报目标，识别记录只进断网缓存与证据日志。订阅包格式见 APP/Inc/Net_Client.h:
+  "SUB1" | 计数 (LE32) | 目标 IPv4 (网络序，0 表示发包主机) | HMAC-SHA256 (32 字节)，
+  发往 UDP 8000 端口。密钥与 app_config.h 的 NET_AUTH_KEY 一致 (默认取环境变量 IVCIS_PSK)；
+  计数取 Unix 时间，必须大于板卡上次接受的值，重放的旧包会被拒绝。
+  板卡接受后串口打印 "[NET] New subscriber x.x.x.x"，并补发断网期间缓存的记录。
+"""
+import argparse
+import hashlib
+import hmac
+import os
+import socket
+import struct
+import time
+
+UDP_LOCAL_PORT = 8000            # app_config.h UDP_LOCAL_PORT
+MAGIC = 0x31425553               # "SUB1"
+DEFAULT_KEY = os.environ.get("IVCIS_PSK", "ivcis-psk-change-me")
+
+
+def build_subscribe(counter, dest_ip, key):
+    body = struct.pack("<II", MAGIC, counter) + socket.inet_aton(dest_ip)
+    return body + hmac.new(key.encode(), body, hashlib.sha256).digest()
+
+
+def main():
+    ap = argparse.ArgumentParser(description="subscribe a host to the board's records")
+    ap.add_argument("board")
+    ap.add_argument("--dest", default="0.0.0.0", help="subscriber IP (default: this host)")
+    ap.add_argument("--key", default=DEFAULT_KEY, help="pre-shared key (NET_AUTH_KEY)")
+    args = ap.parse_args()
+
+    pkt = build_subscribe(int(time.time()), args.dest, args.key)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.sendto(pkt, (args.board, UDP_LOCAL_PORT))
+    who = "this host" if args.dest == "0.0.0.0" else args.dest
+    print(f"[OK] Subscribed {who} to {args.board}:{UDP_LOCAL_PORT}")
+
+
+if __name__ == "__main__":
+    main()
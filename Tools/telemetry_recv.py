@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""
+IVCIS 系统遥测接收 (任务 CPU 占用 / 栈水位 / 堆余量)
+用法: python telemetry_recv.py [--port 8081] [--avg N]
+说明: 监听结果端口，只解析以 "TELM" 开头的 TelemRecord_t (APP/Inc/shared_types.h)，
+      识别结果记录忽略。板卡每 SYS_STATS_INTERVAL_MS 发一条。
+  --avg N  收满 N 条后打印 CPU 忙碌率与各任务占用的平均值并退出，用于开关某项功能
+           (如 TRACE_ENABLE 0/1) 前后在同一场景下对比开销。
+"""
+import argparse
+import socket
+import struct
+
+TELEM_MAGIC = 0x4D4C4554
+HDR = struct.Struct("<IIIIHBBII")
+TASK = struct.Struct("<12sHHBB")
+STATES = ["run", "ready", "block", "susp", "del", "inv"]
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--port", type=int, default=8081)
+    ap.add_argument("--avg", type=int, default=0, help="average N records, print the summary and exit")
+    args = ap.parse_args()
+    busy_sum, task_sum, count = 0, {}, 0
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("0.0.0.0", args.port))
+    print(f"[TELEM] Listening on 0.0.0.0:{args.port}")
+
+    while True:
+        data, addr = sock.recvfrom(1500)
+        if len(data) < HDR.size:
+            continue
+        magic, seq, tick, window_us, busy, n, _, heap_free, heap_min = HDR.unpack_from(data)
+        if magic != TELEM_MAGIC or len(data) < HDR.size + n * TASK.size:
+            continue
+        print(f"\n#{seq} t={tick / 1000:.1f}s window {window_us / 1000:.0f} ms  "
+              f"CPU {busy / 10:.1f}%  heap free {heap_free} (min {heap_min})")
+        tasks = [TASK.unpack_from(data, HDR.size + i * TASK.size) for i in range(n)]
+        for name, cpu, stack, prio, state in sorted(tasks, key=lambda t: -t[1]):
+            name = name.split(b"\0")[0].decode(errors="replace")
+            st = STATES[state] if state < len(STATES) else str(state)
+            print(f"  {name:<12} {cpu / 10:5.1f}%  stack free {stack * 4:6d} B  prio {prio:2d}  {st}")
+            task_sum[name] = task_sum.get(name, 0) + cpu
+        busy_sum += busy
+        count += 1
+        if args.avg and count >= args.avg:
+            print(f"\n[TELEM] mean of {count} records: CPU {busy_sum / count / 10:.2f}%")
+            for name, cpu in sorted(task_sum.items(), key=lambda t: -t[1]):
+                print(f"  {name:<12} {cpu / count / 10:6.2f}%")
+            return
+
+
+if __name__ == "__main__":
+    main()
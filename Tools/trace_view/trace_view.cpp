@@ -0,0 +1,370 @@
+/*
+ * 流水线追踪转换：接收板端 Trace 模块 (APP/src/Trace.c) 的 UDP 事件流，
+ * 转成 Chrome trace / Perfetto 可直接打开的 JSON (chrome://tracing 或 ui.perfetto.dev)。
+ *
+ * 编译:
+ *   g++ -O2 -std=c++17 -Wall -o trace_view trace_view.cpp          (Windows 加 -lws2_32)
+ *
+ * 用法:
+ *   trace_view -o trace.json [-p 8003] [-t 10] [-w raw.bin]   监听 UDP，-t 秒后 (或 Ctrl-C) 写出 JSON
+ *   trace_view -o trace.json -r raw.bin                        离线转换 -w 保存的原始数据报
+ *   板端需以 TRACE_ENABLE=1 编译，并先向 UDP_LOCAL_PORT 发包订阅 (与图像流同一上报目标)。
+ *
+ * 轨道：Tasks (每个任务一行，运行区间)、ISR (每个中断一行)、Pipeline (各流水线阶段)、
+ * 计数器 (队列深度)。丢包 (序号不连续) 与板端缓冲满丢弃的事件以全局瞬时事件标出，
+ * 缺口前后未配对的区间直接丢弃，不会画出跨越缺口的假长条。
+ * 结束时在 stderr 打印各中断/阶段的次数、平均与最坏耗时，以及事件率 (估算追踪开销)。
+ */
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+/* ========================================== */
+/* 1. 与板端保持一致 (APP/Inc/Trace.h)          */
+/* ========================================== */
+
+static const uint32_t TRACE_MAGIC = 0x45435254;   /* "TRCE" */
+enum { PKT_EVENTS = 0, PKT_TASKS = 1 };
+enum { EV_TASK_IN = 1, EV_ISR_ENTER, EV_ISR_EXIT, EV_BEGIN, EV_END, EV_COUNTER };
+static const size_t HDR_SIZE = 20;
+static const size_t EV_SIZE = 8;
+static const size_t TASK_SIZE = 18;
+
+static const char *const isr_names[] = { "DCMI DMA", "DCMI", "JPEG", "JPEG MDMA", "ETH", "DMA2D", "USART3", "USART3 TX DMA" };
+static const char *const stage_names[] = { "strip", "jpeg encode", "ai frame", "ai model", "net jpeg", "net result" };
+static const char *const counter_names[] = { "defer queue", "net queue", "net store" };
+
+enum { PID_TASKS = 1, PID_ISR, PID_PIPE, PID_COUNTERS };
+
+template <size_t N>
+static std::string table_name(const char *const (&tab)[N], unsigned id, const char *prefix) {
+    if (id < N) return tab[id];
+    return std::string(prefix) + std::to_string(id);
+}
+
+static uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t rd32(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+/* ========================================== */
+/* 2. 事件流 -> 区间                            */
+/* ========================================== */
+
+struct Slice {
+    int pid;
+    unsigned tid;
+    uint64_t start, end;      /* 周期 (已展开为 64 位) */
+    uint16_t arg;
+};
+
+struct Instant {
+    uint64_t t;
+    std::string name;
+};
+
+struct Counter {
+    unsigned id;
+    uint64_t t;
+    uint16_t value;
+};
+
+struct Summary {
+    uint64_t count = 0, sum = 0, max = 0;
+    void add(uint64_t d) { count++; sum += d; max = std::max(max, d); }
+};
+
+class Converter {
+public:
+    void packet(const uint8_t *p, size_t len) {
+        if (len < HDR_SIZE || rd32(p) != TRACE_MAGIC) return;
+        uint32_t seq = rd32(p + 4);
+        uint32_t dropped = rd32(p + 12);
+        uint16_t kind = rd16(p + 16), count = rd16(p + 18);
+
+        cpu_hz_ = rd32(p + 8);
+        packets_++;
+        if (have_seq_ && seq != last_seq_ + 1) {
+            lost_packets_ += seq - last_seq_ - 1;
+            gap("lost " + std::to_string(seq - last_seq_ - 1) + " packets");
+        }
+        have_seq_ = true;
+        last_seq_ = seq;
+        if (dropped != last_dropped_) {
+            gap("board dropped " + std::to_string(dropped - last_dropped_) + " events");
+            last_dropped_ = dropped;
+        }
+
+        const uint8_t *body = p + HDR_SIZE;
+        if (kind == PKT_TASKS && len >= HDR_SIZE + count * TASK_SIZE) {
+            for (unsigned i = 0; i < count; i++) {
+                const uint8_t *t = body + i * TASK_SIZE;
+                task_names_[rd16(t)] = std::string((const char *)t + 2, strnlen((const char *)t + 2, 16));
+            }
+        } else if (kind == PKT_EVENTS && len >= HDR_SIZE + count * EV_SIZE) {
+            for (unsigned i = 0; i < count; i++) {
+                const uint8_t *e = body + i * EV_SIZE;
+                event(rd32(e), e[4], e[5], rd16(e + 6));
+            }
+        }
+    }
+
+    void write_json(FILE *f) const {
+        bool first = true;
+        auto sep = [&]() { fputs(first ? "\n" : ",\n", f); first = false; };
+
+        fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", f);
+        const std::pair<int, const char *> procs[] = { { PID_TASKS, "Tasks" }, { PID_ISR, "ISR" }, { PID_PIPE, "Pipeline" }, { PID_COUNTERS, "Queues" } };
+        for (const auto &pr : procs) {
+            sep();
+            fprintf(f, "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":%d,\"args\":{\"name\":\"%s\"}}", pr.first, pr.second);
+            sep();
+            fprintf(f, "{\"ph\":\"M\",\"name\":\"process_sort_index\",\"pid\":%d,\"args\":{\"sort_index\":%d}}", pr.first, pr.first);
+        }
+        std::map<std::pair<int, unsigned>, bool> named;
+        for (const Slice &s : slices_) {
+            std::string name = slice_name(s);
+            if (!named[{ s.pid, s.tid }]) {
+                named[{ s.pid, s.tid }] = true;
+                sep();
+                fprintf(f, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                        s.pid, s.tid, name.c_str());
+            }
+            sep();
+            fprintf(f, "{\"ph\":\"X\",\"name\":\"%s\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"arg\":%u}}",
+                    name.c_str(), s.pid, s.tid, us(s.start), us(s.end) - us(s.start), s.arg);
+        }
+        for (const Counter &c : counters_) {
+            sep();
+            fprintf(f, "{\"ph\":\"C\",\"name\":\"%s\",\"pid\":%d,\"ts\":%.3f,\"args\":{\"value\":%u}}",
+                    table_name(counter_names, c.id, "counter ").c_str(), PID_COUNTERS, us(c.t), c.value);
+        }
+        for (const Instant &i : instants_) {
+            sep();
+            fprintf(f, "{\"ph\":\"i\",\"s\":\"g\",\"name\":\"%s\",\"pid\":%d,\"tid\":0,\"ts\":%.3f}",
+                    i.name.c_str(), PID_TASKS, us(i.t));
+        }
+        fputs("\n]}\n", f);
+    }
+
+    void print_summary(FILE *f) const {
+        double span_s = (have_ts_ && t64_ > origin_) ? (double)(t64_ - origin_) / cpu_hz_ : 0.0;
+        std::map<std::pair<int, unsigned>, Summary> sum;
+
+        for (const Slice &s : slices_) sum[{ s.pid, s.tid }].add(s.end - s.start);
+        fprintf(f, "%llu events in %llu packets over %.3f s (%.0f events/s), lost packets %llu, board drops %u\n",
+                (unsigned long long)events_, (unsigned long long)packets_, span_s,
+                span_s > 0 ? events_ / span_s : 0.0, (unsigned long long)lost_packets_, last_dropped_);
+        fprintf(f, "%-8s %-16s %8s %10s %10s %7s\n", "track", "name", "count", "avg us", "max us", "cpu %");
+        for (const auto &kv : sum) {
+            const Summary &s = kv.second;
+            Slice probe{ kv.first.first, kv.first.second, 0, 0, 0 };
+            const char *track = (probe.pid == PID_TASKS) ? "task" : (probe.pid == PID_ISR) ? "isr" : "stage";
+            fprintf(f, "%-8s %-16s %8llu %10.1f %10.1f %7.2f\n", track, slice_name(probe).c_str(),
+                    (unsigned long long)s.count, us_d(s.sum) / s.count, us_d(s.max),
+                    span_s > 0 ? us_d(s.sum) / (span_s * 1e4) : 0.0);
+        }
+    }
+
+private:
+    void event(uint32_t raw, uint8_t type, uint8_t id, uint16_t arg) {
+        /* CYCCNT 每 2^32 周期回绕，事件按时间顺序到达，差值展开成 64 位 */
+        if (!have_ts_) {
+            t64_ = origin_ = raw;
+            have_ts_ = true;
+        } else {
+            t64_ += (uint32_t)(raw - last_raw_);
+        }
+        last_raw_ = raw;
+        events_++;
+
+        switch (type) {
+        case EV_TASK_IN:
+            if (cur_task_valid_) slices_.push_back({ PID_TASKS, cur_task_, cur_task_start_, t64_, 0 });
+            cur_task_ = id;
+            cur_task_start_ = t64_;
+            cur_task_valid_ = true;
+            break;
+        case EV_ISR_ENTER:
+            isr_open_[id] = t64_;
+            break;
+        case EV_ISR_EXIT:
+            close(isr_open_, PID_ISR, id, 0);
+            break;
+        case EV_BEGIN:
+            stage_open_[id] = t64_;
+            break;
+        case EV_END:
+            close(stage_open_, PID_PIPE, id, arg);
+            break;
+        case EV_COUNTER:
+            counters_.push_back({ id, t64_, arg });
+            break;
+        default:
+            break;
+        }
+    }
+
+    void close(std::map<unsigned, uint64_t> &open, int pid, unsigned id, uint16_t arg) {
+        auto it = open.find(id);
+        if (it == open.end()) return;
+        slices_.push_back({ pid, id, it->second, t64_, arg });
+        open.erase(it);
+    }
+
+    /* 缺口：丢掉所有未配对的起点，标出位置 */
+    void gap(const std::string &what) {
+        cur_task_valid_ = false;
+        isr_open_.clear();
+        stage_open_.clear();
+        if (have_ts_) instants_.push_back({ t64_, what });
+    }
+
+    std::string slice_name(const Slice &s) const {
+        if (s.pid == PID_ISR) return table_name(isr_names, s.tid, "isr ");
+        if (s.pid == PID_PIPE) return table_name(stage_names, s.tid, "stage ");
+        auto it = task_names_.find(s.tid);
+        return (it != task_names_.end()) ? it->second : "task " + std::to_string(s.tid);
+    }
+
+    double us(uint64_t t) const { return us_d(t - origin_); }
+    double us_d(uint64_t cyc) const { return (double)cyc * 1e6 / cpu_hz_; }
+
+    uint32_t cpu_hz_ = 480000000;
+    bool have_seq_ = false, have_ts_ = false;
+    uint32_t last_seq_ = 0, last_dropped_ = 0, last_raw_ = 0;
+    uint64_t t64_ = 0, origin_ = 0;
+    uint64_t events_ = 0, packets_ = 0, lost_packets_ = 0;
+    bool cur_task_valid_ = false;
+    unsigned cur_task_ = 0;
+    uint64_t cur_task_start_ = 0;
+    std::map<unsigned, uint64_t> isr_open_, stage_open_;
+    std::map<unsigned, std::string> task_names_;
+    std::vector<Slice> slices_;
+    std::vector<Counter> counters_;
+    std::vector<Instant> instants_;
+};
+
+/* ========================================== */
+/* 3. 输入                                     */
+/* ========================================== */
+
+static volatile sig_atomic_t stop = 0;
+static void on_sigint(int) { stop = 1; }
+
+static int listen_udp(Converter &conv, int port, int seconds, FILE *raw) {
+#ifdef _WIN32
+    WSADATA wsa;
+    WSAStartup(MAKEWORD(2, 2), &wsa);
+#endif
+    int fd = (int)socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (fd < 0 || bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0) {
+        fprintf(stderr, "[ERR] cannot bind UDP port %d\n", port);
+        return -1;
+    }
+    fprintf(stderr, "[TRACE] listening on UDP %d%s\n", port, seconds > 0 ? "" : ", Ctrl-C to stop");
+
+    time_t t_end = time(nullptr) + seconds;
+    uint8_t buf[2048];
+    while (!stop && (seconds <= 0 || time(nullptr) < t_end)) {
+        fd_set rfds;
+        timeval tv{ 0, 200000 };
+        FD_ZERO(&rfds);
+        FD_SET(fd, &rfds);
+        if (select(fd + 1, &rfds, nullptr, nullptr, &tv) <= 0) continue;
+        int n = (int)recv(fd, (char *)buf, sizeof(buf), 0);
+        if (n <= 0) continue;
+        if (raw != nullptr) {
+            uint8_t l[2] = { (uint8_t)n, (uint8_t)(n >> 8) };
+            fwrite(l, 1, 2, raw);
+            fwrite(buf, 1, (size_t)n, raw);
+        }
+        conv.packet(buf, (size_t)n);
+    }
+#ifdef _WIN32
+    closesocket(fd);
+#else
+    ::close(fd);
+#endif
+    return 0;
+}
+
+/* -w 保存的格式：每个数据报前加 2 字节小端长度 */
+static int read_raw(Converter &conv, const char *path) {
+    FILE *f = fopen(path, "rb");
+    uint8_t l[2], buf[65536];
+
+    if (f == nullptr) {
+        fprintf(stderr, "[ERR] cannot open %s\n", path);
+        return -1;
+    }
+    while (fread(l, 1, 2, f) == 2) {
+        size_t n = l[0] | (l[1] << 8);
+        if (fread(buf, 1, n, f) != n) break;
+        conv.packet(buf, n);
+    }
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *out = nullptr, *raw_in = nullptr, *raw_out = nullptr;
+    int port = 8003, seconds = 0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-o" && i + 1 < argc) out = argv[++i];
+        else if (a == "-p" && i + 1 < argc) port = atoi(argv[++i]);
+        else if (a == "-t" && i + 1 < argc) seconds = atoi(argv[++i]);
+        else if (a == "-r" && i + 1 < argc) raw_in = argv[++i];
+        else if (a == "-w" && i + 1 < argc) raw_out = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s -o trace.json [-p port] [-t seconds] [-w raw.bin] | -o trace.json -r raw.bin\n", argv[0]);
+            return 2;
+        }
+    }
+    if (out == nullptr) {
+        fprintf(stderr, "[ERR] -o is required\n");
+        return 2;
+    }
+
+    Converter conv;
+    if (raw_in != nullptr) {
+        if (read_raw(conv, raw_in) != 0) return 1;
+    } else {
+        FILE *raw = (raw_out != nullptr) ? fopen(raw_out, "wb") : nullptr;
+        signal(SIGINT, on_sigint);
+        int ret = listen_udp(conv, port, seconds, raw);
+        if (raw != nullptr) fclose(raw);
+        if (ret != 0) return 1;
+    }
+
+    FILE *f = fopen(out, "w");
+    if (f == nullptr) {
+        fprintf(stderr, "[ERR] cannot write %s\n", out);
+        return 1;
+    }
+    conv.write_json(f);
+    fclose(f);
+    conv.print_summary(stderr);
+    fprintf(stderr, "[TRACE] wrote %s (open in ui.perfetto.dev or chrome://tracing)\n", out);
+    return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * 跟踪与结果融合主机测试：用合成轨迹序列驱动板端同一份 Vision_Track.c，
+ * 检查轨迹关联 (不串号/不断号)、融合判定类别与推理次数。
+ *
+ * 编译:
+ *   gcc -O2 -std=gnu99 -Wall -I../../APP/Inc -o track_sim track_sim.c \
+ *       ../../APP/src/Vision_Track.c ../../APP/src/Vision_Roi.c
+ *
+ * 用法:
+ *   track_sim          跑全部场景，任一场景不符合预期时返回非 0，可直接接入 CI
+ *   track_sim -v       同时逐帧打印关联与投票
+ *
+ * 模拟的流水线与板端一致：帧末 Track_Update，已判定的轨迹不再推理，
+ * 其余每个运动框推理一次并 Track_Vote。"推理"由按目标真实类别生成的带噪概率代替。
+ */
+#include "Vision_Track.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 与 app_config.h 保持一致 */
+#define SIM_FRAME_W        800
+#define SIM_FRAME_H        480
+#define SIM_MOTION_CELL    16
+#define SIM_CONF           0.85f
+#define SIM_ALPHA          0.5f
+#define SIM_MIN_VOTES      2
+#define SIM_IOU_PCT        30
+#define SIM_DIST           64
+#define SIM_MAX_MISS       5
+
+#define SIM_MAX_OBJ        4
+#define SIM_MAX_FRAMES     200
+
+/* ========================================== */
+/* 1. 场景                                     */
+/* ========================================== */
+
+typedef struct {
+    int16_t  x0, y0;          /* 首帧位置 */
+    int16_t  dx, dy;          /* 每帧位移 */
+    uint16_t w, h;
+    int      first, last;     /* 出现的帧区间 (含端点) */
+    uint8_t  cls;             /* 真实类别 */
+    float    conf;            /* 分类器对真实类别给出的平均概率 */
+    uint8_t  wrong_cls;       /* 前 wrong_votes 次推理误判为该类别 (0.9) */
+    uint8_t  wrong_votes;
+} SimObj_t;
+
+typedef struct {
+    const char *name;
+    int      frames;
+    uint8_t  n_obj;
+    SimObj_t obj[SIM_MAX_OBJ];
+    uint32_t exp_tracks;      /* 预期新建的轨迹数 */
+    uint32_t exp_decided;     /* 预期判定的轨迹数 */
+    uint32_t max_votes;       /* 推理次数上限 (0: 不检查) */
+} Scenario_t;
+
+static const Scenario_t scenarios[] = {
+    { "slow single car", 80, 1,
+      { { 40, 160, 6, 0, 160, 96, 0, 79, 3, 0.90f, 0, 0 } },
+      1, 1, 4 },
+    { "two lanes, opposite directions", 90, 2,
+      { { 20, 60, 8, 0, 176, 96, 0, 89, 3, 0.92f, 0, 0 },
+        { 700, 300, -7, 0, 128, 80, 5, 89, 9, 0.88f, 0, 0 } },
+      2, 2, 8 },
+    { "fast motorbike (no overlap between frames)", 14, 1,
+      { { 0, 200, 56, 0, 48, 48, 0, 13, 6, 0.93f, 0, 0 } },
+      1, 1, 4 },
+    { "car leaves, next car enters after a gap", 70, 2,
+      { { 40, 160, 20, 0, 160, 96, 0, 25, 3, 0.90f, 0, 0 },
+        { 40, 160, 20, 0, 160, 96, 33, 60, 4, 0.90f, 0, 0 } },
+      2, 2, 8 },
+    { "ambiguous object never decided", 40, 1,
+      { { 300, 200, 2, 1, 96, 96, 0, 39, 12, 0.45f, 0, 0 } },
+      1, 0, 0 },
+    { "first inference confidently wrong", 60, 1,
+      { { 100, 180, 5, 0, 192, 112, 0, 59, 3, 0.90f, 7, 1 } },
+      1, 1, 10 },
+    { "parked truck plus passing pedestrian", 60, 2,
+      { { 420, 120, 0, 1, 256, 224, 0, 59, 5, 0.91f, 0, 0 },
+        { 40, 300, 9, 0, 48, 112, 10, 40, 11, 0.87f, 0, 0 } },
+      2, 2, 10 },
+};
+#define NUM_SCENARIOS (sizeof(scenarios) / sizeof(scenarios[0]))
+
+/* 与平台无关的 LCG，保证各主机结果一致 */
+static uint32_t lcg_next(uint32_t *s) {
+    *s = *s * 1664525U + 1013904223U;
+    return *s >> 8;
+}
+
+static float noise(uint32_t *s, float amp) {
+    return ((float)(lcg_next(s) & 0xFFFF) / 65535.0f * 2.0f - 1.0f) * amp;
+}
+
+/* 目标在第 f 帧的运动框：与 Motion_Detect 一样量化到网格并裁到画面内 */
+static int sim_box(const SimObj_t *o, int f, VisionRect_t *box) {
+    int32_t x0, y0, x1, y1;
+
+    if (f < o->first || f > o->last) return 0;
+    x0 = o->x0 + o->dx * (f - o->first);
+    y0 = o->y0 + o->dy * (f - o->first);
+    x1 = x0 + o->w;
+    y1 = y0 + o->h;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > SIM_FRAME_W) x1 = SIM_FRAME_W;
+    if (y1 > SIM_FRAME_H) y1 = SIM_FRAME_H;
+    x0 = x0 / SIM_MOTION_CELL * SIM_MOTION_CELL;
+    y0 = y0 / SIM_MOTION_CELL * SIM_MOTION_CELL;
+    x1 = (x1 + SIM_MOTION_CELL - 1) / SIM_MOTION_CELL * SIM_MOTION_CELL;
+    y1 = (y1 + SIM_MOTION_CELL - 1) / SIM_MOTION_CELL * SIM_MOTION_CELL;
+    if (x1 - x0 < SIM_MOTION_CELL || y1 - y0 < SIM_MOTION_CELL) return 0;
+    box->x = (int16_t)x0;
+    box->y = (int16_t)y0;
+    box->w = (uint16_t)(x1 - x0);
+    box->h = (uint16_t)(y1 - y0);
+    return 1;
+}
+
+/* 模拟分类器输出：真实类别 (或误判类别) 取 conf ± 0.05，其余类别平分剩余概率 */
+static void sim_probs(const SimObj_t *o, uint32_t vote, uint32_t *seed, float *probs) {
+    uint8_t cls = (vote < o->wrong_votes) ? o->wrong_cls : o->cls;
+    float p = (vote < o->wrong_votes) ? 0.90f : o->conf + noise(seed, 0.05f);
+
+    if (p > 0.99f) p = 0.99f;
+    for (uint8_t c = 0; c < TRACK_CLASSES; c++) {
+        probs[c] = (1.0f - p) / (TRACK_CLASSES - 1);
+    }
+    probs[cls] = p;
+}
+
+/* ========================================== */
+/* 2. 回放                                     */
+/* ========================================== */
+
+static int run_scenario(const Scenario_t *sc, int verbose) {
+    const TrackCfg_t cfg = {
+        SIM_IOU_PCT * 256 / 100, SIM_DIST, SIM_MAX_MISS, SIM_MIN_VOTES, SIM_ALPHA, SIM_CONF
+    };
+    static Tracker_t trk;
+    VisionRect_t boxes[SIM_MAX_OBJ];
+    uint8_t owner[SIM_MAX_OBJ];
+    uint8_t slot[SIM_MAX_OBJ];
+    uint16_t obj_id[SIM_MAX_OBJ] = {0};       /* 各目标首次关联到的轨迹号 */
+    uint32_t obj_votes[SIM_MAX_OBJ] = {0};
+    int obj_decided_at[SIM_MAX_OBJ];
+    uint8_t obj_decided_cls[SIM_MAX_OBJ];
+    uint32_t seed = 12345;
+    uint32_t baseline = 0;
+    int ok = 1;
+
+    Track_Init(&trk);
+    for (uint8_t k = 0; k < SIM_MAX_OBJ; k++) {
+        obj_decided_at[k] = -1;
+        obj_decided_cls[k] = 0xFF;
+    }
+
+    for (int f = 0; f < sc->frames; f++) {
+        uint8_t n = 0;
+
+        for (uint8_t k = 0; k < sc->n_obj; k++) {
+            if (sim_box(&sc->obj[k], f, &boxes[n])) owner[n++] = k;
+        }
+        /* Motion_EndFrame 按大小排序输出 */
+        for (uint8_t i = 0; i + 1 < n; i++) {
+            for (uint8_t j = i + 1; j < n; j++) {
+                if ((uint32_t)boxes[j].w * boxes[j].h > (uint32_t)boxes[i].w * boxes[i].h) {
+                    VisionRect_t tb = boxes[i];
+                    uint8_t to = owner[i];
+                    boxes[i] = boxes[j];
+                    owner[i] = owner[j];
+                    boxes[j] = tb;
+                    owner[j] = to;
+                }
+            }
+        }
+        baseline += n;
+        Track_Update(&trk, &cfg, boxes, n, slot);
+
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t k = owner[i];
+            uint16_t id = (slot[i] < TRACK_MAX) ? trk.t[slot[i]].id : 0;
+            float probs[TRACK_CLASSES];
+            uint8_t state;
+
+            if (obj_id[k] == 0) {
+                obj_id[k] = id;
+            } else if (obj_id[k] != id) {
+                printf("  frame %d: object %d switched track %d -> %d\n", f, k, obj_id[k], id);
+                obj_id[k] = id;
+                ok = 0;
+            }
+            if (!Track_NeedsInference(&trk, slot[i])) continue;
+
+            sim_probs(&sc->obj[k], obj_votes[k], &seed, probs);
+            obj_votes[k]++;
+            state = Track_Vote(&trk, &cfg, slot[i], id, probs);
+            if (verbose) {
+                printf("  f%3d obj%d box(%d,%d %dx%d) track %d vote %lu -> class %d %.3f%s\n",
+                       f, k, boxes[i].x, boxes[i].y, boxes[i].w, boxes[i].h, id, (unsigned long)obj_votes[k],
+                       trk.t[slot[i]].best, trk.t[slot[i]].score, state == TRACK_STATE_DECIDED ? " DECIDED" : "");
+            }
+            if (state == TRACK_STATE_DECIDED) {
+                obj_decided_at[k] = f - sc->obj[k].first;
+                obj_decided_cls[k] = trk.t[slot[i]].best;
+            }
+        }
+    }
+
+    printf("%-44s tracks %lu decided %lu inferences %lu/%lu",
+           sc->name, (unsigned long)trk.created, (unsigned long)trk.decided,
+           (unsigned long)trk.votes, (unsigned long)baseline);
+    for (uint8_t k = 0; k < sc->n_obj; k++) {
+        if (obj_decided_at[k] >= 0) printf(", obj%d class %d @%d", k, obj_decided_cls[k], obj_decided_at[k]);
+    }
+    printf("\n");
+
+    if (trk.created != sc->exp_tracks) {
+        printf("  expected %lu tracks\n", (unsigned long)sc->exp_tracks);
+        ok = 0;
+    }
+    if (trk.decided != sc->exp_decided) {
+        printf("  expected %lu decisions\n", (unsigned long)sc->exp_decided);
+        ok = 0;
+    }
+    if (sc->max_votes != 0 && trk.votes > sc->max_votes) {
+        printf("  expected at most %lu inferences\n", (unsigned long)sc->max_votes);
+        ok = 0;
+    }
+    for (uint8_t k = 0; k < sc->n_obj; k++) {
+        if (obj_decided_at[k] >= 0 && obj_decided_cls[k] != sc->obj[k].cls) {
+            printf("  object %d decided as class %d, truth %d\n", k, obj_decided_cls[k], sc->obj[k].cls);
+            ok = 0;
+        }
+    }
+    if (sc->exp_decided == 0 && trk.votes != baseline) {
+        printf("  undecided track must keep inferring\n");
+        ok = 0;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    int verbose = (argc >= 2 && strcmp(argv[1], "-v") == 0);
+    int failed = 0;
+
+    for (uint32_t i = 0; i < NUM_SCENARIOS; i++) {
+        if (!run_scenario(&scenarios[i], verbose)) {
+            printf("[FAIL] %s\n", scenarios[i].name);
+            failed++;
+        }
+    }
+    printf("%s: %lu/%lu scenarios\n", failed ? "[FAIL]" : "[PASS]",
+           (unsigned long)(NUM_SCENARIOS - failed), (unsigned long)NUM_SCENARIOS);
+    return failed ? 1 : 0;
+}
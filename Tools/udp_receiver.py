@@ -3,6 +3,7 @@
 IVCIS UDP JPEG 接收器
 用法: python udp_receiver.py
 功能: 接收 STM32 发送的 UDP 分片，重组为 JPEG 文件
+说明: 板卡默认只存不发，先运行 python subscribe.py BOARD_IP 把本机登记为上报目标
 """
 import socket
 import os